@@ -240,19 +240,28 @@
         'tests/cefclient/client_app.h',
         'tests/cefclient/client_switches.cpp',
         'tests/cefclient/client_switches.h',
+        'tests/unittests/asset_resource_handler_unittest.cc',
         'tests/unittests/command_line_unittest.cc',
         'tests/unittests/cookie_unittest.cc',
         'tests/unittests/dialog_unittest.cc',
         'tests/unittests/dom_unittest.cc',
         'tests/unittests/geolocation_unittest.cc',
         'tests/unittests/jsdialog_unittest.cc',
+        'tests/unittests/memory_pressure_unittest.cc',
+        'tests/unittests/message_loop_unittest.cc',
         'tests/unittests/navigation_unittest.cc',
+        'tests/unittests/os_rendering_unittest.cc',
         'tests/unittests/process_message_unittest.cc',
+        'tests/unittests/render_process_pool_unittest.cc',
+        'tests/unittests/renderer_process_group_unittest.cc',
         'tests/unittests/request_unittest.cc',
+        'tests/unittests/resource_bundle_unittest.cc',
+        'tests/unittests/resource_usage_unittest.cc',
         'tests/unittests/run_all_unittests.cc',
         'tests/unittests/scheme_handler_unittest.cc',
         'tests/unittests/stream_unittest.cc',
         'tests/unittests/string_unittest.cc',
+        'tests/unittests/task_unittest.cc',
         'tests/unittests/client_app_delegates.cc',
         'tests/unittests/test_handler.cc',
         'tests/unittests/test_handler.h',
@@ -265,6 +274,7 @@
         'tests/unittests/urlrequest_unittest.cc',
         'tests/unittests/v8_unittest.cc',
         'tests/unittests/values_unittest.cc',
+        'tests/unittests/visibility_unittest.cc',
         'tests/unittests/xml_reader_unittest.cc',
         'tests/unittests/zip_reader_unittest.cc',
       ],
@@ -782,6 +792,8 @@
       ],
       'sources': [
         '<@(includes_common)',
+        'libcef/browser/backing_store_osr.cc',
+        'libcef/browser/backing_store_osr.h',
         'libcef/browser/browser_context.cc',
         'libcef/browser/browser_context.h',
         'libcef/browser/browser_host_impl.cc',
@@ -798,6 +810,8 @@
         'libcef/browser/browser_urlrequest_impl.h',
         'libcef/browser/chrome_scheme_handler.cc',
         'libcef/browser/chrome_scheme_handler.h',
+        'libcef/browser/coalescing_cookie_store.cc',
+        'libcef/browser/coalescing_cookie_store.h',
         'libcef/browser/content_browser_client.cc',
         'libcef/browser/content_browser_client.h',
         'libcef/browser/context.cc',
@@ -822,6 +836,8 @@
         'libcef/browser/javascript_dialog.h',
         'libcef/browser/javascript_dialog_creator.cc',
         'libcef/browser/javascript_dialog_creator.h',
+        'libcef/browser/memory_pressure.cc',
+        'libcef/browser/memory_pressure.h',
         'libcef/browser/menu_creator.cc',
         'libcef/browser/menu_creator.h',
         'libcef/browser/menu_model_impl.cc',
@@ -832,8 +848,16 @@
         'libcef/browser/origin_whitelist_impl.h',
         'libcef/browser/path_util_impl.cc',
         'libcef/browser/process_util_impl.cc',
+        'libcef/browser/render_process_groups.cc',
+        'libcef/browser/render_process_groups.h',
+        'libcef/browser/render_process_pool.cc',
+        'libcef/browser/render_process_pool.h',
+        'libcef/browser/render_widget_host_view_osr.cc',
+        'libcef/browser/render_widget_host_view_osr.h',
         'libcef/browser/resource_context.cc',
         'libcef/browser/resource_context.h',
+        'libcef/browser/resource_usage.cc',
+        'libcef/browser/resource_usage.h',
         'libcef/browser/resource_dispatcher_host_delegate.cc',
         'libcef/browser/resource_dispatcher_host_delegate.h',
         'libcef/browser/resource_request_job.cc',
@@ -858,6 +882,8 @@
         'libcef/browser/url_request_context_proxy.h',
         'libcef/browser/url_request_interceptor.cc',
         'libcef/browser/url_request_interceptor.h',
+        'libcef/browser/web_contents_view_osr.cc',
+        'libcef/browser/web_contents_view_osr.h',
         'libcef/browser/web_plugin_impl.cc',
         'libcef/browser/web_plugin_impl.h',
         'libcef/browser/xml_reader_impl.cc',
@@ -888,11 +914,17 @@
         'libcef/common/response_manager.h',
         'libcef/common/scheme_registrar_impl.cc',
         'libcef/common/scheme_registrar_impl.h',
+        'libcef/common/startup_timeline.cc',
+        'libcef/common/startup_timeline.h',
         'libcef/common/string_list_impl.cc',
         'libcef/common/string_map_impl.cc',
         'libcef/common/string_multimap_impl.cc',
+        'libcef/common/string_pair_list.cc',
+        'libcef/common/string_pair_list.h',
         'libcef/common/string_types_impl.cc',
         'libcef/common/task_impl.cc',
+        'libcef/common/task_queue.cc',
+        'libcef/common/task_queue.h',
         'libcef/common/time_impl.cc',
         'libcef/common/time_util.h',
         'libcef/common/tracker.cc',
@@ -903,6 +935,8 @@
         'libcef/common/value_base.h',
         'libcef/common/values_impl.cc',
         'libcef/common/values_impl.h',
+        'libcef/common/worker_pool.cc',
+        'libcef/common/worker_pool.h',
         'libcef/renderer/browser_impl.cc',
         'libcef/renderer/browser_impl.h',
         'libcef/renderer/chrome_bindings.cc',
@@ -1189,7 +1223,11 @@
             'tests/unittests/client_app_delegates.cc',
             'tests/unittests/cookie_unittest.cc',
             'tests/unittests/dom_unittest.cc',
+            'tests/unittests/message_loop_unittest.cc',
             'tests/unittests/process_message_unittest.cc',
+            'tests/unittests/render_process_pool_unittest.cc',
+            'tests/unittests/renderer_process_group_unittest.cc',
+            'tests/unittests/resource_bundle_unittest.cc',
             'tests/unittests/scheme_handler_unittest.cc',
             'tests/unittests/urlrequest_unittest.cc',
             'tests/unittests/test_handler.cc',
@@ -79,7 +79,9 @@ CEF_EXPORT void cef_shutdown();
 // loop. Care must be taken to balance performance against excessive CPU usage.
 // This function should only be called on the main application thread and only
 // if cef_initialize() is called with a CefSettings.multi_threaded_message_loop
-// value of false (0). This function will not block.
+// value of false (0). This function will not block. Implement
+// cef_browser_process_handler_t::on_schedule_message_pump_work() to be notified
+// when this function should next be called.
 ///
 CEF_EXPORT void cef_do_message_loop_work();
 
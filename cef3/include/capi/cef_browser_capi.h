@@ -191,6 +191,47 @@ typedef struct _cef_run_file_dialog_callback_t {
 } cef_run_file_dialog_callback_t;
 
 
+///
+// Callback structure for cef_browser_host_t::NotifyMemoryPressure. The
+// functions of this structure will be called on the browser process UI thread.
+///
+typedef struct _cef_memory_pressure_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called after the render process has released memory. |bytes_freed| is the
+  // decrease in the size of the WebKit memory cache and the V8 heap, or -1 if
+  // the render process terminated before responding.
+  ///
+  void (CEF_CALLBACK *on_memory_released)(
+      struct _cef_memory_pressure_callback_t* self, int64 bytes_freed);
+} cef_memory_pressure_callback_t;
+
+
+///
+// Callback structure for cef_browser_host_t::GetResourceUsage. The functions of
+// this structure will be called on the browser process UI thread.
+///
+typedef struct _cef_resource_usage_callback_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Called with the resources used by |browser_host|. If the render process
+  // terminated before responding only the network values will be populated.
+  ///
+  void (CEF_CALLBACK *on_resource_usage)(
+      struct _cef_resource_usage_callback_t* self,
+      struct _cef_browser_host_t* browser_host,
+      const struct _cef_resource_usage_t* usage);
+} cef_resource_usage_callback_t;
+
+
 ///
 // Structure used to represent the browser process aspects of a browser window.
 // The functions of this structure can only be called in the browser process.
@@ -290,6 +331,111 @@ typedef struct _cef_browser_host_t {
       enum cef_file_dialog_mode_t mode, const cef_string_t* title,
       const cef_string_t* default_file_name, cef_string_list_t accept_types,
       struct _cef_run_file_dialog_callback_t* callback);
+
+  ///
+  // Notify the browser that it has been hidden or shown. While hidden the
+  // browser stops painting, JavaScript timers run at most once per second,
+  // requestAnimationFrame callbacks are paused and the page visibility state
+  // becomes "hidden". A render process is given background priority once all of
+  // the browsers that it hosts are hidden. Call this function when the browser
+  // window is minimized or moved to a background tab. If called on the UI
+  // thread the change will be applied immediately. Otherwise, the change will
+  // be applied asynchronously on the UI thread.
+  ///
+  void (CEF_CALLBACK *was_hidden)(struct _cef_browser_host_t* self, int hidden);
+
+  ///
+  // Returns true (1) if the browser has been hidden using was_hidden().
+  ///
+  int (CEF_CALLBACK *is_hidden)(struct _cef_browser_host_t* self);
+
+  ///
+  // Ask the render process that hosts this browser to release memory according
+  // to |level| without reloading any pages. Other browsers that share the same
+  // render process are affected as well. |callback| will be executed after the
+  // memory has been released and may be NULL. This function can be called on
+  // any thread.
+  ///
+  void (CEF_CALLBACK *notify_memory_pressure)(struct _cef_browser_host_t* self,
+      enum cef_memory_pressure_level_t level,
+      struct _cef_memory_pressure_callback_t* callback);
+
+  ///
+  // Retrieve the resources used by this browser. The V8 heap values are queried
+  // from the render process so |callback| will be executed asynchronously. See
+  // cef_resource_usage_t for a description of the values. This function can be
+  // called on any thread.
+  ///
+  void (CEF_CALLBACK *get_resource_usage)(struct _cef_browser_host_t* self,
+      struct _cef_resource_usage_callback_t* callback);
+
+  ///
+  // Returns true (1) if window rendering is disabled.
+  ///
+  int (CEF_CALLBACK *is_window_rendering_disabled)(
+      struct _cef_browser_host_t* self);
+
+  ///
+  // Notify the browser that the view size has changed. The new size will be
+  // retrieved by calling cef_render_handler_t::GetViewRect. This function is
+  // only used when window rendering is disabled.
+  ///
+  void (CEF_CALLBACK *was_resized)(struct _cef_browser_host_t* self);
+
+  ///
+  // Invalidate the |dirtyRect| region of the view. The browser will call
+  // cef_render_handler_t::OnPaint asynchronously with the updated region. This
+  // function is only used when window rendering is disabled.
+  ///
+  void (CEF_CALLBACK *invalidate)(struct _cef_browser_host_t* self,
+      const cef_rect_t* dirtyRect);
+
+  ///
+  // Send a key event to the browser. This function is only used when window
+  // rendering is disabled.
+  ///
+  void (CEF_CALLBACK *send_key_event)(struct _cef_browser_host_t* self,
+      const struct _cef_key_event_t* event);
+
+  ///
+  // Send a mouse click event to the browser. The |x| and |y| coordinates are
+  // relative to the upper-left corner of the view. This function is only used
+  // when window rendering is disabled.
+  ///
+  void (CEF_CALLBACK *send_mouse_click_event)(struct _cef_browser_host_t* self,
+      const struct _cef_mouse_event_t* event,
+      enum cef_mouse_button_type_t type, int mouseUp, int clickCount);
+
+  ///
+  // Send a mouse move event to the browser. The |x| and |y| coordinates are
+  // relative to the upper-left corner of the view. This function is only used
+  // when window rendering is disabled.
+  ///
+  void (CEF_CALLBACK *send_mouse_move_event)(struct _cef_browser_host_t* self,
+      const struct _cef_mouse_event_t* event, int mouseLeave);
+
+  ///
+  // Send a mouse wheel event to the browser. The |x| and |y| coordinates are
+  // relative to the upper-left corner of the view. The |deltaX| and |deltaY|
+  // values represent the movement delta in the X and Y directions respectively.
+  // This function is only used when window rendering is disabled.
+  ///
+  void (CEF_CALLBACK *send_mouse_wheel_event)(struct _cef_browser_host_t* self,
+      const struct _cef_mouse_event_t* event, int deltaX, int deltaY);
+
+  ///
+  // Send a focus event to the browser. This function is only used when window
+  // rendering is disabled.
+  ///
+  void (CEF_CALLBACK *send_focus_event)(struct _cef_browser_host_t* self,
+      int setFocus);
+
+  ///
+  // Send a capture lost event to the browser. This function is only used when
+  // window rendering is disabled.
+  ///
+  void (CEF_CALLBACK *send_capture_lost_event)(
+      struct _cef_browser_host_t* self);
 } cef_browser_host_t;
 
 
@@ -78,6 +78,50 @@ typedef struct _cef_browser_process_handler_t {
   void (CEF_CALLBACK *on_before_child_process_launch)(
       struct _cef_browser_process_handler_t* self,
       struct _cef_command_line_t* command_line);
+
+  ///
+  // Called when work is scheduled for the browser process main thread. Use this
+  // function to drive cef_do_message_loop_work() from an external message pump
+  // instead of calling it at a fixed interval. If |delay_ms| is <= 0 then
+  // cef_do_message_loop_work() should be called as soon as possible. Otherwise
+  // it should be called after |delay_ms| milliseconds. Each call replaces any
+  // pending schedule. This function is also called before
+  // cef_do_message_loop_work() returns if work is still pending, including when
+  // the call returned early because its time slice was exhausted. This function
+  // may be called on any thread, including from inside cef_post_task(), and is
+  // only called if CefSettings.multi_threaded_message_loop is false (0).
+  // Implementations must return quickly without blocking, posting tasks or
+  // calling other CEF functions; signal the external message pump and return.
+  ///
+  void (CEF_CALLBACK *on_schedule_message_pump_work)(
+      struct _cef_browser_process_handler_t* self, int64 delay_ms);
+
+  ///
+  // Called on the browser process UI thread when a new browser claims a spare
+  // render process. See CefSettings.spare_render_process_count. |wait_ms| is
+  // the time between the claim and the render process finishing initialization,
+  // which is 0 if the process was already initialized. |idle_ms| is the time
+  // that the initialized process waited to be claimed. This function is called
+  // after the render process has finished initialization.
+  ///
+  void (CEF_CALLBACK *on_spare_render_process_claimed)(
+      struct _cef_browser_process_handler_t* self, int64 wait_ms,
+      int64 idle_ms);
+
+  ///
+  // Called on the browser process UI thread when a startup phase completes in
+  // the browser process or in a render process. |process| identifies the
+  // process type and |name| identifies the phase. |start_us| is the start time
+  // of the phase in microseconds relative to when cef_initialize() was called
+  // and |duration_us| is the duration of the phase in microseconds. Phases that
+  // complete before the context is initialized are reported immediately before
+  // on_context_initialized(). Phases are also recorded as trace events in the
+  // "cef.startup" category when tracing is enabled.
+  ///
+  void (CEF_CALLBACK *on_startup_phase)(
+      struct _cef_browser_process_handler_t* self,
+      enum cef_process_id_t process, const cef_string_t* name, int64 start_us,
+      int64 duration_us);
 } cef_browser_process_handler_t;
 
 
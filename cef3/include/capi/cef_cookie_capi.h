@@ -104,6 +104,39 @@ typedef struct _cef_cookie_manager_t {
   int (CEF_CALLBACK *delete_cookies)(struct _cef_cookie_manager_t* self,
       const cef_string_t* url, const cef_string_t* cookie_name);
 
+  ///
+  // Sets multiple cookies in a single operation. If |url| is NULL the URL for
+  // each cookie will be derived from the cookie's domain, path and secure
+  // attributes. Each cookie is validated as described for set_cookie() and
+  // invalid cookies are skipped. The cookies will be set asynchronously on the
+  // IO thread. Returns false (0) if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *set_cookies)(struct _cef_cookie_manager_t* self,
+      const cef_string_t* url, size_t cookiesCount,
+      const struct _cef_cookie_t* cookies);
+
+  ///
+  // Delete all cookies belonging to the specified |domains| or to any of their
+  // subdomains. Domain matching is case-insensitive and a leading '.' is
+  // ignored. The cookies will be deleted asynchronously on the IO thread.
+  // Returns false (0) if |domains| is NULL or if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *delete_domain_cookies)(struct _cef_cookie_manager_t* self,
+      cef_string_list_t domains);
+
+  ///
+  // Visit cookies in batches of up to |batch_size| cookies. If |batch_size| is
+  // less than 1 all cookies will be visited in a single batch. If |domains| is
+  // non-NULL only cookies belonging to the specified domains or to any of their
+  // subdomains will be visited. Domain matching is case-insensitive and a
+  // leading '.' is ignored. The returned cookies are ordered by longest path,
+  // then by earliest creation date. Returns false (0) if cookies cannot be
+  // accessed.
+  ///
+  int (CEF_CALLBACK *visit_domain_cookies)(struct _cef_cookie_manager_t* self,
+      cef_string_list_t domains, int batch_size,
+      struct _cef_cookie_batch_visitor_t* visitor);
+
   ///
   // Sets the directory path that will be used for storing cookie data. If
   // |path| is NULL data will be stored in memory only. Returns false (0) if
@@ -111,6 +144,26 @@ typedef struct _cef_cookie_manager_t {
   ///
   int (CEF_CALLBACK *set_storage_path)(struct _cef_cookie_manager_t* self,
       const cef_string_t* path);
+
+  ///
+  // Sets the policy for committing changes to the on-disk cookie database. The
+  // policy will be used the next time set_storage_path() is called with a new
+  // non-NULL path. The arguments have the same meaning as the CefSettings
+  // |cookie_commit_interval|, |cookie_commit_batch_size| and
+  // |cookie_deferred_commit| members which provide the default policy. Returns
+  // false (0) if called on the global cookie manager.
+  ///
+  int (CEF_CALLBACK *set_commit_policy)(struct _cef_cookie_manager_t* self,
+      int commit_interval, int commit_batch_size, int deferred_commit);
+
+  ///
+  // Flush the backing store (if any) to disk and execute the specified
+  // |handler| on the IO thread when done. Pending changes that are being
+  // buffered due to the cookie commit policy will be written immediately.
+  // Returns false (0) if cookies cannot be accessed.
+  ///
+  int (CEF_CALLBACK *flush_store)(struct _cef_cookie_manager_t* self,
+      struct _cef_completion_handler_t* handler);
 } cef_cookie_manager_t;
 
 
@@ -151,6 +204,29 @@ typedef struct _cef_cookie_visitor_t {
 } cef_cookie_visitor_t;
 
 
+///
+// Structure to implement for visiting cookie values in batches. The functions
+// of this structure will always be called on the IO thread.
+///
+typedef struct _cef_cookie_batch_visitor_t {
+  ///
+  // Base structure.
+  ///
+  cef_base_t base;
+
+  ///
+  // Method that will be called once for each batch of cookies. |offset| is the
+  // 0-based index of the first cookie in |cookies|. |total| is the total number
+  // of cookies that will be visited. The |cookies| values are only valid for
+  // the duration of this call. Return false (0) to stop visiting cookies. This
+  // function may never be called if no cookies are found.
+  ///
+  int (CEF_CALLBACK *visit_batch)(struct _cef_cookie_batch_visitor_t* self,
+      size_t cookiesCount, const struct _cef_cookie_t* cookies, int offset,
+      int total);
+} cef_cookie_batch_visitor_t;
+
+
 #ifdef __cplusplus
 }
 #endif
@@ -69,7 +69,8 @@ typedef struct _cef_domvisitor_t {
 
 ///
 // Structure used to represent a DOM document. The functions of this structure
-// should only be called on the render process main thread thread.
+// should only be called on the render process main thread thread. References to
+// objects of this structure must also be added and released on that thread.
 ///
 typedef struct _cef_domdocument_t {
   ///
@@ -181,7 +182,8 @@ typedef struct _cef_domdocument_t {
 
 ///
 // Structure used to represent a DOM node. The functions of this structure
-// should only be called on the render process main thread.
+// should only be called on the render process main thread. References to
+// objects of this structure must also be added and released on that thread.
 ///
 typedef struct _cef_domnode_t {
   ///
@@ -218,9 +220,10 @@ typedef struct _cef_domnode_t {
   ///
   // Returns the type of this form control element node.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_form_control_element_type)(
-      struct _cef_domnode_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_form_control_element_type)(
+      struct _cef_domnode_t* self, cef_string_t* _retval);
 
   ///
   // Returns true (1) if this object is pointing to the same handle as |that|
@@ -232,14 +235,18 @@ typedef struct _cef_domnode_t {
   ///
   // Returns the name of this node.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_name)(struct _cef_domnode_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_name)(struct _cef_domnode_t* self,
+      cef_string_t* _retval);
 
   ///
   // Returns the value of this node.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_value)(struct _cef_domnode_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_value)(struct _cef_domnode_t* self,
+      cef_string_t* _retval);
 
   ///
   // Set the value of this node. Returns true (1) on success.
@@ -315,9 +322,10 @@ typedef struct _cef_domnode_t {
   ///
   // Returns the tag name of this element.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_element_tag_name)(
-      struct _cef_domnode_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_element_tag_name)(struct _cef_domnode_t* self,
+      cef_string_t* _retval);
 
   ///
   // Returns true (1) if this element has attributes.
@@ -333,9 +341,10 @@ typedef struct _cef_domnode_t {
   ///
   // Returns the element attribute named |attrName|.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_element_attribute)(
-      struct _cef_domnode_t* self, const cef_string_t* attrName);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_element_attribute)(struct _cef_domnode_t* self,
+      const cef_string_t* attrName, cef_string_t* _retval);
 
   ///
   // Returns a map of all element attributes.
@@ -353,15 +362,17 @@ typedef struct _cef_domnode_t {
   ///
   // Returns the inner text of the element.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_element_inner_text)(
-      struct _cef_domnode_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_element_inner_text)(struct _cef_domnode_t* self,
+      cef_string_t* _retval);
 } cef_domnode_t;
 
 
 ///
 // Structure used to represent a DOM event. The functions of this structure
-// should only be called on the render process main thread.
+// should only be called on the render process main thread. References to
+// objects of this structure must also be added and released on that thread.
 ///
 typedef struct _cef_domevent_t {
   ///
@@ -63,8 +63,10 @@ typedef struct _cef_request_t {
   ///
   // Get the fully qualified URL.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_url)(struct _cef_request_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_url)(struct _cef_request_t* self,
+      cef_string_t* _retval);
 
   ///
   // Set the fully qualified URL.
@@ -76,8 +78,10 @@ typedef struct _cef_request_t {
   // Get the request function type. The value will default to POST if post data
   // is provided and GET otherwise.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_method)(struct _cef_request_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_method)(struct _cef_request_t* self,
+      cef_string_t* _retval);
 
   ///
   // Set the request function type.
@@ -101,20 +105,22 @@ typedef struct _cef_request_t {
   // Get the header values.
   ///
   void (CEF_CALLBACK *get_header_map)(struct _cef_request_t* self,
-      cef_string_multimap_t headerMap);
+      cef_string_block_visitor_t headerMapVisitor, void* headerMapContext);
 
   ///
   // Set the header values.
   ///
   void (CEF_CALLBACK *set_header_map)(struct _cef_request_t* self,
-      cef_string_multimap_t headerMap);
+      size_t headerMapCount, const cef_string_t* headerMapKeys,
+      const cef_string_t* headerMapValues);
 
   ///
   // Set all values at one time.
   ///
   void (CEF_CALLBACK *set)(struct _cef_request_t* self, const cef_string_t* url,
       const cef_string_t* method, struct _cef_post_data_t* postData,
-      cef_string_multimap_t headerMap);
+      size_t headerMapCount, const cef_string_t* headerMapKeys,
+      const cef_string_t* headerMapValues);
 
   ///
   // Get the flags used in combination with cef_urlrequest_t. See
@@ -132,9 +138,10 @@ typedef struct _cef_request_t {
   // Set the URL to the first party for cookies used in combination with
   // cef_urlrequest_t.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_first_party_for_cookies)(
-      struct _cef_request_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_first_party_for_cookies)(struct _cef_request_t* self,
+      cef_string_t* _retval);
 
   ///
   // Get the URL to the first party for cookies used in combination with
@@ -245,9 +252,10 @@ typedef struct _cef_post_data_element_t {
   ///
   // Return the file name.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_file)(
-      struct _cef_post_data_element_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_file)(struct _cef_post_data_element_t* self,
+      cef_string_t* _retval);
 
   ///
   // Return the number of bytes.
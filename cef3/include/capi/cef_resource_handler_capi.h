@@ -79,6 +79,22 @@ typedef struct _cef_resource_handler_t {
       struct _cef_resource_handler_t* self, struct _cef_response_t* response,
       int64* response_length, cef_string_t* redirectUrl);
 
+  ///
+  // Skip response data when a byte range has been requested. Called after
+  // get_response_headers() and before read_response() if the request specified
+  // a single byte range and the handler returned a 200 response with a known
+  // |response_length|. Skip over and discard |bytes_to_skip| bytes of response
+  // data, set |bytes_skipped| to the number of bytes skipped and return true
+  // (1). The response will then be returned with a 206 status and only the
+  // requested range will be read. Return false (0) if skipping is not supported
+  // and the complete response will be returned. If the range cannot be
+  // satisfied this function is called with a |bytes_to_skip| value of 0 and
+  // returning true (1) will fail the request with
+  // ERR_REQUEST_RANGE_NOT_SATISFIABLE.
+  ///
+  int (CEF_CALLBACK *skip_response)(struct _cef_resource_handler_t* self,
+      int64 bytes_to_skip, int64* bytes_skipped);
+
   ///
   // Read response data. If data is available immediately copy up to
   // |bytes_to_read| bytes into |data_out|, set |bytes_read| to the number of
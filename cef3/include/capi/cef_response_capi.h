@@ -73,9 +73,10 @@ typedef struct _cef_response_t {
   ///
   // Get the response status text.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_status_text)(
-      struct _cef_response_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_status_text)(struct _cef_response_t* self,
+      cef_string_t* _retval);
 
   ///
   // Set the response status text.
@@ -86,9 +87,10 @@ typedef struct _cef_response_t {
   ///
   // Get the response mime type.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_mime_type)(
-      struct _cef_response_t* self);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_mime_type)(struct _cef_response_t* self,
+      cef_string_t* _retval);
 
   ///
   // Set the response mime type.
@@ -99,21 +101,23 @@ typedef struct _cef_response_t {
   ///
   // Get the value for the specified response header field.
   ///
-  // The resulting string must be freed by calling cef_string_userfree_free().
-  cef_string_userfree_t (CEF_CALLBACK *get_header)(struct _cef_response_t* self,
-      const cef_string_t* name);
+  // The resulting string will be written to |_retval|, which must be cleared
+  // by calling cef_string_clear().
+  void (CEF_CALLBACK *get_header)(struct _cef_response_t* self,
+      const cef_string_t* name, cef_string_t* _retval);
 
   ///
   // Get all response header fields.
   ///
   void (CEF_CALLBACK *get_header_map)(struct _cef_response_t* self,
-      cef_string_multimap_t headerMap);
+      cef_string_block_visitor_t headerMapVisitor, void* headerMapContext);
 
   ///
   // Set all response header fields.
   ///
   void (CEF_CALLBACK *set_header_map)(struct _cef_response_t* self,
-      cef_string_multimap_t headerMap);
+      size_t headerMapCount, const cef_string_t* headerMapKeys,
+      const cef_string_t* headerMapValues);
 } cef_response_t;
 
 
@@ -48,14 +48,18 @@ extern "C" {
 ///
 // Register a scheme handler factory for the specified |scheme_name| and
 // optional |domain_name|. An NULL |domain_name| value for a standard scheme
-// will cause the factory to match all domain names. The |domain_name| value
-// will be ignored for non-standard schemes. If |scheme_name| is a built-in
-// scheme and no handler is returned by |factory| then the built-in scheme
-// handler factory will be called. If |scheme_name| is a custom scheme the
-// CefRegisterCustomScheme() function should be called for that scheme. This
-// function may be called multiple times to change or remove the factory that
-// matches the specified |scheme_name| and optional |domain_name|. Returns false
-// (0) if an error occurs. This function may be called on any thread.
+// will cause the factory to match all domain names. A |domain_name| value of
+// the form "*.example.com" will cause the factory to match all subdomains of
+// "example.com". If multiple factories match a domain name the factory for the
+// exact domain name will be used first followed by the factory for the longest
+// matching wildcard domain name. The |domain_name| value will be ignored for
+// non-standard schemes. If |scheme_name| is a built-in scheme and no handler is
+// returned by |factory| then the built-in scheme handler factory will be
+// called. If |scheme_name| is a custom scheme the CefRegisterCustomScheme()
+// function should be called for that scheme. This function may be called
+// multiple times to change or remove the factory that matches the specified
+// |scheme_name| and optional |domain_name|. Returns false (0) if an error
+// occurs. This function may be called on any thread.
 ///
 CEF_EXPORT int cef_register_scheme_handler_factory(
     const cef_string_t* scheme_name, const cef_string_t* domain_name,
@@ -67,6 +71,15 @@ CEF_EXPORT int cef_register_scheme_handler_factory(
 ///
 CEF_EXPORT int cef_clear_scheme_handler_factories();
 
+///
+// Returns the number of requests that have been dispatched to the scheme
+// handler factory registered for |scheme_name| and |domain_name|. The count is
+// reset each time the factory is registered. Returns -1 if no matching factory
+// is registered. This function must be called on the IO thread.
+///
+CEF_EXPORT int64 cef_get_scheme_handler_factory_hit_count(
+    const cef_string_t* scheme_name, const cef_string_t* domain_name);
+
 ///
 // Structure that manages custom scheme registrations.
 ///
@@ -62,6 +62,15 @@ CEF_EXPORT int cef_currently_on(cef_thread_id_t threadId);
 CEF_EXPORT int cef_post_task(cef_thread_id_t threadId,
     struct _cef_task_t* task);
 
+///
+// Post multiple tasks for execution on the specified thread. The tasks will be
+// executed in order and the target thread will only be woken once for the whole
+// batch. This function may be called on any thread. It is an error to request a
+// thread from the wrong process.
+///
+CEF_EXPORT int cef_post_task_batch(cef_thread_id_t threadId, size_t tasksCount,
+    struct _cef_task_t* const* tasks);
+
 ///
 // Post a task for delayed execution on the specified thread. This function may
 // be called on any thread. It is an error to request a thread from the wrong
@@ -70,6 +79,27 @@ CEF_EXPORT int cef_post_task(cef_thread_id_t threadId,
 CEF_EXPORT int cef_post_delayed_task(cef_thread_id_t threadId,
     struct _cef_task_t* task, int64 delay_ms);
 
+///
+// Post a task for execution on the TID_WORKER pool with the specified priority.
+// Tasks posted using CefPostTask(TID_WORKER) have normal priority. This
+// function may be called on any thread in any process.
+///
+CEF_EXPORT int cef_post_worker_task(cef_worker_priority_t priority,
+    struct _cef_task_t* task);
+
+///
+// Returns the number of tasks with the specified priority that are waiting to
+// be executed by the TID_WORKER pool. Delayed tasks are not counted until they
+// are due. This function may be called on any thread in any process.
+///
+CEF_EXPORT int cef_get_worker_queue_depth(cef_worker_priority_t priority);
+
+///
+// Returns the number of threads in the TID_WORKER pool. This function may be
+// called on any thread in any process.
+///
+CEF_EXPORT int cef_get_worker_thread_count();
+
 ///
 // Implement this structure for task execution. The functions of this structure
 // may be called on any thread.
@@ -83,7 +83,9 @@ void CefShutdown();
 // loop. Care must be taken to balance performance against excessive CPU usage.
 // This function should only be called on the main application thread and only
 // if CefInitialize() is called with a CefSettings.multi_threaded_message_loop
-// value of false. This function will not block.
+// value of false. This function will not block. Implement
+// CefBrowserProcessHandler::OnScheduleMessagePumpWork() to be notified when
+// this function should next be called.
 ///
 /*--cef()--*/
 void CefDoMessageLoopWork();
@@ -114,6 +114,38 @@ class CefRefCount {
   long refct_;  // NOLINT(runtime/int)
 };
 
+///
+// Class that implements non-atomic reference counting. Only use this class with
+// objects that are referenced, released and destroyed on a single thread.
+///
+class CefSingleThreadRefCount {
+ public:
+  CefSingleThreadRefCount() : refct_(0) {}
+
+  ///
+  // Non-atomic reference increment.
+  ///
+  int AddRef() {
+    return ++refct_;
+  }
+
+  ///
+  // Non-atomic reference decrement. Returns the new reference count. The
+  // caller is responsible for deleting the object when zero is returned.
+  ///
+  int Release() {
+    return --refct_;
+  }
+
+  ///
+  // Return the current number of references.
+  ///
+  int GetRefCt() { return refct_; }
+
+ private:
+  int refct_;
+};
+
 ///
 // Macro that provides a reference counting implementation for classes extending
 // CefBase.
@@ -131,6 +163,24 @@ class CefRefCount {
   private:                                          \
     CefRefCount refct_;
 
+///
+// Macro that provides a non-atomic reference counting implementation for
+// classes extending CefBase. Only use this macro with classes whose objects
+// are referenced, released and destroyed on a single thread.
+///
+#define IMPLEMENT_SINGLE_THREAD_REFCOUNTING(ClassName)  \
+  public:                                               \
+    int AddRef() { return refct_.AddRef(); }            \
+    int Release() {                                     \
+      int retval = refct_.Release();                    \
+      if (retval == 0)                                  \
+        delete this;                                    \
+      return retval;                                    \
+    }                                                   \
+    int GetRefCt() { return refct_.GetRefCt(); }        \
+  private:                                              \
+    CefSingleThreadRefCount refct_;
+
 ///
 // Macro that provides a locking implementation. Use the Lock() and Unlock()
 // methods to protect a section of code from simultaneous access by multiple
@@ -201,6 +201,40 @@ class CefRunFileDialogCallback : public virtual CefBase {
 };
 
 
+///
+// Callback interface for CefBrowserHost::NotifyMemoryPressure. The methods of
+// this class will be called on the browser process UI thread.
+///
+/*--cef(source=client)--*/
+class CefMemoryPressureCallback : public virtual CefBase {
+ public:
+  ///
+  // Called after the render process has released memory. |bytes_freed| is the
+  // decrease in the size of the WebKit memory cache and the V8 heap, or -1 if
+  // the render process terminated before responding.
+  ///
+  /*--cef()--*/
+  virtual void OnMemoryReleased(int64 bytes_freed) =0;
+};
+
+
+///
+// Callback interface for CefBrowserHost::GetResourceUsage. The methods of this
+// class will be called on the browser process UI thread.
+///
+/*--cef(source=client)--*/
+class CefResourceUsageCallback : public virtual CefBase {
+ public:
+  ///
+  // Called with the resources used by |browser_host|. If the render process
+  // terminated before responding only the network values will be populated.
+  ///
+  /*--cef()--*/
+  virtual void OnResourceUsage(CefRefPtr<CefBrowserHost> browser_host,
+                               const CefResourceUsage& usage) =0;
+};
+
+
 ///
 // Class used to represent the browser process aspects of a browser window. The
 // methods of this class can only be called in the browser process. They may be
@@ -211,6 +245,8 @@ class CefRunFileDialogCallback : public virtual CefBase {
 class CefBrowserHost : public virtual CefBase {
  public:
   typedef cef_file_dialog_mode_t FileDialogMode;
+  typedef cef_memory_pressure_level_t MemoryPressureLevel;
+  typedef cef_mouse_button_type_t MouseButtonType;
 
   ///
   // Create a new browser window using the window parameters specified by
@@ -329,6 +365,119 @@ class CefBrowserHost : public virtual CefBase {
                              const CefString& default_file_name,
                              const std::vector<CefString>& accept_types,
                              CefRefPtr<CefRunFileDialogCallback> callback) =0;
+
+  ///
+  // Notify the browser that it has been hidden or shown. While hidden the
+  // browser stops painting, JavaScript timers run at most once per second,
+  // requestAnimationFrame callbacks are paused and the page visibility state
+  // becomes "hidden". A render process is given background priority once all
+  // of the browsers that it hosts are hidden. Call this method when the browser
+  // window is minimized or moved to a background tab. If called on the UI
+  // thread the change will be applied immediately. Otherwise, the change will
+  // be applied asynchronously on the UI thread.
+  ///
+  /*--cef()--*/
+  virtual void WasHidden(bool hidden) =0;
+
+  ///
+  // Returns true if the browser has been hidden using WasHidden().
+  ///
+  /*--cef()--*/
+  virtual bool IsHidden() =0;
+
+  ///
+  // Ask the render process that hosts this browser to release memory according
+  // to |level| without reloading any pages. Other browsers that share the same
+  // render process are affected as well. |callback| will be executed after the
+  // memory has been released and may be NULL. This method can be called on any
+  // thread.
+  ///
+  /*--cef(optional_param=callback)--*/
+  virtual void NotifyMemoryPressure(
+      MemoryPressureLevel level,
+      CefRefPtr<CefMemoryPressureCallback> callback) =0;
+
+  ///
+  // Retrieve the resources used by this browser. The V8 heap values are
+  // queried from the render process so |callback| will be executed
+  // asynchronously. See cef_resource_usage_t for a description of the values.
+  // This method can be called on any thread.
+  ///
+  /*--cef()--*/
+  virtual void GetResourceUsage(
+      CefRefPtr<CefResourceUsageCallback> callback) =0;
+
+  ///
+  // Returns true if window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual bool IsWindowRenderingDisabled() =0;
+
+  ///
+  // Notify the browser that the view size has changed. The new size will be
+  // retrieved by calling CefRenderHandler::GetViewRect. This method is only
+  // used when window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void WasResized() =0;
+
+  ///
+  // Invalidate the |dirtyRect| region of the view. The browser will call
+  // CefRenderHandler::OnPaint asynchronously with the updated region. This
+  // method is only used when window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void Invalidate(const CefRect& dirtyRect) =0;
+
+  ///
+  // Send a key event to the browser. This method is only used when window
+  // rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void SendKeyEvent(const CefKeyEvent& event) =0;
+
+  ///
+  // Send a mouse click event to the browser. The |x| and |y| coordinates are
+  // relative to the upper-left corner of the view. This method is only used
+  // when window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void SendMouseClickEvent(const CefMouseEvent& event,
+                                   MouseButtonType type,
+                                   bool mouseUp, int clickCount) =0;
+
+  ///
+  // Send a mouse move event to the browser. The |x| and |y| coordinates are
+  // relative to the upper-left corner of the view. This method is only used
+  // when window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void SendMouseMoveEvent(const CefMouseEvent& event,
+                                  bool mouseLeave) =0;
+
+  ///
+  // Send a mouse wheel event to the browser. The |x| and |y| coordinates are
+  // relative to the upper-left corner of the view. The |deltaX| and |deltaY|
+  // values represent the movement delta in the X and Y directions
+  // respectively. This method is only used when window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void SendMouseWheelEvent(const CefMouseEvent& event,
+                                   int deltaX, int deltaY) =0;
+
+  ///
+  // Send a focus event to the browser. This method is only used when window
+  // rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void SendFocusEvent(bool setFocus) =0;
+
+  ///
+  // Send a capture lost event to the browser. This method is only used when
+  // window rendering is disabled.
+  ///
+  /*--cef()--*/
+  virtual void SendCaptureLostEvent() =0;
 };
 
 #endif  // CEF_INCLUDE_CEF_BROWSER_H_
@@ -40,6 +40,7 @@
 
 #include "include/cef_base.h"
 #include "include/cef_command_line.h"
+#include "include/cef_process_message.h"
 #include "include/cef_proxy_handler.h"
 
 ///
@@ -74,6 +75,51 @@ class CefBrowserProcessHandler : public virtual CefBase {
   virtual void OnBeforeChildProcessLaunch(
       CefRefPtr<CefCommandLine> command_line) {
   }
+
+  ///
+  // Called when work is scheduled for the browser process main thread. Use
+  // this method to drive CefDoMessageLoopWork() from an external message pump
+  // instead of calling it at a fixed interval. If |delay_ms| is <= 0 then
+  // CefDoMessageLoopWork() should be called as soon as possible. Otherwise it
+  // should be called after |delay_ms| milliseconds. Each call replaces any
+  // pending schedule. This method is also called before CefDoMessageLoopWork()
+  // returns if work is still pending, including when the call returned early
+  // because its time slice was exhausted. This method may be called on any
+  // thread, including from inside CefPostTask(), and is only called if
+  // CefSettings.multi_threaded_message_loop is false. Implementations must
+  // return quickly without blocking, posting tasks or calling other CEF
+  // methods; signal the external message pump and return.
+  ///
+  /*--cef()--*/
+  virtual void OnScheduleMessagePumpWork(int64 delay_ms) {}
+
+  ///
+  // Called on the browser process UI thread when a new browser claims a spare
+  // render process. See CefSettings.spare_render_process_count. |wait_ms| is
+  // the time between the claim and the render process finishing
+  // initialization, which is 0 if the process was already initialized.
+  // |idle_ms| is the time that the initialized process waited to be claimed.
+  // This method is called after the render process has finished
+  // initialization.
+  ///
+  /*--cef()--*/
+  virtual void OnSpareRenderProcessClaimed(int64 wait_ms, int64 idle_ms) {}
+
+  ///
+  // Called on the browser process UI thread when a startup phase completes in
+  // the browser process or in a render process. |process| identifies the
+  // process type and |name| identifies the phase. |start_us| is the start time
+  // of the phase in microseconds relative to when CefInitialize() was called
+  // and |duration_us| is the duration of the phase in microseconds. Phases that
+  // complete before the context is initialized are reported immediately before
+  // OnContextInitialized(). Phases are also recorded as trace events in the
+  // "cef.startup" category when tracing is enabled.
+  ///
+  /*--cef()--*/
+  virtual void OnStartupPhase(CefProcessId process,
+                              const CefString& name,
+                              int64 start_us,
+                              int64 duration_us) {}
 };
 
 #endif  // CEF_INCLUDE_CEF_BROWSER_PROCESS_HANDLER_H_
@@ -59,4 +59,18 @@ class CefCallback : public virtual CefBase {
   virtual void Cancel() =0;
 };
 
+
+///
+// Generic callback interface used for asynchronous completion.
+///
+/*--cef(source=client)--*/
+class CefCompletionHandler : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called once the task is complete.
+  ///
+  /*--cef()--*/
+  virtual void OnComplete() =0;
+};
+
 #endif  // CEF_INCLUDE_CEF_CALLBACK_H_
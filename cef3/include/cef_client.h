@@ -50,6 +50,7 @@
 #include "include/cef_life_span_handler.h"
 #include "include/cef_load_handler.h"
 #include "include/cef_process_message.h"
+#include "include/cef_render_handler.h"
 #include "include/cef_request_handler.h"
 
 ///
@@ -143,6 +144,14 @@ class CefClient : public virtual CefBase {
     return NULL;
   }
 
+  ///
+  // Return the handler for off-screen rendering events.
+  ///
+  /*--cef()--*/
+  virtual CefRefPtr<CefRenderHandler> GetRenderHandler() {
+    return NULL;
+  }
+
   ///
   // Return the handler for browser request events.
   ///
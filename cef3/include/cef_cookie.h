@@ -39,9 +39,11 @@
 #pragma once
 
 #include "include/cef_base.h"
+#include "include/cef_callback.h"
 #include <vector>
 
 class CefCookieVisitor;
+class CefCookieBatchVisitor;
 
 
 ///
@@ -115,6 +117,40 @@ class CefCookieManager : public virtual CefBase {
   virtual bool DeleteCookies(const CefString& url,
                              const CefString& cookie_name) =0;
 
+  ///
+  // Sets multiple cookies in a single operation. If |url| is empty the URL for
+  // each cookie will be derived from the cookie's domain, path and secure
+  // attributes. Each cookie is validated as described for SetCookie() and
+  // invalid cookies are skipped. The cookies will be set asynchronously on the
+  // IO thread. Returns false if cookies cannot be accessed.
+  ///
+  /*--cef(optional_param=url)--*/
+  virtual bool SetCookies(const CefString& url,
+                          const std::vector<CefCookie>& cookies) =0;
+
+  ///
+  // Delete all cookies belonging to the specified |domains| or to any of their
+  // subdomains. Domain matching is case-insensitive and a leading '.' is
+  // ignored. The cookies will be deleted asynchronously on the IO thread.
+  // Returns false if |domains| is empty or if cookies cannot be accessed.
+  ///
+  /*--cef()--*/
+  virtual bool DeleteDomainCookies(const std::vector<CefString>& domains) =0;
+
+  ///
+  // Visit cookies in batches of up to |batch_size| cookies. If |batch_size| is
+  // less than 1 all cookies will be visited in a single batch. If |domains| is
+  // non-empty only cookies belonging to the specified domains or to any of
+  // their subdomains will be visited. Domain matching is case-insensitive and a
+  // leading '.' is ignored. The returned cookies are ordered by longest path,
+  // then by earliest creation date. Returns false if cookies cannot be
+  // accessed.
+  ///
+  /*--cef()--*/
+  virtual bool VisitDomainCookies(const std::vector<CefString>& domains,
+                                  int batch_size,
+                                  CefRefPtr<CefCookieBatchVisitor> visitor) =0;
+
   ///
   // Sets the directory path that will be used for storing cookie data. If
   // |path| is empty data will be stored in memory only. Returns false if
@@ -122,6 +158,27 @@ class CefCookieManager : public virtual CefBase {
   ///
   /*--cef(optional_param=path)--*/
   virtual bool SetStoragePath(const CefString& path) =0;
+
+  ///
+  // Sets the policy for committing changes to the on-disk cookie database. The
+  // policy will be used the next time SetStoragePath() is called with a new
+  // non-empty path. The arguments have the same meaning as the CefSettings
+  // |cookie_commit_interval|, |cookie_commit_batch_size| and
+  // |cookie_deferred_commit| members which provide the default policy. Returns
+  // false if called on the global cookie manager.
+  ///
+  /*--cef()--*/
+  virtual bool SetCommitPolicy(int commit_interval, int commit_batch_size,
+                               bool deferred_commit) =0;
+
+  ///
+  // Flush the backing store (if any) to disk and execute the specified
+  // |handler| on the IO thread when done. Pending changes that are being
+  // buffered due to the cookie commit policy will be written immediately.
+  // Returns false if cookies cannot be accessed.
+  ///
+  /*--cef(optional_param=handler)--*/
+  virtual bool FlushStore(CefRefPtr<CefCompletionHandler> handler) =0;
 };
 
 
@@ -144,4 +201,24 @@ class CefCookieVisitor : public virtual CefBase {
                      bool& deleteCookie) =0;
 };
 
+
+///
+// Interface to implement for visiting cookie values in batches. The methods of
+// this class will always be called on the IO thread.
+///
+/*--cef(source=client)--*/
+class CefCookieBatchVisitor : public virtual CefBase {
+ public:
+  ///
+  // Method that will be called once for each batch of cookies. |offset| is the
+  // 0-based index of the first cookie in |cookies|. |total| is the total number
+  // of cookies that will be visited. The |cookies| values are only valid for
+  // the duration of this call. Return false to stop visiting cookies. This
+  // method may never be called if no cookies are found.
+  ///
+  /*--cef()--*/
+  virtual bool VisitBatch(const std::vector<CefCookie>& cookies, int offset,
+                          int total) =0;
+};
+
 #endif  // CEF_INCLUDE_CEF_COOKIE_H_
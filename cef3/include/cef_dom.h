@@ -66,9 +66,10 @@ class CefDOMVisitor : public virtual CefBase {
 
 ///
 // Class used to represent a DOM document. The methods of this class should only
-// be called on the render process main thread thread.
+// be called on the render process main thread thread. References to objects of
+// this class must also be added and released on that thread.
 ///
-/*--cef(source=library)--*/
+/*--cef(source=library,single_thread)--*/
 class CefDOMDocument : public virtual CefBase {
  public:
   typedef cef_dom_document_type_t Type;
@@ -174,9 +175,10 @@ class CefDOMDocument : public virtual CefBase {
 
 ///
 // Class used to represent a DOM node. The methods of this class should only be
-// called on the render process main thread.
+// called on the render process main thread. References to objects of this class
+// must also be added and released on that thread.
 ///
-/*--cef(source=library)--*/
+/*--cef(source=library,single_thread)--*/
 class CefDOMNode : public virtual CefBase {
  public:
   typedef std::map<CefString, CefString> AttributeMap;
@@ -215,7 +217,7 @@ class CefDOMNode : public virtual CefBase {
   ///
   // Returns the type of this form control element node.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetFormControlElementType() =0;
 
   ///
@@ -228,13 +230,13 @@ class CefDOMNode : public virtual CefBase {
   ///
   // Returns the name of this node.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetName() =0;
 
   ///
   // Returns the value of this node.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetValue() =0;
 
   ///
@@ -312,7 +314,7 @@ class CefDOMNode : public virtual CefBase {
   ///
   // Returns the tag name of this element.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetElementTagName() =0;
 
   ///
@@ -330,7 +332,7 @@ class CefDOMNode : public virtual CefBase {
   ///
   // Returns the element attribute named |attrName|.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetElementAttribute(const CefString& attrName) =0;
 
   ///
@@ -350,16 +352,17 @@ class CefDOMNode : public virtual CefBase {
   ///
   // Returns the inner text of the element.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetElementInnerText() =0;
 };
 
 
 ///
 // Class used to represent a DOM event. The methods of this class should only
-// be called on the render process main thread.
+// be called on the render process main thread. References to objects of this
+// class must also be added and released on that thread.
 ///
-/*--cef(source=library)--*/
+/*--cef(source=library,single_thread)--*/
 class CefDOMEvent : public virtual CefBase {
  public:
   typedef cef_dom_event_category_t Category;
@@ -69,7 +69,7 @@ class CefRequest : public virtual CefBase {
   ///
   // Get the fully qualified URL.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetURL() =0;
 
   ///
@@ -82,7 +82,7 @@ class CefRequest : public virtual CefBase {
   // Get the request method type. The value will default to POST if post data
   // is provided and GET otherwise.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetMethod() =0;
 
   ///
@@ -106,19 +106,19 @@ class CefRequest : public virtual CefBase {
   ///
   // Get the header values.
   ///
-  /*--cef()--*/
+  /*--cef(borrowed_param=headerMap)--*/
   virtual void GetHeaderMap(HeaderMap& headerMap) =0;
 
   ///
   // Set the header values.
   ///
-  /*--cef()--*/
+  /*--cef(borrowed_param=headerMap)--*/
   virtual void SetHeaderMap(const HeaderMap& headerMap) =0;
 
   ///
   // Set all values at one time.
   ///
-  /*--cef(optional_param=postData)--*/
+  /*--cef(optional_param=postData,borrowed_param=headerMap)--*/
   virtual void Set(const CefString& url,
                    const CefString& method,
                    CefRefPtr<CefPostData> postData,
@@ -142,7 +142,7 @@ class CefRequest : public virtual CefBase {
   // Set the URL to the first party for cookies used in combination with
   // CefURLRequest.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetFirstPartyForCookies() =0;
 
   ///
@@ -260,7 +260,7 @@ class CefPostDataElement : public virtual CefBase {
   ///
   // Return the file name.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetFile() =0;
 
   ///
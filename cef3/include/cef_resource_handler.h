@@ -78,6 +78,23 @@ class CefResourceHandler : public virtual CefBase {
                                   int64& response_length,
                                   CefString& redirectUrl) =0;
 
+  ///
+  // Skip response data when a byte range has been requested. Called after
+  // GetResponseHeaders() and before ReadResponse() if the request specified a
+  // single byte range and the handler returned a 200 response with a known
+  // |response_length|. Skip over and discard |bytes_to_skip| bytes of response
+  // data, set |bytes_skipped| to the number of bytes skipped and return true.
+  // The response will then be returned with a 206 status and only the
+  // requested range will be read. Return false if skipping is not supported and
+  // the complete response will be returned. If the range cannot be satisfied
+  // this method is called with a |bytes_to_skip| value of 0 and returning true
+  // will fail the request with ERR_REQUEST_RANGE_NOT_SATISFIABLE.
+  ///
+  /*--cef()--*/
+  virtual bool SkipResponse(int64 bytes_to_skip, int64& bytes_skipped) {
+    return false;
+  }
+
   ///
   // Read response data. If data is available immediately copy up to
   // |bytes_to_read| bytes into |data_out|, set |bytes_read| to the number of
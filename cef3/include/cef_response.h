@@ -77,7 +77,7 @@ class CefResponse : public virtual CefBase {
   ///
   // Get the response status text.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetStatusText() =0;
 
   ///
@@ -89,7 +89,7 @@ class CefResponse : public virtual CefBase {
   ///
   // Get the response mime type.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetMimeType() = 0;
 
   ///
@@ -101,19 +101,19 @@ class CefResponse : public virtual CefBase {
   ///
   // Get the value for the specified response header field.
   ///
-  /*--cef()--*/
+  /*--cef(buffer_retval)--*/
   virtual CefString GetHeader(const CefString& name) =0;
 
   ///
   // Get all response header fields.
   ///
-  /*--cef()--*/
+  /*--cef(borrowed_param=headerMap)--*/
   virtual void GetHeaderMap(HeaderMap& headerMap) =0;
 
   ///
   // Set all response header fields.
   ///
-  /*--cef()--*/
+  /*--cef(borrowed_param=headerMap)--*/
   virtual void SetHeaderMap(const HeaderMap& headerMap) =0;
 };
 
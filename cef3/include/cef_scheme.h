@@ -51,8 +51,12 @@ class CefSchemeHandlerFactory;
 ///
 // Register a scheme handler factory for the specified |scheme_name| and
 // optional |domain_name|. An empty |domain_name| value for a standard scheme
-// will cause the factory to match all domain names. The |domain_name| value
-// will be ignored for non-standard schemes. If |scheme_name| is a built-in
+// will cause the factory to match all domain names. A |domain_name| value of
+// the form "*.example.com" will cause the factory to match all subdomains of
+// "example.com". If multiple factories match a domain name the factory for the
+// exact domain name will be used first followed by the factory for the longest
+// matching wildcard domain name. The |domain_name| value will be ignored for
+// non-standard schemes. If |scheme_name| is a built-in
 // scheme and no handler is returned by |factory| then the built-in scheme
 // handler factory will be called. If |scheme_name| is a custom scheme the
 // CefRegisterCustomScheme() function should be called for that scheme.
@@ -73,6 +77,16 @@ bool CefRegisterSchemeHandlerFactory(
 /*--cef()--*/
 bool CefClearSchemeHandlerFactories();
 
+///
+// Returns the number of requests that have been dispatched to the scheme
+// handler factory registered for |scheme_name| and |domain_name|. The count is
+// reset each time the factory is registered. Returns -1 if no matching factory
+// is registered. This function must be called on the IO thread.
+///
+/*--cef(optional_param=domain_name,default_retval=-1)--*/
+int64 CefGetSchemeHandlerFactoryHitCount(const CefString& scheme_name,
+                                         const CefString& domain_name);
+
 
 ///
 // Class that manages custom scheme registrations.
@@ -37,11 +37,15 @@
 #ifndef CEF_INCLUDE_CEF_TASK_H_
 #define CEF_INCLUDE_CEF_TASK_H_
 
+#include <vector>
 #include "include/cef_base.h"
+#include "include/internal/cef_task_function.h"
 
 class CefTask;
 
 typedef cef_thread_id_t CefThreadId;
+typedef cef_worker_priority_t CefWorkerPriority;
+typedef std::vector<CefRefPtr<CefTask> > CefTaskList;
 
 ///
 // CEF maintains multiple internal threads that are used for handling different
@@ -61,6 +65,15 @@ bool CefCurrentlyOn(CefThreadId threadId);
 /*--cef()--*/
 bool CefPostTask(CefThreadId threadId, CefRefPtr<CefTask> task);
 
+///
+// Post multiple tasks for execution on the specified thread. The tasks will be
+// executed in order and the target thread will only be woken once for the
+// whole batch. This function may be called on any thread. It is an error to
+// request a thread from the wrong process.
+///
+/*--cef()--*/
+bool CefPostTaskBatch(CefThreadId threadId, const CefTaskList& tasks);
+
 ///
 // Post a task for delayed execution on the specified thread. This function may
 // be called on any thread. It is an error to request a thread from the wrong
@@ -70,6 +83,29 @@ bool CefPostTask(CefThreadId threadId, CefRefPtr<CefTask> task);
 bool CefPostDelayedTask(CefThreadId threadId, CefRefPtr<CefTask> task,
                         int64 delay_ms);
 
+///
+// Post a task for execution on the TID_WORKER pool with the specified
+// priority. Tasks posted using CefPostTask(TID_WORKER) have normal priority.
+// This function may be called on any thread in any process.
+///
+/*--cef()--*/
+bool CefPostWorkerTask(CefWorkerPriority priority, CefRefPtr<CefTask> task);
+
+///
+// Returns the number of tasks with the specified priority that are waiting to
+// be executed by the TID_WORKER pool. Delayed tasks are not counted until they
+// are due. This function may be called on any thread in any process.
+///
+/*--cef()--*/
+int CefGetWorkerQueueDepth(CefWorkerPriority priority);
+
+///
+// Returns the number of threads in the TID_WORKER pool. This function may be
+// called on any thread in any process.
+///
+/*--cef()--*/
+int CefGetWorkerThreadCount();
+
 
 ///
 // Implement this interface for task execution. The methods of this class may
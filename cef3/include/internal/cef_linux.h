@@ -110,6 +110,7 @@ struct CefWindowInfoTraits {
       bool copy) {
     target->widget = src->widget;
     target->parent_widget = src->parent_widget;
+    target->window_rendering_disabled = src->window_rendering_disabled;
   }
 };
 
@@ -125,6 +126,11 @@ class CefWindowInfo : public CefStructBase<CefWindowInfoTraits> {
   void SetAsChild(CefWindowHandle ParentWidget) {
     parent_widget = ParentWidget;
   }
+
+  void SetAsOffScreen(CefWindowHandle ParentWidget) {
+    window_rendering_disabled = true;
+    parent_widget = ParentWidget;
+  }
 };
 
 #endif  // OS_LINUX
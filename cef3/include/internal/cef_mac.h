@@ -120,6 +120,7 @@ struct CefWindowInfoTraits {
     target->width = src->width;
     target->height = src->height;
     target->hidden = src->hidden;
+    target->window_rendering_disabled = src->window_rendering_disabled;
   }
 };
 
@@ -141,6 +142,11 @@ class CefWindowInfo : public CefStructBase<CefWindowInfoTraits> {
     this->height = height;
     hidden = false;
   }
+
+  void SetAsOffScreen(CefWindowHandle ParentView) {
+    window_rendering_disabled = true;
+    parent_view = ParentView;
+  }
 };
 
 #endif  // OS_MACOSX
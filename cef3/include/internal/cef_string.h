@@ -64,6 +64,7 @@ typedef cef_string_utf8_t cef_string_t;
 typedef cef_string_userfree_utf8_t cef_string_userfree_t;
 #define cef_string_set cef_string_utf8_set
 #define cef_string_copy cef_string_utf8_copy
+#define cef_string_share cef_string_utf8_share
 #define cef_string_clear cef_string_utf8_clear
 #define cef_string_userfree_alloc cef_string_userfree_utf8_alloc
 #define cef_string_userfree_free cef_string_userfree_utf8_free
@@ -80,6 +81,7 @@ typedef cef_string_userfree_utf16_t cef_string_userfree_t;
 typedef cef_string_utf16_t cef_string_t;
 #define cef_string_set cef_string_utf16_set
 #define cef_string_copy cef_string_utf16_copy
+#define cef_string_share cef_string_utf16_share
 #define cef_string_clear cef_string_utf16_clear
 #define cef_string_userfree_alloc cef_string_userfree_utf16_alloc
 #define cef_string_userfree_free cef_string_userfree_utf16_free
@@ -96,6 +98,7 @@ typedef cef_string_wide_t cef_string_t;
 typedef cef_string_userfree_wide_t cef_string_userfree_t;
 #define cef_string_set cef_string_wide_set
 #define cef_string_copy cef_string_wide_copy
+#define cef_string_share cef_string_wide_share
 #define cef_string_clear cef_string_wide_clear
 #define cef_string_userfree_alloc cef_string_userfree_wide_alloc
 #define cef_string_userfree_free cef_string_userfree_wide_free
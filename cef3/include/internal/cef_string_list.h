@@ -81,6 +81,16 @@ CEF_EXPORT void cef_string_list_free(cef_string_list_t list);
 ///
 CEF_EXPORT cef_string_list_t cef_string_list_copy(cef_string_list_t list);
 
+///
+// Callback used to deliver a collection of strings as one contiguous block of
+// borrowed string values. |keys| contains |count| values. For lists |values|
+// will be NULL. For maps and multimaps |values| contains the |count| values
+// associated with |keys|. The strings are only valid for the duration of the
+// call and must be copied if they will be retained.
+///
+typedef void (CEF_CALLBACK *cef_string_block_visitor_t)(void* context,
+    size_t count, const cef_string_t* keys, const cef_string_t* values);
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,7 +39,8 @@ extern "C" {
 #endif
 
 ///
-// CEF string maps are a set of key/value string pairs.
+// CEF string maps are a set of key/value string pairs. Keys are unique and
+// pairs are kept in insertion order.
 ///
 typedef void* cef_string_map_t;
 
@@ -48,6 +49,11 @@ typedef void* cef_string_map_t;
 ///
 CEF_EXPORT cef_string_map_t cef_string_map_alloc();
 
+///
+// Allocate a new string map that compares keys without regard to ASCII case.
+///
+CEF_EXPORT cef_string_map_t cef_string_map_alloc_case_insensitive();
+
 ///
 // Return the number of elements in the string map.
 ///
@@ -40,7 +40,8 @@ extern "C" {
 
 ///
 // CEF string multimaps are a set of key/value string pairs.
-// More than one value can be assigned to a single key.
+// More than one value can be assigned to a single key. Pairs are kept in
+// insertion order.
 ///
 typedef void* cef_string_multimap_t;
 
@@ -49,6 +50,12 @@ typedef void* cef_string_multimap_t;
 ///
 CEF_EXPORT cef_string_multimap_t cef_string_multimap_alloc();
 
+///
+// Allocate a new string multimap that compares keys without regard to ASCII
+// case, as is appropriate for HTTP header names.
+///
+CEF_EXPORT cef_string_multimap_t cef_string_multimap_alloc_case_insensitive();
+
 ///
 // Return the number of elements in the string multimap.
 ///
@@ -61,7 +68,7 @@ CEF_EXPORT int cef_string_multimap_find_count(cef_string_multimap_t map,
                                               const cef_string_t* key);
 
 ///
-// Return the value_index-th value with the specified key.
+// Return the value_index-th value with the specified key in insertion order.
 ///
 CEF_EXPORT int cef_string_multimap_enumerate(cef_string_multimap_t map,
                                              const cef_string_t* key,
@@ -109,6 +109,21 @@ CEF_EXPORT int cef_string_utf16_set(const char16* src, size_t src_len,
     cef_string_utf16_set(src, src_len, output, true)
 
 
+///
+// These functions assign the value of |src| to |output|. String data copied by
+// the above functions is immutable and reference counted, in which case
+// |output| will share the existing data instead of copying it. Other data will
+// be copied.
+///
+
+CEF_EXPORT int cef_string_wide_share(const cef_string_wide_t* src,
+                                     cef_string_wide_t* output);
+CEF_EXPORT int cef_string_utf8_share(const cef_string_utf8_t* src,
+                                     cef_string_utf8_t* output);
+CEF_EXPORT int cef_string_utf16_share(const cef_string_utf16_t* src,
+                                      cef_string_utf16_t* output);
+
+
 ///
 // These functions clear string values. The structure itself is not freed.
 ///
@@ -31,6 +31,7 @@
 #define CEF_INCLUDE_INTERNAL_CEF_STRING_WRAPPERS_H_
 #pragma once
 
+#include <assert.h>
 #include <memory.h>
 #include <string>
 #include "include/internal/cef_string_types.h"
@@ -53,6 +54,9 @@ struct CefStringTraitsWide {
                         struct_type* output, int copy) {
     return cef_string_wide_set(src, src_size, output, copy);
   }
+  static inline int share(const struct_type* src, struct_type* output) {
+    return cef_string_wide_share(src, output);
+  }
   static inline int compare(const struct_type* s1, const struct_type* s2) {
     return cef_string_wide_cmp(s1, s2);
   }
@@ -128,6 +132,9 @@ struct CefStringTraitsUTF8 {
                         struct_type* output, int copy) {
     return cef_string_utf8_set(src, src_size, output, copy);
   }
+  static inline int share(const struct_type* src, struct_type* output) {
+    return cef_string_utf8_share(src, output);
+  }
   static inline int compare(const struct_type* s1, const struct_type* s2) {
     return cef_string_utf8_cmp(s1, s2);
   }
@@ -192,6 +199,9 @@ struct CefStringTraitsUTF16 {
                         struct_type* output, int copy) {
     return cef_string_utf16_set(src, src_size, output, copy);
   }
+  static inline int share(const struct_type* src, struct_type* output) {
+    return cef_string_utf16_share(src, output);
+  }
   static inline int compare(const struct_type* s1, const struct_type* s2) {
     return cef_string_utf16_cmp(s1, s2);
   }
@@ -279,6 +289,11 @@ struct CefStringTraitsUTF16 {
 // Assigning a std::string to a CefStringUTF8, for example, will copy the data
 // without performing a conversion.
 // </p>
+// Copying one CEF string class to another of the same type will share the
+// existing data instead of copying it when the data was allocated by CEF. The
+// string structure itself is stored inside the class so a copy does not
+// require any memory allocation in that case.
+// </p>
 // CEF string classes are safe for reading from multiple threads but not for
 // modification. It is the user's responsibility to provide synchronization if
 // modifying CEF strings from multiple threads.
@@ -296,11 +311,12 @@ class CefStringBase {
   CefStringBase() : string_(NULL), owner_(false) {}
 
   ///
-  // Create a new string from an existing string. Data will always be copied.
+  // Create a new string from an existing string. Data will be shared if it was
+  // allocated by CEF and copied otherwise.
   ///
   CefStringBase(const CefStringBase& str)
     : string_(NULL), owner_(false) {
-    FromString(str.c_str(), str.length(), true);
+    ShareFrom(str);
   }
 
   ///
@@ -426,9 +442,18 @@ class CefStringBase {
   // Swap this string's contents with the specified string.
   ///
   void swap(CefStringBase& str) {
-    struct_type* tmp_string = string_;
+    // Structures stored inside the class must be moved to the other class.
+    const bool internal = (string_ == &storage_);
+    const bool str_internal = (str.string_ == &str.storage_);
+    struct_type tmp_storage = storage_;
+    if (str_internal)
+      storage_ = str.storage_;
+    if (internal)
+      str.storage_ = tmp_storage;
+
+    struct_type* tmp_string = internal ? &str.storage_ : string_;
     bool tmp_owner = owner_;
-    string_ = str.string_;
+    string_ = str_internal ? &storage_ : str.string_;
     owner_ = str.owner_;
     str.string_ = tmp_string;
     str.owner_ = tmp_owner;
@@ -466,7 +491,8 @@ class CefStringBase {
       return;
     if (owner_) {
       clear();
-      delete string_;
+      if (string_ != &storage_)
+        delete string_;
     }
     string_ = NULL;
     owner_ = false;
@@ -508,9 +534,13 @@ class CefStringBase {
   ///
   // Detach from the underlying string structure. To avoid memory leaks only use
   // this method if you already hold a pointer to the underlying string
-  // structure.
+  // structure that was passed to Attach(). A structure allocated by this class
+  // is stored inside the class and cannot outlive it, so this method must not
+  // be called after GetWritableStruct() or the string setters allocated one;
+  // use DetachToUserFree() to transfer that data instead.
   ///
   void Detach() {
+    assert(string_ != &storage_);
     string_ = NULL;
     owner_ = false;
   }
@@ -663,7 +693,7 @@ class CefStringBase {
   // Assignment operator overloads.
   ///
   CefStringBase& operator=(const CefStringBase& str) {
-    FromString(str.c_str(), str.length(), true);
+    ShareFrom(str);
     return *this;
   }
   operator std::string() const {
@@ -703,17 +733,30 @@ class CefStringBase {
 #endif  // BUILDING_CEF_SHARED && WCHAR_T_IS_UTF32
 
  private:
-  // Allocate the string structure if it doesn't already exist.
+  // Use the internal string structure if no structure currently exists.
   void AllocIfNeeded() {
     if (string_ == NULL) {
-      string_ = new struct_type;
+      string_ = &storage_;
       memset(string_, 0, sizeof(struct_type));
       owner_ = true;
     }
   }
 
+  // Set this string's data from |str|, sharing the data if possible.
+  void ShareFrom(const CefStringBase& str) {
+    if (&str == this)
+      return;
+    if (str.empty()) {
+      clear();
+      return;
+    }
+    AllocIfNeeded();
+    traits::share(str.string_, string_);
+  }
+
   struct_type* string_;
   bool owner_;
+  struct_type storage_;
 };
 
 
@@ -0,0 +1,82 @@
+// Copyright (c) 2012 Marshall A. Greenblatt. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//    * Neither the name of Google Inc. nor the name Chromium Embedded
+// Framework nor the names of its contributors may be used to endorse
+// or promote products derived from this software without specific prior
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef CEF_INCLUDE_INTERNAL_CEF_TASK_FUNCTION_H_
+#define CEF_INCLUDE_INTERNAL_CEF_TASK_FUNCTION_H_
+#pragma once
+
+#include "include/internal/cef_export.h"
+#include "include/internal/cef_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+///
+// Function that will be executed for a task posted using
+// cef_post_task_function() or cef_post_delayed_task_function(), or to release
+// the context of such a task. |context| is the value that was passed when the
+// task was posted.
+///
+typedef void (CEF_CALLBACK *cef_task_function_t)(void* context);
+
+///
+// Post |function| for execution on the specified thread with |context| as the
+// argument. Unlike cef_post_task() no task object is allocated or reference
+// counted. If |release| is non-NULL it will be called with |context| when the
+// task is destroyed without |function| having executed, for example because
+// the target thread is shutting down or the task could not be posted. Exactly
+// one of |function| or |release| is called, so |release| can be used to free
+// |context|. |release| may be called on any thread. If |release| is NULL the
+// caller is responsible for keeping |context| valid until |function| has
+// executed. Returns true (1) if the task was posted. This function may be
+// called on any thread. It is an error to request a thread from the wrong
+// process.
+///
+CEF_EXPORT int cef_post_task_function(enum cef_thread_id_t threadId,
+                                      cef_task_function_t function,
+                                      cef_task_function_t release,
+                                      void* context);
+
+///
+// Post |function| for delayed execution on the specified thread with |context|
+// as the argument. See cef_post_task_function() for details.
+///
+CEF_EXPORT int cef_post_delayed_task_function(enum cef_thread_id_t threadId,
+                                              cef_task_function_t function,
+                                              cef_task_function_t release,
+                                              void* context,
+                                              int64 delay_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // CEF_INCLUDE_INTERNAL_CEF_TASK_FUNCTION_H_
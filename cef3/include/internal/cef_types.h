@@ -155,7 +155,12 @@ typedef struct _cef_settings_t {
   ///
   // Set to true (1) to have the browser process message loop run in a separate
   // thread. If false (0) than the CefDoMessageLoopWork() function must be
-  // called from your application message loop.
+  // called from your application message loop. This option is supported on
+  // Windows and Linux. On Linux the separate thread initializes GTK and
+  // iterates the default GLib main context so the application must not call
+  // GTK functions or run the default GLib main context on other threads. If
+  // the application makes Xlib calls before calling CefInitialize() it must
+  // call XInitThreads() first.
   ///
   bool multi_threaded_message_loop;
 
@@ -252,6 +257,72 @@ typedef struct _cef_settings_t {
   // Chrome browser window.
   ///
   int remote_debugging_port;
+
+  ///
+  // The interval in milliseconds at which changes to the on-disk cookie
+  // database will be committed. Changes to the same cookie within the interval
+  // are coalesced into a single write. If this value,
+  // |cookie_commit_batch_size| and |cookie_deferred_commit| are all unset the
+  // default commit behavior of the cookie database will be used. This value
+  // can be overridden for individual cookie managers using
+  // CefCookieManager::SetCommitPolicy().
+  ///
+  int cookie_commit_interval;
+
+  ///
+  // The number of pending cookie changes that will trigger an immediate commit
+  // to the on-disk cookie database. If 0 a default of 512 changes will be used.
+  // This value is ignored if |cookie_deferred_commit| is true (1).
+  ///
+  int cookie_commit_batch_size;
+
+  ///
+  // Set to true (1) to defer commits to the on-disk cookie database until
+  // |cookie_commit_interval| milliseconds (5 minutes by default) have elapsed
+  // since the first pending change or CefCookieManager::FlushStore() is
+  // called. The number of pending changes will not trigger a commit. Pending
+  // changes are written as individual cookie updates, not as a consistent
+  // point-in-time copy of the cookie jar, and changes that have not been
+  // committed are lost if the application exits without a clean shutdown.
+  ///
+  bool cookie_deferred_commit;
+
+  ///
+  // The number of spare render processes to keep running in the background.
+  // New browsers claim an already initialized spare process instead of
+  // launching a new one and the pool is refilled after each claim. Spare
+  // processes consume memory while idle. This value is ignored when
+  // |single_process| is true (1). Defaults to 0.
+  ///
+  int spare_render_process_count;
+
+  ///
+  // The maximum number of render processes. When the limit is reached new
+  // browsers and cross-site navigations share existing render processes
+  // instead of launching new ones. Browsers with different
+  // CefBrowserSettings.renderer_process_group values never share a render
+  // process so the limit may be exceeded to keep groups isolated. Also
+  // configurable using the "renderer-process-limit" command-line switch.
+  // Specify 0 to use the default limit which is based on system memory.
+  ///
+  int renderer_process_limit;
+
+  ///
+  // Set to true (1) to use a single render process for all pages from the
+  // same site, even when they are loaded in different browsers. This reduces
+  // the number of render processes when many browsers show the same site.
+  // Also configurable using the "process-per-site" command-line switch.
+  ///
+  bool process_per_site;
+
+  ///
+  // Set to true (1) if all browsers will be created with window rendering
+  // disabled (see CefWindowInfo::SetAsOffScreen). The browser process will then
+  // skip native UI toolkit initialization so that on Linux it can run without
+  // an X server. Creating a browser with a native window fails when this
+  // value is true (1).
+  ///
+  bool windowless_rendering_only;
 } cef_settings_t;
 
 ///
@@ -265,6 +336,15 @@ typedef struct _cef_browser_settings_t {
   ///
   size_t size;
 
+  ///
+  // Key used to group render processes. Browsers with the same non-empty key
+  // prefer to share a render process with each other and never share a render
+  // process with browsers that use a different key, including browsers that
+  // leave the key empty. A crash in a grouped render process only affects
+  // browsers with the same key.
+  ///
+  cef_string_t renderer_process_group;
+
   // The below values map to WebPreferences settings.
 
   ///
@@ -888,6 +968,26 @@ enum cef_thread_id_t {
   // The main thread in the renderer. Used for all WebKit and V8 interaction.
   ///
   TID_RENDERER,
+
+// WORKER THREADS -- Available in all processes.
+
+  ///
+  // Pool of worker threads sized to the number of processors. Use this value
+  // for CPU-intensive work instead of using the named threads above. Tasks
+  // posted to the pool may execute on any worker thread and in parallel with
+  // each other.
+  ///
+  TID_WORKER,
+};
+
+///
+// Priority of tasks posted to the TID_WORKER pool. Idle worker threads always
+// execute pending tasks with a higher priority first.
+///
+enum cef_worker_priority_t {
+  WORKER_PRIORITY_HIGH = 0,
+  WORKER_PRIORITY_NORMAL,
+  WORKER_PRIORITY_LOW,
 };
 
 ///
@@ -1147,6 +1247,36 @@ typedef struct _cef_key_event_t {
   bool focus_on_editable_field;
 } cef_key_event_t;
 
+///
+// Mouse button types.
+///
+enum cef_mouse_button_type_t {
+  MBT_LEFT   = 0,
+  MBT_MIDDLE,
+  MBT_RIGHT,
+};
+
+///
+// Structure representing mouse event information.
+///
+typedef struct _cef_mouse_event_t {
+  ///
+  // X coordinate relative to the left side of the view.
+  ///
+  int x;
+
+  ///
+  // Y coordinate relative to the top side of the view.
+  ///
+  int y;
+
+  ///
+  // Bit flags describing any pressed modifier keys. See
+  // cef_event_flags_t for values.
+  ///
+  uint32 modifiers;
+} cef_mouse_event_t;
+
 ///
 // Focus sources.
 ///
@@ -1321,6 +1451,26 @@ enum cef_file_dialog_mode_t {
   FILE_DIALOG_SAVE,
 };
 
+///
+// Memory pressure levels.
+///
+enum cef_memory_pressure_level_t {
+  ///
+  // Release memory that can be recreated cheaply. Unused resources are evicted
+  // from the WebKit memory cache and the V8 heap is given an idle
+  // notification.
+  ///
+  MEMORY_PRESSURE_LEVEL_MODERATE = 0,
+
+  ///
+  // Release as much memory as possible. In addition to the moderate actions
+  // the font and glyph caches and the cross-origin preflight cache are cleared,
+  // V8 performs a full garbage collection and the allocator returns free pages
+  // to the system. Pages will be slower until the caches are repopulated.
+  ///
+  MEMORY_PRESSURE_LEVEL_CRITICAL,
+};
+
 ///
 // Geoposition error codes.
 ///
@@ -1389,6 +1539,52 @@ typedef struct _cef_geoposition_t {
   cef_string_t error_message;
 } cef_geoposition_t;
 
+///
+// Structure representing the resources used by a browser. CPU and memory
+// values are measured by the browser process for the render process that hosts
+// the browser and are shared by all browsers in that process. In single-process
+// mode they describe the browser process. Network values are counted for the
+// browser alone.
+///
+typedef struct _cef_resource_usage_t {
+  ///
+  // Total CPU time in microseconds used by the render process, including both
+  // user and kernel time.
+  ///
+  int64 cpu_time_us;
+
+  ///
+  // Private memory in bytes used by the render process. This is memory that
+  // cannot be shared with other processes.
+  ///
+  int64 private_memory_bytes;
+
+  ///
+  // Size in bytes of the live objects and of the total allocated space in the
+  // V8 heap of the render process.
+  ///
+  int64 v8_heap_used_bytes;
+  int64 v8_heap_total_bytes;
+
+  ///
+  // Number of bytes received over the network on behalf of the browser since
+  // it was created. Bytes are counted before any content decoding. Responses
+  // served from the HTTP cache or provided in-process by a CefResourceHandler
+  // or scheme handler are not counted.
+  ///
+  int64 network_bytes_received;
+
+  ///
+  // Number of bytes sent over the network on behalf of the browser since it
+  // was created. This includes the request headers, excluding the request
+  // line, and in-memory upload data of HTTP requests that received a response
+  // over the network. File uploads are not counted. Requests answered from the
+  // HTTP cache or handled in-process by a CefResourceHandler or scheme handler
+  // are not counted.
+  ///
+  int64 network_bytes_sent;
+} cef_resource_usage_t;
+
 #ifdef __cplusplus
 }
 #endif
@@ -64,6 +64,10 @@ typedef struct _cef_window_info_t {
 
   // Pointer for the new browser widget.
   cef_window_handle_t widget;
+
+  // Set to true to disable window rendering. No widget will be created for the
+  // browser and all rendering will occur via the CefRenderHandler interface.
+  int window_rendering_disabled;
 } cef_window_info_t;
 
 #ifdef __cplusplus
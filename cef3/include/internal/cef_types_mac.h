@@ -85,6 +85,10 @@ typedef struct _cef_window_info_t {
 
   // NSView pointer for the new browser view.
   cef_window_handle_t view;
+
+  // Set to true to disable window rendering. No view will be created for the
+  // browser and all rendering will occur via the CefRenderHandler interface.
+  int window_rendering_disabled;
 } cef_window_info_t;
 
 #ifdef __cplusplus
@@ -74,6 +74,10 @@ typedef struct _cef_window_info_t {
 
   // Handle for the new browser window.
   cef_window_handle_t window;
+
+  // Set to true to disable window rendering. No window will be created for the
+  // browser and all rendering will occur via the CefRenderHandler interface.
+  BOOL window_rendering_disabled;
 } cef_window_info_t;
 
 #ifdef __cplusplus
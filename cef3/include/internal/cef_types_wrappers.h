@@ -199,6 +199,26 @@ struct CefKeyEventTraits {
 ///
 typedef CefStructBase<CefKeyEventTraits> CefKeyEvent;
 
+struct CefMouseEventTraits {
+  typedef cef_mouse_event_t struct_type;
+
+  static inline void init(struct_type* s) {}
+
+  static inline void clear(struct_type* s) {}
+
+  static inline void set(const struct_type* src, struct_type* target,
+      bool copy) {
+    target->x = src->x;
+    target->y = src->y;
+    target->modifiers = src->modifiers;
+  }
+};
+
+///
+// Class representing a mouse event.
+///
+typedef CefStructBase<CefMouseEventTraits> CefMouseEvent;
+
 
 struct CefPopupFeaturesTraits {
   typedef cef_popup_features_t struct_type;
@@ -300,6 +320,13 @@ struct CefSettingsTraits {
         &target->locales_dir_path, copy);
     target->pack_loading_disabled = src->pack_loading_disabled;
     target->remote_debugging_port = src->remote_debugging_port;
+    target->cookie_commit_interval = src->cookie_commit_interval;
+    target->cookie_commit_batch_size = src->cookie_commit_batch_size;
+    target->cookie_deferred_commit = src->cookie_deferred_commit;
+    target->spare_render_process_count = src->spare_render_process_count;
+    target->renderer_process_limit = src->renderer_process_limit;
+    target->process_per_site = src->process_per_site;
+    target->windowless_rendering_only = src->windowless_rendering_only;
   }
 };
 
@@ -317,6 +344,7 @@ struct CefBrowserSettingsTraits {
   }
 
   static inline void clear(struct_type* s) {
+    cef_string_clear(&s->renderer_process_group);
     cef_string_clear(&s->standard_font_family);
     cef_string_clear(&s->fixed_font_family);
     cef_string_clear(&s->serif_font_family);
@@ -329,6 +357,10 @@ struct CefBrowserSettingsTraits {
 
   static inline void set(const struct_type* src, struct_type* target,
       bool copy) {
+    cef_string_set(src->renderer_process_group.str,
+        src->renderer_process_group.length, &target->renderer_process_group,
+        copy);
+
     cef_string_set(src->standard_font_family.str,
         src->standard_font_family.length, &target->standard_font_family, copy);
     cef_string_set(src->fixed_font_family.str, src->fixed_font_family.length,
@@ -619,4 +651,28 @@ struct CefGeopositionTraits {
 ///
 typedef CefStructBase<CefGeopositionTraits> CefGeoposition;
 
+
+struct CefResourceUsageTraits {
+  typedef cef_resource_usage_t struct_type;
+
+  static inline void init(struct_type* s) {}
+
+  static inline void clear(struct_type* s) {}
+
+  static inline void set(const struct_type* src, struct_type* target,
+      bool copy) {
+    target->cpu_time_us = src->cpu_time_us;
+    target->private_memory_bytes = src->private_memory_bytes;
+    target->v8_heap_used_bytes = src->v8_heap_used_bytes;
+    target->v8_heap_total_bytes = src->v8_heap_total_bytes;
+    target->network_bytes_received = src->network_bytes_received;
+    target->network_bytes_sent = src->network_bytes_sent;
+  }
+};
+
+///
+// Class representing the resources used by a browser.
+///
+typedef CefStructBase<CefResourceUsageTraits> CefResourceUsage;
+
 #endif  // CEF_INCLUDE_INTERNAL_CEF_TYPES_WRAPPERS_H_
@@ -120,6 +120,7 @@ struct CefWindowInfoTraits {
     target->menu = src->menu;
     target->window = src->window;
     target->transparent_painting = src->transparent_painting;
+    target->window_rendering_disabled = src->window_rendering_disabled;
   }
 };
 
@@ -156,6 +157,11 @@ class CefWindowInfo : public CefStructBase<CefWindowInfoTraits> {
     cef_string_copy(windowName.c_str(), windowName.length(), &window_name);
   }
 
+  void SetAsOffScreen(HWND hWndParent) {
+    window_rendering_disabled = TRUE;
+    parent_window = hWndParent;
+  }
+
   void SetTransparentPainting(BOOL transparentPainting) {
     transparent_painting = transparentPainting;
   }
@@ -0,0 +1,136 @@
+// Copyright (c) 2012 Marshall A. Greenblatt. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//    * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//    * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//    * Neither the name of Google Inc. nor the name Chromium Embedded
+// Framework nor the names of its contributors may be used to endorse
+// or promote products derived from this software without specific prior
+// written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// ---------------------------------------------------------------------------
+//
+// The contents of this file are only available to applications that link
+// against the libcef_dll_wrapper target.
+//
+
+#ifndef CEF_INCLUDE_WRAPPER_CEF_ASSET_RESOURCE_HANDLER_H_
+#define CEF_INCLUDE_WRAPPER_CEF_ASSET_RESOURCE_HANDLER_H_
+#pragma once
+
+#include <ctime>
+#include <map>
+
+#include "include/cef_base.h"
+#include "include/cef_resource_handler.h"
+#include "include/wrapper/cef_zip_archive.h"
+
+///
+// Thread-safe table of in-memory assets that can be served to custom scheme
+// requests. Each asset may optionally have a gzip-compressed representation
+// that will be returned as-is to clients that accept gzip encoding. Handlers
+// created by this class support the following HTTP features:
+// (1) Strong ETag and Last-Modified validators. Each representation has a
+//     different ETag. Conditional requests using If-None-Match or
+//     If-Modified-Since will receive a 304 response when the asset is
+//     unchanged. If-Modified-Since values are compared exactly with the
+//     Last-Modified value.
+// (2) Single byte range requests. Range requests are always served from the
+//     uncompressed representation. Requests for multiple ranges receive the
+//     complete asset.
+// (3) Content-Encoding negotiation using the Accept-Encoding request header.
+//     All responses for assets with a gzip representation include a
+//     "Vary: Accept-Encoding" header.
+///
+class CefAssetTable : public CefBase {
+ public:
+  ///
+  // Create a new object.
+  ///
+  CefAssetTable();
+  virtual ~CefAssetTable();
+
+  ///
+  // Add an asset that will be returned for |path|. |data| will be copied. If
+  // |gzip_data| is non-NULL it must contain the gzip-compressed representation
+  // of |data| and will also be copied. If |last_modified| is 0 the current
+  // time will be used. Any existing asset with the same path will be replaced.
+  ///
+  void AddAsset(const CefString& path,
+                const CefString& mime_type,
+                const void* data,
+                size_t data_size,
+                const void* gzip_data,
+                size_t gzip_data_size,
+                time_t last_modified);
+
+  ///
+  // Add all files from |archive| using the file name prefixed with
+  // |path_prefix| as the path. File data will be shared with the archive
+  // instead of being copied. A file with a ".gz" extension will be added as
+  // the gzip-compressed representation of the file with the same name minus
+  // the extension if that file also exists in the archive. The mime type will
+  // be determined from the file extension. Returns the number of assets added.
+  ///
+  size_t AddArchive(CefRefPtr<CefZipArchive> archive,
+                    const CefString& path_prefix,
+                    time_t last_modified);
+
+  ///
+  // Returns true if an asset exists for |path|.
+  ///
+  bool HasAsset(const CefString& path);
+
+  ///
+  // Removes the asset for |path|. Handlers that have already been created for
+  // the asset will continue to work.
+  ///
+  bool RemoveAsset(const CefString& path);
+
+  ///
+  // Clears the contents of this object.
+  ///
+  void Clear();
+
+  ///
+  // Returns the number of assets.
+  ///
+  size_t GetAssetCount();
+
+  ///
+  // Returns a new handler that will serve the asset for |path| or NULL if no
+  // such asset exists. This method may be called from
+  // CefSchemeHandlerFactory::Create().
+  ///
+  CefRefPtr<CefResourceHandler> CreateHandler(const CefString& path);
+
+  class Asset;
+
+ private:
+  typedef std::map<CefString, CefRefPtr<Asset> > AssetMap;
+  AssetMap assets_;
+
+  IMPLEMENT_REFCOUNTING(CefAssetTable);
+  IMPLEMENT_LOCKING(CefAssetTable);
+};
+
+#endif  // CEF_INCLUDE_WRAPPER_CEF_ASSET_RESOURCE_HANDLER_H_
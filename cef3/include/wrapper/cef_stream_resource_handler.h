@@ -45,6 +45,8 @@ class CefStreamReader;
 
 ///
 // Implementation of the CefResourceHandler class for reading from a CefStream.
+// If the stream supports seeking the response length will be reported and
+// byte range requests will be satisfied by seeking the stream.
 ///
 class CefStreamResourceHandler : public CefResourceHandler {
  public:
@@ -67,6 +69,8 @@ class CefStreamResourceHandler : public CefResourceHandler {
   virtual void GetResponseHeaders(CefRefPtr<CefResponse> response,
                                   int64& response_length,
                                   CefString& redirectUrl) OVERRIDE;
+  virtual bool SkipResponse(int64 bytes_to_skip,
+                            int64& bytes_skipped) OVERRIDE;
   virtual bool ReadResponse(void* data_out,
                             int bytes_to_read,
                             int& bytes_read,
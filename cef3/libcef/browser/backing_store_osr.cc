@@ -0,0 +1,95 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors.
+// Portions copyright (c) 2012 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "libcef/browser/backing_store_osr.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "content/public/browser/render_process_host.h"
+#include "skia/ext/platform_canvas.h"
+#include "third_party/skia/include/core/SkCanvas.h"
+#include "ui/gfx/rect.h"
+#include "ui/surface/transport_dib.h"
+
+CefBackingStoreOSR::CefBackingStoreOSR(content::RenderWidgetHost* widget,
+                                       const gfx::Size& size)
+    : content::BackingStore(widget, size) {
+  bitmap_.setConfig(SkBitmap::kARGB_8888_Config, size.width(), size.height());
+  bitmap_.allocPixels();
+  bitmap_.eraseARGB(0, 0, 0, 0);
+  canvas_.reset(new SkCanvas(bitmap_));
+}
+
+CefBackingStoreOSR::~CefBackingStoreOSR() {
+}
+
+void CefBackingStoreOSR::PaintToBackingStore(
+    content::RenderProcessHost* process,
+    TransportDIB::Id bitmap,
+    const gfx::Rect& bitmap_rect,
+    const std::vector<gfx::Rect>& copy_rects,
+    float scale_factor,
+    const base::Closure& completion_callback,
+    bool* scheduled_completion_callback) {
+  *scheduled_completion_callback = false;
+  if (bitmap_rect.IsEmpty())
+    return;
+
+  // The shared memory is only read here so the renderer may reuse it as soon
+  // as this method returns.
+  TransportDIB* dib = process->GetTransportDIB(bitmap);
+  if (!dib)
+    return;
+
+  SkBitmap dib_bitmap;
+  dib_bitmap.setConfig(SkBitmap::kARGB_8888_Config, bitmap_rect.width(),
+                       bitmap_rect.height());
+  dib_bitmap.setPixels(dib->memory());
+
+  for (size_t i = 0; i < copy_rects.size(); ++i) {
+    const gfx::Rect& copy_rect = copy_rects[i];
+    SkIRect src_rect = SkIRect::MakeXYWH(copy_rect.x() - bitmap_rect.x(),
+                                         copy_rect.y() - bitmap_rect.y(),
+                                         copy_rect.width(),
+                                         copy_rect.height());
+    SkRect dst_rect = SkRect::MakeXYWH(SkIntToScalar(copy_rect.x()),
+                                       SkIntToScalar(copy_rect.y()),
+                                       SkIntToScalar(copy_rect.width()),
+                                       SkIntToScalar(copy_rect.height()));
+    canvas_->drawBitmapRect(dib_bitmap, &src_rect, dst_rect);
+  }
+}
+
+bool CefBackingStoreOSR::CopyFromBackingStore(const gfx::Rect& rect,
+                                              skia::PlatformCanvas* output) {
+  const int width = std::min(size().width(), rect.width());
+  const int height = std::min(size().height(), rect.height());
+  if (width <= 0 || height <= 0 || !output->initialize(width, height, true))
+    return false;
+
+  SkBitmap subset;
+  SkIRect src_rect = SkIRect::MakeXYWH(rect.x(), rect.y(), width, height);
+  if (!bitmap_.extractSubset(&subset, src_rect))
+    return false;
+
+  output->drawBitmap(subset, 0, 0);
+  return true;
+}
+
+void CefBackingStoreOSR::ScrollBackingStore(int dx, int dy,
+                                            const gfx::Rect& clip_rect,
+                                            const gfx::Size& view_size) {
+  int x = std::min(clip_rect.x(), clip_rect.x() - dx);
+  int y = std::min(clip_rect.y(), clip_rect.y() - dy);
+  int w = clip_rect.width() + abs(dx);
+  int h = clip_rect.height() + abs(dy);
+  SkIRect rect = SkIRect::MakeXYWH(x, y, w, h);
+  bitmap_.scrollRect(&rect, dx, dy);
+}
+
+const void* CefBackingStoreOSR::GetPixels() const {
+  return bitmap_.getPixels();
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors.
+// Portions copyright (c) 2012 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_BACKING_STORE_OSR_H_
+#define CEF_LIBCEF_BROWSER_BACKING_STORE_OSR_H_
+#pragma once
+
+#include <vector>
+
+#include "base/compiler_specific.h"
+#include "base/memory/scoped_ptr.h"
+#include "content/browser/renderer_host/backing_store.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+
+class SkCanvas;
+
+// Backing store used when window rendering is disabled. The contents painted
+// by the renderer into shared memory are copied into a single BGRA bitmap that
+// is passed to CefRenderHandler::OnPaint.
+class CefBackingStoreOSR : public content::BackingStore {
+ public:
+  CefBackingStoreOSR(content::RenderWidgetHost* widget, const gfx::Size& size);
+  virtual ~CefBackingStoreOSR();
+
+  static CefBackingStoreOSR* From(content::BackingStore* backing_store) {
+    return static_cast<CefBackingStoreOSR*>(backing_store);
+  }
+
+  // BackingStore methods.
+  virtual void PaintToBackingStore(
+      content::RenderProcessHost* process,
+      TransportDIB::Id bitmap,
+      const gfx::Rect& bitmap_rect,
+      const std::vector<gfx::Rect>& copy_rects,
+      float scale_factor,
+      const base::Closure& completion_callback,
+      bool* scheduled_completion_callback) OVERRIDE;
+  virtual bool CopyFromBackingStore(const gfx::Rect& rect,
+                                    skia::PlatformCanvas* output) OVERRIDE;
+  virtual void ScrollBackingStore(int dx, int dy,
+                                  const gfx::Rect& clip_rect,
+                                  const gfx::Size& view_size) OVERRIDE;
+
+  // Returns the pixel data for the whole backing store.
+  const void* GetPixels() const;
+
+ private:
+  SkBitmap bitmap_;
+  scoped_ptr<SkCanvas> canvas_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefBackingStoreOSR);
+};
+
+#endif  // CEF_LIBCEF_BROWSER_BACKING_STORE_OSR_H_
@@ -172,7 +172,8 @@ class CefSpeechRecognitionPreferences
 
 }  // namespace
 
-CefBrowserContext::CefBrowserContext() {
+CefBrowserContext::CefBrowserContext()
+    : use_osr_next_contents_view_(false) {
   // Initialize the request context getter.
   url_request_getter_ = new CefURLRequestContextGetter(
       false,
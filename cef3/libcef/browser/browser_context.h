@@ -47,6 +47,15 @@ class CefBrowserContext : public content::BrowserContext {
       GetSpeechRecognitionPreferences() OVERRIDE;
   virtual quota::SpecialStoragePolicy* GetSpecialStoragePolicy() OVERRIDE;
 
+  // When true the next WebContents created for this context will use an
+  // off-screen view. Only accessed on the UI thread.
+  bool use_osr_next_contents_view() const {
+    return use_osr_next_contents_view_;
+  }
+  void set_use_osr_next_contents_view(bool value) {
+    use_osr_next_contents_view_ = value;
+  }
+
  private:
 
   scoped_ptr<CefResourceContext> resource_context_;
@@ -57,6 +66,8 @@ class CefBrowserContext : public content::BrowserContext {
   scoped_refptr<content::SpeechRecognitionPreferences>
       speech_recognition_preferences_;
 
+  bool use_osr_next_contents_view_;
+
   DISALLOW_COPY_AND_ASSIGN(CefBrowserContext);
 };
 
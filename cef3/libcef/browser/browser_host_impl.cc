@@ -12,7 +12,12 @@
 #include "libcef/browser/chrome_scheme_handler.h"
 #include "libcef/browser/context.h"
 #include "libcef/browser/devtools_delegate.h"
+#include "libcef/browser/memory_pressure.h"
 #include "libcef/browser/navigate_params.h"
+#include "libcef/browser/render_process_groups.h"
+#include "libcef/browser/render_process_pool.h"
+#include "libcef/browser/render_widget_host_view_osr.h"
+#include "libcef/browser/resource_usage.h"
 #include "libcef/browser/scheme_registration.h"
 #include "libcef/browser/thread_util.h"
 #include "libcef/browser/url_request_context_getter.h"
@@ -27,13 +32,16 @@
 #include "base/bind_helpers.h"
 #include "content/browser/renderer_host/render_view_host_impl.h"
 #include "content/browser/web_contents/web_contents_impl.h"
+#include "content/common/view_messages.h"
 #include "content/public/browser/native_web_keyboard_event.h"
 #include "content/public/browser/navigation_controller.h"
 #include "content/public/browser/navigation_entry.h"
 #include "content/public/browser/notification_details.h"
 #include "content/public/browser/notification_source.h"
 #include "content/public/browser/notification_types.h"
+#include "content/public/browser/render_process_host.h"
 #include "content/public/browser/resource_request_info.h"
+#include "content/public/browser/site_instance.h"
 #include "content/public/common/file_chooser_params.h"
 #include "ui/base/dialogs/selected_file_info.h"
 
@@ -56,6 +64,22 @@ class CreateBrowserHelper {
   CefBrowserSettings settings_;
 };
 
+// Returns the render process group specified in |settings|.
+std::string GetRenderProcessGroup(const CefBrowserSettings& settings) {
+  return CefString(&settings.renderer_process_group).ToString();
+}
+
+// Identifies the render process group of a browser while content selects a
+// render process for it. Content selects processes synchronously when a
+// WebContents is created and when a navigation starts.
+class ScopedRenderProcessGroup : public CefRenderProcessGroups::ScopedGroup {
+ public:
+  explicit ScopedRenderProcessGroup(const CefBrowserSettings& settings)
+      : CefRenderProcessGroups::ScopedGroup(_Context->GetRenderProcessGroups(),
+                                            GetRenderProcessGroup(settings)) {
+  }
+};
+
 void CreateBrowserWithHelper(CreateBrowserHelper* helper) {
   CefBrowserHost::CreateBrowserSync(helper->window_info_, helper->client_,
       helper->url_, helper->settings_);
@@ -103,6 +127,103 @@ bool GetCefKeyEvent(const content::NativeWebKeyboardEvent& event,
   return true;
 }
 
+// Returns the current time in seconds as used for WebInputEvent time stamps.
+double GetEventTimeStamp() {
+  return (base::TimeTicks::Now() - base::TimeTicks()).InSecondsF();
+}
+
+// Convert a CefKeyEvent to a NativeWebKeyboardEvent.
+bool GetNativeWebKeyboardEvent(const CefKeyEvent& cef_event,
+                               content::NativeWebKeyboardEvent& event) {
+  switch (cef_event.type) {
+    case KEYEVENT_RAWKEYDOWN:
+      event.type = WebKit::WebKeyboardEvent::RawKeyDown;
+      break;
+    case KEYEVENT_KEYDOWN:
+      event.type = WebKit::WebKeyboardEvent::KeyDown;
+      break;
+    case KEYEVENT_KEYUP:
+      event.type = WebKit::WebKeyboardEvent::KeyUp;
+      break;
+    case KEYEVENT_CHAR:
+      event.type = WebKit::WebKeyboardEvent::Char;
+      break;
+    default:
+      return false;
+  }
+
+  event.modifiers = 0;
+  if (cef_event.modifiers & KEY_SHIFT)
+    event.modifiers |= WebKit::WebKeyboardEvent::ShiftKey;
+  if (cef_event.modifiers & KEY_CTRL)
+    event.modifiers |= WebKit::WebKeyboardEvent::ControlKey;
+  if (cef_event.modifiers & KEY_ALT)
+    event.modifiers |= WebKit::WebKeyboardEvent::AltKey;
+  if (cef_event.modifiers & KEY_META)
+    event.modifiers |= WebKit::WebKeyboardEvent::MetaKey;
+  if (cef_event.modifiers & KEY_KEYPAD)
+    event.modifiers |= WebKit::WebKeyboardEvent::IsKeyPad;
+
+  event.windowsKeyCode = cef_event.windows_key_code;
+  event.nativeKeyCode = cef_event.native_key_code;
+  event.isSystemKey = cef_event.is_system_key;
+  event.text[0] = cef_event.character;
+  event.unmodifiedText[0] = cef_event.unmodified_character;
+  event.setKeyIdentifierFromWindowsKeyCode();
+  event.timeStampSeconds = GetEventTimeStamp();
+
+  // The event did not originate from the OS.
+  event.skip_in_browser = false;
+
+  return true;
+}
+
+// Convert a CefMouseEvent to a WebMouseEvent. The event type and button must
+// be set by the caller.
+void GetWebMouseEvent(CefRefPtr<CefBrowserHostImpl> browser,
+                      const CefMouseEvent& cef_event,
+                      WebKit::WebMouseEvent& event) {
+  event.x = event.windowX = cef_event.x;
+  event.y = event.windowY = cef_event.y;
+
+  // Use the screen coordinates provided by the client, if any. Otherwise fall
+  // back to view coordinates.
+  int screenX = cef_event.x;
+  int screenY = cef_event.y;
+  CefRefPtr<CefClient> client = browser->GetClient();
+  if (client.get()) {
+    CefRefPtr<CefRenderHandler> handler = client->GetRenderHandler();
+    if (handler.get() &&
+        !handler->GetScreenPoint(browser.get(), cef_event.x, cef_event.y,
+                                 screenX, screenY)) {
+      screenX = cef_event.x;
+      screenY = cef_event.y;
+    }
+  }
+  event.globalX = screenX;
+  event.globalY = screenY;
+
+  event.modifiers = 0;
+  if (cef_event.modifiers & EVENTFLAG_SHIFT_DOWN)
+    event.modifiers |= WebKit::WebInputEvent::ShiftKey;
+  if (cef_event.modifiers & EVENTFLAG_CONTROL_DOWN)
+    event.modifiers |= WebKit::WebInputEvent::ControlKey;
+  if (cef_event.modifiers & EVENTFLAG_ALT_DOWN)
+    event.modifiers |= WebKit::WebInputEvent::AltKey;
+  if (cef_event.modifiers & EVENTFLAG_COMMAND_DOWN)
+    event.modifiers |= WebKit::WebInputEvent::MetaKey;
+  if (cef_event.modifiers & EVENTFLAG_CAPS_LOCK_DOWN)
+    event.modifiers |= WebKit::WebInputEvent::CapsLockOn;
+  if (cef_event.modifiers & EVENTFLAG_LEFT_MOUSE_BUTTON)
+    event.modifiers |= WebKit::WebInputEvent::LeftButtonDown;
+  if (cef_event.modifiers & EVENTFLAG_MIDDLE_MOUSE_BUTTON)
+    event.modifiers |= WebKit::WebInputEvent::MiddleButtonDown;
+  if (cef_event.modifiers & EVENTFLAG_RIGHT_MOUSE_BUTTON)
+    event.modifiers |= WebKit::WebInputEvent::RightButtonDown;
+
+  event.timeStampSeconds = GetEventTimeStamp();
+}
+
 class CefFileDialogCallbackImpl : public CefFileDialogCallback {
  public:
   explicit CefFileDialogCallbackImpl(
@@ -219,6 +340,13 @@ bool CefBrowserHost::CreateBrowser(const CefWindowInfo& windowInfo,
     return false;
   }
 
+  // Verify that a native window is not requested without a UI toolkit.
+  if (_Context->settings().windowless_rendering_only &&
+      !windowInfo.window_rendering_disabled) {
+    NOTREACHED() << "window rendering must be disabled";
+    return false;
+  }
+
   // Create the browser on the UI thread.
   CreateBrowserHelper* helper =
       new CreateBrowserHelper(windowInfo, client, url, settings);
@@ -245,6 +373,13 @@ CefRefPtr<CefBrowser> CefBrowserHost::CreateBrowserSync(
     return NULL;
   }
 
+  // Verify that a native window is not requested without a UI toolkit.
+  if (_Context->settings().windowless_rendering_only &&
+      !windowInfo.window_rendering_disabled) {
+    NOTREACHED() << "window rendering must be disabled";
+    return NULL;
+  }
+
   // Verify that this method is being called on the UI thread.
   if (!CEF_CURRENTLY_ON_UIT()) {
     NOTREACHED() << "called on invalid thread";
@@ -271,10 +406,27 @@ CefRefPtr<CefBrowserHostImpl> CefBrowserHostImpl::Create(
     CefWindowHandle opener) {
   CEF_REQUIRE_UIT();
 
+  _Context->OnBrowserCreated();
+
   if (web_contents == NULL) {
+    // Use a spare render process if one is available. Browsers in a group that
+    // already has a render process share that process instead.
+    scoped_refptr<content::SiteInstance> site_instance;
+    CefRenderProcessPool* pool = _Context->GetRenderProcessPool();
+    CefRenderProcessGroups* groups = _Context->GetRenderProcessGroups();
+    const std::string group = GetRenderProcessGroup(settings);
+    if (pool && (group.empty() || !groups || !groups->HasProcess(group)))
+      site_instance = pool->Claim();
+
+    // Content asks CefContentBrowserClient for the WebContentsView while the
+    // WebContents is being created.
+    _Context->browser_context()->set_use_osr_next_contents_view(
+        window_info.window_rendering_disabled ? true : false);
+
+    ScopedRenderProcessGroup scoped_group(settings);
     web_contents = content::WebContents::Create(
         _Context->browser_context(),
-        NULL,
+        site_instance.get(),
         MSG_ROUTING_NONE,
         NULL);
   }
@@ -282,8 +434,10 @@ CefRefPtr<CefBrowserHostImpl> CefBrowserHostImpl::Create(
   CefRefPtr<CefBrowserHostImpl> browser =
       new CefBrowserHostImpl(window_info, settings, client, web_contents,
                              opener);
-  if (!browser->PlatformCreateWindow())
+  if (!browser->IsWindowRenderingDisabled() &&
+      !browser->PlatformCreateWindow()) {
     return NULL;
+  }
 
   _Context->AddBrowser(browser);
 
@@ -393,10 +547,10 @@ CefRefPtr<CefBrowser> CefBrowserHostImpl::GetBrowser() {
 
 void CefBrowserHostImpl::CloseBrowser() {
   if (CEF_CURRENTLY_ON_UIT()) {
-    PlatformCloseWindow();
+    CloseHostWindow();
   } else {
     CEF_POST_TASK(CEF_UIT,
-        base::Bind(&CefBrowserHostImpl::PlatformCloseWindow, this));
+        base::Bind(&CefBrowserHostImpl::CloseHostWindow, this));
   }
 }
 
@@ -487,6 +641,256 @@ void CefBrowserHostImpl::RunFileDialog(
       base::Bind(&CefRunFileDialogCallbackWrapper::Callback, wrapper));
 }
 
+void CefBrowserHostImpl::WasHidden(bool hidden) {
+  if (CEF_CURRENTLY_ON_UIT()) {
+    {
+      base::AutoLock lock_scope(state_lock_);
+      if (is_hidden_ == hidden)
+        return;
+      is_hidden_ = hidden;
+    }
+
+    // The RenderWidgetHost stops painting, throttles the renderer and lowers
+    // the process priority once all widgets in the process are hidden.
+    if (web_contents_.get()) {
+      if (hidden)
+        web_contents_->WasHidden();
+      else
+        web_contents_->WasRestored();
+    }
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::WasHidden, this, hidden));
+  }
+}
+
+bool CefBrowserHostImpl::IsHidden() {
+  base::AutoLock lock_scope(state_lock_);
+  return is_hidden_;
+}
+
+void CefBrowserHostImpl::NotifyMemoryPressure(
+    MemoryPressureLevel level,
+    CefRefPtr<CefMemoryPressureCallback> callback) {
+  if (CEF_CURRENTLY_ON_UIT()) {
+    content::RenderProcessHost* host = NULL;
+    if (web_contents_.get())
+      host = web_contents_->GetRenderProcessHost();
+
+    if (host) {
+      CefSendMemoryPressure(host, level, callback);
+    } else if (callback.get()) {
+      callback->OnMemoryReleased(-1);
+    }
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::NotifyMemoryPressure, this, level,
+                   callback));
+  }
+}
+
+void CefBrowserHostImpl::GetResourceUsage(
+    CefRefPtr<CefResourceUsageCallback> callback) {
+  DCHECK(callback.get());
+  if (!callback.get())
+    return;
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    content::RenderProcessHost* host = NULL;
+    if (web_contents_.get())
+      host = web_contents_->GetRenderProcessHost();
+    CefQueryResourceUsage(this, host, callback);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::GetResourceUsage, this, callback));
+  }
+}
+
+bool CefBrowserHostImpl::IsWindowRenderingDisabled() {
+  return window_info_.window_rendering_disabled ? true : false;
+}
+
+void CefBrowserHostImpl::WasResized() {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (view)
+      view->WasResized();
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::WasResized, this));
+  }
+}
+
+void CefBrowserHostImpl::Invalidate(const CefRect& dirtyRect) {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  // Always paint asynchronously so that the client can call this method from
+  // inside CefRenderHandler::OnPaint.
+  CEF_POST_TASK(CEF_UIT,
+      base::Bind(&CefBrowserHostImpl::InvalidateOnUIThread, this,
+                 gfx::Rect(dirtyRect.x, dirtyRect.y, dirtyRect.width,
+                           dirtyRect.height)));
+}
+
+void CefBrowserHostImpl::SendKeyEvent(const CefKeyEvent& event) {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (!view)
+      return;
+
+    content::NativeWebKeyboardEvent web_event;
+    if (GetNativeWebKeyboardEvent(event, web_event))
+      view->SendKeyEvent(web_event);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendKeyEvent, this, event));
+  }
+}
+
+void CefBrowserHostImpl::SendMouseClickEvent(const CefMouseEvent& event,
+                                             MouseButtonType type,
+                                             bool mouseUp, int clickCount) {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (!view)
+      return;
+
+    WebKit::WebMouseEvent web_event;
+    GetWebMouseEvent(this, event, web_event);
+    web_event.type = mouseUp ? WebKit::WebInputEvent::MouseUp :
+                               WebKit::WebInputEvent::MouseDown;
+    switch (type) {
+      case MBT_LEFT:
+        web_event.button = WebKit::WebMouseEvent::ButtonLeft;
+        break;
+      case MBT_MIDDLE:
+        web_event.button = WebKit::WebMouseEvent::ButtonMiddle;
+        break;
+      case MBT_RIGHT:
+        web_event.button = WebKit::WebMouseEvent::ButtonRight;
+        break;
+    }
+    web_event.clickCount = clickCount;
+
+    view->SendMouseEvent(web_event);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendMouseClickEvent, this, event, type,
+                   mouseUp, clickCount));
+  }
+}
+
+void CefBrowserHostImpl::SendMouseMoveEvent(const CefMouseEvent& event,
+                                            bool mouseLeave) {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (!view)
+      return;
+
+    WebKit::WebMouseEvent web_event;
+    GetWebMouseEvent(this, event, web_event);
+    web_event.type = mouseLeave ? WebKit::WebInputEvent::MouseLeave :
+                                  WebKit::WebInputEvent::MouseMove;
+    if (event.modifiers & EVENTFLAG_LEFT_MOUSE_BUTTON)
+      web_event.button = WebKit::WebMouseEvent::ButtonLeft;
+    else if (event.modifiers & EVENTFLAG_MIDDLE_MOUSE_BUTTON)
+      web_event.button = WebKit::WebMouseEvent::ButtonMiddle;
+    else if (event.modifiers & EVENTFLAG_RIGHT_MOUSE_BUTTON)
+      web_event.button = WebKit::WebMouseEvent::ButtonRight;
+    else
+      web_event.button = WebKit::WebMouseEvent::ButtonNone;
+
+    view->SendMouseEvent(web_event);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendMouseMoveEvent, this, event,
+                   mouseLeave));
+  }
+}
+
+void CefBrowserHostImpl::SendMouseWheelEvent(const CefMouseEvent& event,
+                                             int deltaX, int deltaY) {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (!view)
+      return;
+
+    WebKit::WebMouseWheelEvent web_event;
+    GetWebMouseEvent(this, event, web_event);
+    web_event.type = WebKit::WebInputEvent::MouseWheel;
+    web_event.deltaX = deltaX;
+    web_event.deltaY = deltaY;
+    web_event.wheelTicksX = deltaX / WebKit::WebMouseWheelEvent::kWheelDelta;
+    web_event.wheelTicksY = deltaY / WebKit::WebMouseWheelEvent::kWheelDelta;
+
+    view->SendMouseWheelEvent(web_event);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendMouseWheelEvent, this, event,
+                   deltaX, deltaY));
+  }
+}
+
+void CefBrowserHostImpl::SendFocusEvent(bool setFocus) {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (view)
+      view->SendFocusEvent(setFocus);
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendFocusEvent, this, setFocus));
+  }
+}
+
+void CefBrowserHostImpl::SendCaptureLostEvent() {
+  if (!IsWindowRenderingDisabled()) {
+    NOTREACHED() << "Window rendering is not disabled";
+    return;
+  }
+
+  if (CEF_CURRENTLY_ON_UIT()) {
+    CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+    if (view)
+      view->SendCaptureLostEvent();
+  } else {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::SendCaptureLostEvent, this));
+  }
+}
+
 
 // CefBrowser methods.
 // -----------------------------------------------------------------------------
@@ -502,8 +906,10 @@ bool CefBrowserHostImpl::CanGoBack() {
 
 void CefBrowserHostImpl::GoBack() {
   if (CEF_CURRENTLY_ON_UIT()) {
-    if (web_contents_.get() && web_contents_->GetController().CanGoBack())
+    if (web_contents_.get() && web_contents_->GetController().CanGoBack()) {
+      ScopedRenderProcessGroup scoped_group(settings_);
       web_contents_->GetController().GoBack();
+    }
   } else {
     CEF_POST_TASK(CEF_UIT,
         base::Bind(&CefBrowserHostImpl::GoBack, this));
@@ -517,8 +923,10 @@ bool CefBrowserHostImpl::CanGoForward() {
 
 void CefBrowserHostImpl::GoForward() {
   if (CEF_CURRENTLY_ON_UIT()) {
-    if (web_contents_.get() && web_contents_->GetController().CanGoForward())
+    if (web_contents_.get() && web_contents_->GetController().CanGoForward()) {
+      ScopedRenderProcessGroup scoped_group(settings_);
       web_contents_->GetController().GoForward();
+    }
   } else {
     CEF_POST_TASK(CEF_UIT,
         base::Bind(&CefBrowserHostImpl::GoForward, this));
@@ -532,8 +940,10 @@ bool CefBrowserHostImpl::IsLoading() {
 
 void CefBrowserHostImpl::Reload() {
   if (CEF_CURRENTLY_ON_UIT()) {
-    if (web_contents_.get())
+    if (web_contents_.get()) {
+      ScopedRenderProcessGroup scoped_group(settings_);
       web_contents_->GetController().Reload(true);
+    }
   } else {
     CEF_POST_TASK(CEF_UIT,
         base::Bind(&CefBrowserHostImpl::Reload, this));
@@ -542,8 +952,10 @@ void CefBrowserHostImpl::Reload() {
 
 void CefBrowserHostImpl::ReloadIgnoreCache() {
   if (CEF_CURRENTLY_ON_UIT()) {
-    if (web_contents_.get())
+    if (web_contents_.get()) {
+      ScopedRenderProcessGroup scoped_group(settings_);
       web_contents_->GetController().ReloadIgnoringCache(true);
+    }
   } else {
     CEF_POST_TASK(CEF_UIT,
         base::Bind(&CefBrowserHostImpl::ReloadIgnoreCache, this));
@@ -812,11 +1224,14 @@ void CefBrowserHostImpl::LoadURL(int64 frame_id, const std::string& url) {
         // Update the loading URL.
         OnLoadingURLChange(gurl);
 
-        web_contents_->GetController().LoadURL(
-            gurl,
-            content::Referrer(),
-            content::PAGE_TRANSITION_TYPED,
-            std::string());
+        {
+          ScopedRenderProcessGroup scoped_group(settings_);
+          web_contents_->GetController().LoadURL(
+              gurl,
+              content::Referrer(),
+              content::PAGE_TRANSITION_TYPED,
+              std::string());
+        }
         OnSetFocus(FOCUS_SOURCE_NAVIGATION);
       }
     } else {
@@ -974,6 +1389,25 @@ GURL CefBrowserHostImpl::GetLoadingURL() {
   return loading_url_;
 }
 
+void CefBrowserHostImpl::OnNetworkBytesReceived(int64 bytes) {
+  CEF_REQUIRE_IOT();
+  base::AutoLock lock_scope(state_lock_);
+  network_bytes_received_ += bytes;
+}
+
+void CefBrowserHostImpl::OnNetworkBytesSent(int64 bytes) {
+  CEF_REQUIRE_IOT();
+  base::AutoLock lock_scope(state_lock_);
+  network_bytes_sent_ += bytes;
+}
+
+void CefBrowserHostImpl::GetNetworkUsage(int64* bytes_received,
+                                         int64* bytes_sent) {
+  base::AutoLock lock_scope(state_lock_);
+  *bytes_received = network_bytes_received_;
+  *bytes_sent = network_bytes_sent_;
+}
+
 void CefBrowserHostImpl::OnSetFocus(cef_focus_source_t source) {
   if (CEF_CURRENTLY_ON_UIT()) {
     // SetFocus() might be called while inside the OnSetFocus() callback. If so,
@@ -1053,7 +1487,7 @@ void CefBrowserHostImpl::LoadingStateChanged(content::WebContents* source) {
 }
 
 void CefBrowserHostImpl::CloseContents(content::WebContents* source) {
-  PlatformCloseWindow();
+  CloseHostWindow();
 }
 
 void CefBrowserHostImpl::UpdateTargetURL(content::WebContents* source,
@@ -1101,6 +1535,10 @@ void CefBrowserHostImpl::WebContentsFocused(content::WebContents* contents) {
 
 bool CefBrowserHostImpl::HandleContextMenu(
     const content::ContextMenuParams& params) {
+  // Native context menus require a browser window.
+  if (IsWindowRenderingDisabled())
+    return true;
+
   if (!menu_creator_.get())
     menu_creator_.reset(new CefMenuCreator(this));
   return menu_creator_->CreateContextMenu(params);
@@ -1159,7 +1597,9 @@ void CefBrowserHostImpl::HandleKeyboardEvent(
     }
   }
 
-  PlatformHandleKeyboardEvent(event);
+  // Synthetic events sent to windowless browsers have no native event.
+  if (!IsWindowRenderingDisabled())
+    PlatformHandleKeyboardEvent(event);
 }
 
 bool CefBrowserHostImpl::ShouldCreateWebContents(
@@ -1177,9 +1617,14 @@ bool CefBrowserHostImpl::ShouldCreateWebContents(
   CefPopupFeatures features;
 
   pending_window_info_ = CefWindowInfo();
+  if (IsWindowRenderingDisabled()) {
+    // Popups of windowless browsers are also windowless by default.
+    pending_window_info_.SetAsOffScreen(NULL);
+  } else {
 #if defined(OS_WIN)
-  pending_window_info_.SetAsPopup(NULL, CefString());
+    pending_window_info_.SetAsPopup(NULL, CefString());
 #endif
+  }
 
 #if (defined(OS_WIN) || defined(OS_MACOSX))
   // Default to the size from the popup features.
@@ -1206,6 +1651,17 @@ bool CefBrowserHostImpl::ShouldCreateWebContents(
     }
   }
 
+  if (_Context->settings().windowless_rendering_only &&
+      !pending_window_info_.window_rendering_disabled) {
+    DLOG(ERROR) << "Popup blocked: window rendering must be disabled";
+    pending_client_ = NULL;
+    return false;
+  }
+
+  // The WebContents for the popup is created after this method returns.
+  _Context->browser_context()->set_use_osr_next_contents_view(
+      pending_window_info_.window_rendering_disabled ? true : false);
+
   return true;
 }
 
@@ -1214,6 +1670,8 @@ void CefBrowserHostImpl::WebContentsCreated(
     int64 source_frame_id,
     const GURL& target_url,
     content::WebContents* new_contents) {
+  _Context->browser_context()->set_use_osr_next_contents_view(false);
+
   CefWindowHandle opener = NULL;
   if (source_contents)
     opener = GetBrowserForContents(source_contents)->GetWindowHandle();
@@ -1252,7 +1710,9 @@ void CefBrowserHostImpl::RunFileChooser(
 
 void CefBrowserHostImpl::UpdatePreferredSize(content::WebContents* source,
                                              const gfx::Size& pref_size) {
-  PlatformSizeTo(pref_size.width(), pref_size.height());
+  // The view size of windowless browsers is controlled by the client.
+  if (!IsWindowRenderingDisabled())
+    PlatformSizeTo(pref_size.width(), pref_size.height());
 }
 
 void CefBrowserHostImpl::RequestMediaAccessPermission(
@@ -1279,10 +1739,32 @@ void CefBrowserHostImpl::RequestMediaAccessPermission(
 void CefBrowserHostImpl::RenderViewCreated(
     content::RenderViewHost* render_view_host) {
   SetRenderViewHost(render_view_host);
+
+  if (IsWindowRenderingDisabled()) {
+    // Connect the view to this browser so that it can query the
+    // CefRenderHandler.
+    CefRenderWidgetHostViewOSR* view =
+        static_cast<CefRenderWidgetHostViewOSR*>(render_view_host->GetView());
+    if (view)
+      view->SetBrowser(this);
+  }
+
+  CefRenderProcessGroups* groups = _Context->GetRenderProcessGroups();
+  if (groups) {
+    groups->OnProcessAssigned(render_view_host->GetProcess(),
+                              GetRenderProcessGroup(settings_));
+  }
 }
 
 void CefBrowserHostImpl::RenderViewDeleted(
     content::RenderViewHost* render_view_host) {
+  if (IsWindowRenderingDisabled()) {
+    CefRenderWidgetHostViewOSR* view =
+        static_cast<CefRenderWidgetHostViewOSR*>(render_view_host->GetView());
+    if (view)
+      view->SetBrowser(NULL);
+  }
+
   registrar_->Remove(this, content::NOTIFICATION_FOCUS_CHANGED_IN_PAGE,
       content::Source<content::RenderViewHost>(render_view_host));
 }
@@ -1357,6 +1839,9 @@ void CefBrowserHostImpl::DidFinishLoad(
   // Give internal scheme handlers an opportunity to update content.
   scheme::DidFinishLoad(frame, validated_url);
 
+  if (is_main_frame)
+    _Context->OnMainFrameLoadEnd();
+
   OnLoadEnd(frame, validated_url);
 }
 
@@ -1383,6 +1868,15 @@ void CefBrowserHostImpl::PluginCrashed(const FilePath& plugin_path) {
 }
 
 bool CefBrowserHostImpl::OnMessageReceived(const IPC::Message& message) {
+  // Popup widgets such as <select> menus are created by the platform view
+  // factory which would create a native window for them. Don't show popup
+  // widgets for windowless browsers so that no window is ever created.
+  if (IsWindowRenderingDisabled() &&
+      (message.type() == ViewHostMsg_ShowWidget::ID ||
+       message.type() == ViewHostMsg_ShowFullscreenWidget::ID)) {
+    return true;
+  }
+
   bool handled = true;
   IPC_BEGIN_MESSAGE_MAP(CefBrowserHostImpl, message)
     IPC_MESSAGE_HANDLER(CefHostMsg_FrameIdentified, OnFrameIdentified)
@@ -1524,6 +2018,9 @@ CefBrowserHostImpl::CefBrowserHostImpl(const CefWindowInfo& window_info,
       can_go_back_(false),
       can_go_forward_(false),
       has_document_(false),
+      is_hidden_(false),
+      network_bytes_received_(0),
+      network_bytes_sent_(0),
       queue_messages_(true),
       main_frame_id_(CefFrameHostImpl::kInvalidFrameId),
       focused_frame_id_(CefFrameHostImpl::kInvalidFrameId),
@@ -1665,6 +2162,41 @@ void CefBrowserHostImpl::SetFocusedFrame(int64 frame_id) {
   focused_frame_id_ = CefFrameHostImpl::kInvalidFrameId;
 }
 
+CefRenderWidgetHostViewOSR* CefBrowserHostImpl::GetOSRHostView() {
+  CEF_REQUIRE_UIT();
+  DCHECK(IsWindowRenderingDisabled());
+  if (!web_contents_.get())
+    return NULL;
+  return static_cast<CefRenderWidgetHostViewOSR*>(
+      web_contents_->GetRenderWidgetHostView());
+}
+
+void CefBrowserHostImpl::InvalidateOnUIThread(const gfx::Rect& rect) {
+  CefRenderWidgetHostViewOSR* view = GetOSRHostView();
+  if (view)
+    view->Invalidate(rect);
+}
+
+void CefBrowserHostImpl::CloseHostWindow() {
+  CEF_REQUIRE_UIT();
+  if (IsWindowRenderingDisabled()) {
+    // There is no native window whose destruction would call DestroyBrowser().
+    // Destroy the browser asynchronously because the caller may be executing
+    // inside a WebContents callback.
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefBrowserHostImpl::DestroyWindowlessBrowser, this));
+  } else {
+    PlatformCloseWindow();
+  }
+}
+
+void CefBrowserHostImpl::DestroyWindowlessBrowser() {
+  CEF_REQUIRE_UIT();
+  // The browser may already have been destroyed during shutdown.
+  if (web_contents_.get())
+    DestroyBrowser();
+}
+
 void CefBrowserHostImpl::OnAddressChange(CefRefPtr<CefFrame> frame,
                                          const GURL& url) {
   if (client_.get()) {
@@ -1782,8 +2314,14 @@ void CefBrowserHostImpl::RunFileChooserOnUIThread(
     }
   }
 
-  if (!handled)
-    PlatformRunFileChooser(params, host_callback);
+  if (!handled) {
+    if (IsWindowRenderingDisabled()) {
+      // File dialogs require a browser window. Cancel the dialog.
+      host_callback.Run(std::vector<FilePath>());
+    } else {
+      PlatformRunFileChooser(params, host_callback);
+    }
+  }
 }
 
 void CefBrowserHostImpl::OnRunFileChooserCallback(
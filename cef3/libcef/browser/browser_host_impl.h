@@ -41,6 +41,7 @@ class URLRequest;
 struct Cef_Request_Params;
 struct Cef_Response_Params;
 struct CefNavigateParams;
+class CefRenderWidgetHostViewOSR;
 class SiteInstance;
 
 // Implementation of CefBrowser.
@@ -113,6 +114,26 @@ class CefBrowserHostImpl : public CefBrowserHost,
       const CefString& default_file_name,
       const std::vector<CefString>& accept_types,
       CefRefPtr<CefRunFileDialogCallback> callback) OVERRIDE;
+  virtual void WasHidden(bool hidden) OVERRIDE;
+  virtual bool IsHidden() OVERRIDE;
+  virtual void NotifyMemoryPressure(
+      MemoryPressureLevel level,
+      CefRefPtr<CefMemoryPressureCallback> callback) OVERRIDE;
+  virtual void GetResourceUsage(
+      CefRefPtr<CefResourceUsageCallback> callback) OVERRIDE;
+  virtual bool IsWindowRenderingDisabled() OVERRIDE;
+  virtual void WasResized() OVERRIDE;
+  virtual void Invalidate(const CefRect& dirtyRect) OVERRIDE;
+  virtual void SendKeyEvent(const CefKeyEvent& event) OVERRIDE;
+  virtual void SendMouseClickEvent(const CefMouseEvent& event,
+                                   MouseButtonType type,
+                                   bool mouseUp, int clickCount) OVERRIDE;
+  virtual void SendMouseMoveEvent(const CefMouseEvent& event,
+                                  bool mouseLeave) OVERRIDE;
+  virtual void SendMouseWheelEvent(const CefMouseEvent& event,
+                                   int deltaX, int deltaY) OVERRIDE;
+  virtual void SendFocusEvent(bool setFocus) OVERRIDE;
+  virtual void SendCaptureLostEvent() OVERRIDE;
 
   // CefBrowser methods.
   virtual CefRefPtr<CefBrowserHost> GetHost() OVERRIDE;
@@ -203,6 +224,14 @@ class CefBrowserHostImpl : public CefBrowserHost,
   // Returns the URL that is currently loading (or loaded) in the main frame.
   GURL GetLoadingURL();
 
+  // Account for network traffic generated by this browser. Called on the IO
+  // thread.
+  void OnNetworkBytesReceived(int64 bytes);
+  void OnNetworkBytesSent(int64 bytes);
+
+  // Returns the total network traffic generated by this browser. Thread safe.
+  void GetNetworkUsage(int64* bytes_received, int64* bytes_sent);
+
 #if defined(OS_WIN)
   static void RegisterWindowClass();
 #endif
@@ -369,6 +398,17 @@ class CefBrowserHostImpl : public CefBrowserHost,
   void PlatformRunFileChooser(const content::FileChooserParams& params,
                               RunFileChooserCallback callback);
 
+  // Returns the view for the current RenderViewHost of a browser with window
+  // rendering disabled.
+  CefRenderWidgetHostViewOSR* GetOSRHostView();
+  // Repaint |rect| of a browser with window rendering disabled.
+  void InvalidateOnUIThread(const gfx::Rect& rect);
+  // Close the native browser window or, if window rendering is disabled,
+  // destroy the browser.
+  void CloseHostWindow();
+  // Continuation from CloseHostWindow for browsers without a native window.
+  void DestroyWindowlessBrowser();
+
   void OnAddressChange(CefRefPtr<CefFrame> frame,
                        const GURL& url);
   void OnLoadStart(CefRefPtr<CefFrame> frame,
@@ -420,6 +460,9 @@ class CefBrowserHostImpl : public CefBrowserHost,
   bool can_go_back_;
   bool can_go_forward_;
   bool has_document_;
+  bool is_hidden_;
+  int64 network_bytes_received_;
+  int64 network_bytes_sent_;
   GURL loading_url_;
   CefString devtools_url_http_;
   CefString devtools_url_chrome_;
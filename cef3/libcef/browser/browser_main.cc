@@ -9,7 +9,10 @@
 #include "libcef/browser/browser_context.h"
 #include "libcef/browser/browser_message_loop.h"
 #include "libcef/browser/content_browser_client.h"
+#include "libcef/browser/context.h"
 #include "libcef/browser/devtools_delegate.h"
+#include "libcef/browser/thread_util.h"
+#include "libcef/browser/url_request_context_getter.h"
 
 #include "base/bind.h"
 #include "base/command_line.h"
@@ -22,6 +25,7 @@
 #include "content/browser/download/save_file_manager.h"
 #include "content/browser/plugin_service_impl.h"
 #include "content/public/browser/gpu_data_manager.h"
+#include "content/public/browser/render_process_host.h"
 #include "content/public/common/content_client.h"
 #include "content/public/common/content_switches.h"
 #include "net/base/net_module.h"
@@ -47,8 +51,13 @@ CefBrowserMainParts::~CefBrowserMainParts() {
 
 void CefBrowserMainParts::PreMainMessageLoopStart() {
   if (!MessageLoop::current()) {
-    // Create the browser message loop.
-    message_loop_.reset(new CefBrowserMessageLoop());
+    // Create the browser message loop. The browser process handler, if any,
+    // is notified when work is scheduled.
+    CefRefPtr<CefBrowserProcessHandler> handler;
+    CefRefPtr<CefApp> app = _Context->application();
+    if (app.get())
+      handler = app->GetBrowserProcessHandler();
+    message_loop_.reset(CefBrowserMessageLoop::Create(handler));
     message_loop_->set_thread_name("CrBrowserMain");
   }
 }
@@ -78,11 +87,33 @@ void CefBrowserMainParts::PreMainMessageLoopRun() {
       DLOG(WARNING) << "Invalid http debugger port number " << port;
     }
   }
+
+  if (command_line.HasSwitch(switches::kRendererProcessLimit)) {
+    std::string limit_str =
+        command_line.GetSwitchValueASCII(switches::kRendererProcessLimit);
+    int limit;
+    if (base::StringToInt(limit_str, &limit) && limit > 0) {
+      content::RenderProcessHost::SetMaxRendererProcessCount(
+          static_cast<size_t>(limit));
+    } else {
+      DLOG(WARNING) << "Invalid renderer process limit " << limit_str;
+    }
+  }
 }
 
 void CefBrowserMainParts::PostMainMessageLoopRun() {
   if (devtools_delegate_)
     devtools_delegate_->Stop();
+
+  // Commit pending cookie changes while the IO and DB threads are still
+  // running. The cookie store does not commit them on destruction.
+  CefURLRequestContextGetter* getter =
+      static_cast<CefURLRequestContextGetter*>(
+          browser_context_->GetRequestContext());
+  CEF_POST_TASK(CEF_IOT,
+      base::Bind(&CefURLRequestContextGetter::FlushCookieStore,
+                 make_scoped_refptr(getter)));
+
   browser_context_.reset();
 }
 
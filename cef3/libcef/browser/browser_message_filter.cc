@@ -5,17 +5,24 @@
 
 #include "libcef/browser/browser_message_filter.h"
 
+#include "libcef/browser/context.h"
+#include "libcef/browser/memory_pressure.h"
 #include "libcef/browser/origin_whitelist_impl.h"
+#include "libcef/browser/render_process_pool.h"
+#include "libcef/browser/resource_usage.h"
 #include "libcef/browser/thread_util.h"
 #include "libcef/common/cef_messages.h"
+#include "libcef/common/startup_timeline.h"
 
 #include "base/compiler_specific.h"
 #include "base/bind.h"
+#include "content/public/browser/render_process_host.h"
 
 CefBrowserMessageFilter::CefBrowserMessageFilter(
     content::RenderProcessHost* host)
     : host_(host),
-      channel_(NULL) {
+      channel_(NULL),
+      create_time_(base::TimeTicks::Now()) {
 }
 
 CefBrowserMessageFilter::~CefBrowserMessageFilter() {
@@ -33,20 +40,69 @@ bool CefBrowserMessageFilter::OnMessageReceived(const IPC::Message& message) {
   IPC_BEGIN_MESSAGE_MAP(CefBrowserMessageFilter, message)
     IPC_MESSAGE_HANDLER(CefProcessHostMsg_RenderThreadStarted,
                         OnRenderThreadStarted)
+    IPC_MESSAGE_HANDLER(CefProcessHostMsg_StartupPhases, OnStartupPhases)
+    IPC_MESSAGE_HANDLER(CefProcessHostMsg_MemoryReleased, OnMemoryReleased)
+    IPC_MESSAGE_HANDLER(CefProcessHostMsg_ResourceUsage, OnResourceUsage)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
   return handled;
 }
 
 void CefBrowserMessageFilter::OnRenderThreadStarted() {
+  CefStartupTimeline::GetInstance()->AddPhase("RenderProcessLaunch",
+      create_time_, base::TimeTicks::Now());
+
   // Execute registration on the UI thread.
   CEF_POST_TASK(CEF_UIT,
       base::Bind(&CefBrowserMessageFilter::RegisterOnUIThread, this));
 }
 
+void CefBrowserMessageFilter::OnStartupPhases(
+    const std::vector<CefProcessHostMsg_StartupPhase_Params>& params) {
+  CefStartupTimeline::PhaseList phases;
+  std::vector<CefProcessHostMsg_StartupPhase_Params>::const_iterator it =
+      params.begin();
+  for (; it != params.end(); ++it) {
+    CefStartupTimeline::Phase phase;
+    phase.name = it->name;
+    phase.start_time = base::TimeTicks::FromInternalValue(it->start_time);
+    phase.end_time = base::TimeTicks::FromInternalValue(it->end_time);
+    phase.process_id = it->process_id;
+    phase.inherited = it->inherited;
+    phases.push_back(phase);
+  }
+
+  if (_Context.get())
+    _Context->OnStartupPhases(PID_RENDERER, phases);
+}
+
+void CefBrowserMessageFilter::OnMemoryReleased(int request_id,
+                                               int64 bytes_freed) {
+  if (request_id == 0)
+    return;
+
+  CEF_POST_TASK(CEF_UIT,
+      base::Bind(&CefMemoryReleased, host_->GetID(), request_id,
+                 bytes_freed));
+}
+
+void CefBrowserMessageFilter::OnResourceUsage(
+    int request_id,
+    const CefProcessHostMsg_ResourceUsage_Params& params) {
+  CEF_POST_TASK(CEF_UIT,
+      base::Bind(&CefResourceUsageReceived, host_->GetID(), request_id,
+                 params));
+}
+
 void CefBrowserMessageFilter::RegisterOnUIThread() {
   CEF_REQUIRE_UIT();
   
   // Send existing registrations to the new render process.
   RegisterCrossOriginWhitelistEntriesWithHost(host_);
+
+  if (!_Context.get())
+    return;
+  CefRenderProcessPool* pool = _Context->GetRenderProcessPool();
+  if (pool)
+    pool->OnRenderThreadStarted(host_);
 }
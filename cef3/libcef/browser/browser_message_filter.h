@@ -7,12 +7,17 @@
 #define CEF_LIBCEF_BROWSER_BROWSER_MESSAGE_FILTER_H_
 
 #include <string>
+#include <vector>
+#include "base/time.h"
 #include "ipc/ipc_channel_proxy.h"
 
 namespace content {
 class RenderProcessHost;
 }
 
+struct CefProcessHostMsg_ResourceUsage_Params;
+struct CefProcessHostMsg_StartupPhase_Params;
+
 // This class sends and receives control messages on the browser process.
 class CefBrowserMessageFilter : public IPC::ChannelProxy::MessageFilter {
  public:
@@ -27,12 +32,20 @@ class CefBrowserMessageFilter : public IPC::ChannelProxy::MessageFilter {
  private:
   // Message handlers.
   void OnRenderThreadStarted();
+  void OnStartupPhases(
+      const std::vector<CefProcessHostMsg_StartupPhase_Params>& params);
+  void OnMemoryReleased(int request_id, int64 bytes_freed);
+  void OnResourceUsage(int request_id,
+                       const CefProcessHostMsg_ResourceUsage_Params& params);
 
   void RegisterOnUIThread();
 
   content::RenderProcessHost* host_;
   IPC::Channel* channel_;
 
+  // Time at which the render process host was created.
+  base::TimeTicks create_time_;
+
   DISALLOW_COPY_AND_ASSIGN(CefBrowserMessageFilter);
 };
 
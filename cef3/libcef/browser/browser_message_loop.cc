@@ -4,8 +4,147 @@
 
 #include "libcef/browser/browser_message_loop.h"
 
-CefBrowserMessageLoop::CefBrowserMessageLoop()
-  : is_iterating_(true) {
+#include <algorithm>
+
+#if defined(OS_MACOSX)
+#include "base/message_pump_mac.h"
+#endif
+
+namespace {
+
+// Maximum time that a single call to DoMessageLoopIteration() will spend
+// executing tasks before returning control to the application.
+const int64 kMaxIterationTimeMs = 10;
+
+// Returns the delay in milliseconds until |work_time|. Times in the past
+// result in a delay of 0.
+int64 GetDelayMs(const base::TimeTicks& work_time) {
+  return std::max(static_cast<int64>(0),
+                  (work_time - base::TimeTicks::Now()).InMilliseconds());
+}
+
+#if defined(OS_MACOSX)
+
+// UI message pump that notifies the application when work is scheduled so that
+// an external message pump knows when to call CefDoMessageLoopWork(). Wraps
+// the pump that MessagePumpMac::Create() selects for the application so that
+// applications that do not implement CrAppProtocol keep the NSApplication pump.
+class CefMessagePump : public base::MessagePump {
+ public:
+  explicit CefMessagePump(CefRefPtr<CefBrowserProcessHandler> handler)
+      : pump_(base::MessagePumpMac::Create()),
+        handler_(handler) {
+  }
+
+  virtual void Run(Delegate* delegate) OVERRIDE {
+    pump_->Run(delegate);
+  }
+
+  virtual void Quit() OVERRIDE {
+    pump_->Quit();
+  }
+
+  // Called on any thread when a task is added to an empty incoming queue.
+  virtual void ScheduleWork() OVERRIDE {
+    pump_->ScheduleWork();
+    handler_->OnScheduleMessagePumpWork(0);
+  }
+
+  // Called on the UI thread when the earliest delayed task changes.
+  virtual void ScheduleDelayedWork(
+      const base::TimeTicks& delayed_work_time) OVERRIDE {
+    pump_->ScheduleDelayedWork(delayed_work_time);
+    handler_->OnScheduleMessagePumpWork(GetDelayMs(delayed_work_time));
+  }
+
+ private:
+  virtual ~CefMessagePump() {}
+
+  scoped_refptr<base::MessagePump> pump_;
+  CefRefPtr<CefBrowserProcessHandler> handler_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefMessagePump);
+};
+
+#else  // !defined(OS_MACOSX)
+
+// UI message pump that notifies the application when work is scheduled so that
+// an external message pump knows when to call CefDoMessageLoopWork(). Derives
+// from MessagePumpForUI because MessageLoopForUI casts its pump to that type.
+class CefMessagePump : public base::MessagePumpForUI {
+ public:
+  explicit CefMessagePump(CefRefPtr<CefBrowserProcessHandler> handler)
+      : handler_(handler) {
+  }
+
+  // Called on any thread when a task is added to an empty incoming queue.
+  virtual void ScheduleWork() OVERRIDE {
+    base::MessagePumpForUI::ScheduleWork();
+    handler_->OnScheduleMessagePumpWork(0);
+  }
+
+  // Called on the UI thread when the earliest delayed task changes.
+  virtual void ScheduleDelayedWork(
+      const base::TimeTicks& delayed_work_time) OVERRIDE {
+    base::MessagePumpForUI::ScheduleDelayedWork(delayed_work_time);
+    handler_->OnScheduleMessagePumpWork(GetDelayMs(delayed_work_time));
+  }
+
+ private:
+  virtual ~CefMessagePump() {}
+
+  CefRefPtr<CefBrowserProcessHandler> handler_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefMessagePump);
+};
+
+#endif  // !defined(OS_MACOSX)
+
+// Handler for the pump returned by CreateMessagePump(). Only set on the UI
+// thread while CefBrowserMessageLoop::Create() constructs the message loop.
+CefBrowserProcessHandler* g_pump_handler = NULL;
+
+// Factory used by MessageLoop to create all UI message pumps once installed.
+// Returns the default UI pump when no handler is waiting for a pump.
+base::MessagePump* CreateMessagePump() {
+  if (g_pump_handler)
+    return new CefMessagePump(g_pump_handler);
+#if defined(OS_MACOSX)
+  return base::MessagePumpMac::Create();
+#else
+  return new base::MessagePumpForUI();
+#endif
+}
+
+}  // namespace
+
+CefBrowserMessageLoop::CefBrowserMessageLoop(
+    CefRefPtr<CefBrowserProcessHandler> handler)
+  : handler_(handler),
+    is_iterating_(true),
+    time_slice_exhausted_(false) {
+}
+
+// static
+CefBrowserMessageLoop* CefBrowserMessageLoop::Create(
+    CefRefPtr<CefBrowserProcessHandler> handler) {
+  if (!handler.get())
+    return new CefBrowserMessageLoop(handler);
+
+  // Install the factory so that MessageLoop creates a pump that notifies the
+  // handler in place of the default UI pump. The factory can only be
+  // installed once per process.
+  static bool factory_installed = false;
+  if (!factory_installed) {
+    MessageLoop::InitMessagePumpForUIFactory(&CreateMessagePump);
+    factory_installed = true;
+  }
+
+  DCHECK(!g_pump_handler);
+  g_pump_handler = handler.get();
+  CefBrowserMessageLoop* loop = new CefBrowserMessageLoop(handler);
+  g_pump_handler = NULL;
+  return loop;
 }
 
 CefBrowserMessageLoop::~CefBrowserMessageLoop() {
@@ -23,6 +162,25 @@ CefBrowserMessageLoop* CefBrowserMessageLoop::current() {
   return static_cast<CefBrowserMessageLoop*>(loop);
 }
 
+bool CefBrowserMessageLoop::DoWork() {
+  bool valueToRet = inherited::DoWork();
+  if (is_iterating_ && valueToRet &&
+      base::TimeTicks::Now() >= iteration_deadline_) {
+    // Return control to the application. Remaining work will be executed by
+    // the next iteration.
+    time_slice_exhausted_ = true;
+    pump_->Quit();
+  }
+  return valueToRet;
+}
+
+bool CefBrowserMessageLoop::DoDelayedWork(
+    base::TimeTicks* next_delayed_work_time) {
+  bool valueToRet = inherited::DoDelayedWork(next_delayed_work_time);
+  next_delayed_work_time_ = *next_delayed_work_time;
+  return valueToRet;
+}
+
 bool CefBrowserMessageLoop::DoIdleWork() {
   bool valueToRet = inherited::DoIdleWork();
   if (is_iterating_)
@@ -32,11 +190,31 @@ bool CefBrowserMessageLoop::DoIdleWork() {
 
 // Do a single interation of the UI message loop.
 void CefBrowserMessageLoop::DoMessageLoopIteration() {
+  time_slice_exhausted_ = false;
+  next_delayed_work_time_ = base::TimeTicks();
+  iteration_deadline_ = base::TimeTicks::Now() +
+      base::TimeDelta::FromMilliseconds(kMaxIterationTimeMs);
+
   Run();
+
+  if (!is_iterating_)
+    return;
+
+  // Tell the application when the next iteration is needed.
+  if (time_slice_exhausted_) {
+    ScheduleMessagePumpWork(0);
+  } else if (!next_delayed_work_time_.is_null()) {
+    ScheduleMessagePumpWork(GetDelayMs(next_delayed_work_time_));
+  }
 }
 
 // Run the UI message loop.
 void CefBrowserMessageLoop::RunMessageLoop() {
   is_iterating_ = false;
-  DoMessageLoopIteration();
+  Run();
+}
+
+void CefBrowserMessageLoop::ScheduleMessagePumpWork(int64 delay_ms) {
+  if (handler_.get())
+    handler_->OnScheduleMessagePumpWork(delay_ms);
 }
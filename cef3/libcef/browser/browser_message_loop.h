@@ -6,23 +6,32 @@
 #define CEF_LIBCEF_BROWSER_BROWSER_MESSAGE_LOOP_H_
 #pragma once
 
+#include "include/cef_browser_process_handler.h"
 #include "base/basictypes.h"
 #include "base/message_loop.h"
+#include "base/time.h"
 
 // Class used to process events on the current message loop.
 class CefBrowserMessageLoop : public MessageLoopForUI {
   typedef MessageLoopForUI inherited;
 
  public:
-  CefBrowserMessageLoop();
+  // Create the message loop for the current thread. If |handler| is non-NULL
+  // the loop is created with a UI pump that notifies |handler| when work is
+  // scheduled. Otherwise the default UI pump is used.
+  static CefBrowserMessageLoop* Create(
+      CefRefPtr<CefBrowserProcessHandler> handler);
   virtual ~CefBrowserMessageLoop();
 
   // Returns the MessageLoopForUI of the current thread.
   static CefBrowserMessageLoop* current();
 
+  virtual bool DoWork();
+  virtual bool DoDelayedWork(base::TimeTicks* next_delayed_work_time);
   virtual bool DoIdleWork();
 
-  // Do a single interation of the UI message loop.
+  // Do a single interation of the UI message loop. Returns after all pending
+  // work is complete or the time slice is exhausted, whichever comes first.
   void DoMessageLoopIteration();
 
   // Run the UI message loop.
@@ -31,9 +40,27 @@ class CefBrowserMessageLoop : public MessageLoopForUI {
   bool is_iterating() { return is_iterating_; }
 
  private:
+  explicit CefBrowserMessageLoop(
+      CefRefPtr<CefBrowserProcessHandler> handler);
+
+  // Notify |handler_| that work is scheduled after |delay_ms|.
+  void ScheduleMessagePumpWork(int64 delay_ms);
+
+  CefRefPtr<CefBrowserProcessHandler> handler_;
+
   // True if the message loop is doing one iteration at a time.
   bool is_iterating_;
 
+  // True if the current iteration was stopped with work still pending.
+  bool time_slice_exhausted_;
+
+  // Time at which the current iteration must return.
+  base::TimeTicks iteration_deadline_;
+
+  // Run time of the next delayed task or null if there is none. Reset at the
+  // start of each iteration.
+  base::TimeTicks next_delayed_work_time_;
+
   DISALLOW_COPY_AND_ASSIGN(CefBrowserMessageLoop);
 };
 
@@ -0,0 +1,203 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/browser/coalescing_cookie_store.h"
+
+#include "libcef/browser/thread_util.h"
+
+#include "base/bind.h"
+#include "base/logging.h"
+#include "chrome/browser/net/sqlite_persistent_cookie_store.h"
+
+namespace {
+
+// Default commit interval when a commit policy is configured without an
+// explicit interval. Matches the SQLite store's own interval.
+const int kDefaultCommitIntervalMs = 30 * 1000;
+
+// Default commit interval when commits are deferred.
+const int kDefaultDeferredIntervalMs = 5 * 60 * 1000;
+
+// Default number of pending changes that will trigger a commit. Matches the
+// SQLite store's own batch size.
+const size_t kDefaultCommitBatchSize = 512;
+
+}  // namespace
+
+CefCoalescingCookieStore::Policy::Policy()
+    : commit_interval(0),
+      commit_batch_size(0),
+      deferred_commit(false) {
+}
+
+CefCoalescingCookieStore::Policy::Policy(const CefSettings& settings)
+    : commit_interval(settings.cookie_commit_interval),
+      commit_batch_size(settings.cookie_commit_batch_size),
+      deferred_commit(settings.cookie_deferred_commit) {
+}
+
+// static
+scoped_refptr<net::CookieMonster::PersistentCookieStore>
+    CefCoalescingCookieStore::CreateForPath(const FilePath& cookie_path,
+                                            const Policy& policy) {
+  scoped_refptr<net::CookieMonster::PersistentCookieStore> store(
+      new SQLitePersistentCookieStore(cookie_path, false, NULL));
+
+  if (policy.commit_interval <= 0 && policy.commit_batch_size <= 0 &&
+      !policy.deferred_commit) {
+    // Use the default commit behavior of the SQLite store.
+    return store;
+  }
+
+  int commit_interval_ms = policy.commit_interval;
+  if (commit_interval_ms <= 0) {
+    commit_interval_ms = policy.deferred_commit ?
+        kDefaultDeferredIntervalMs : kDefaultCommitIntervalMs;
+  }
+
+  // The number of pending changes never triggers a commit when commits are
+  // deferred.
+  size_t commit_batch_size = 0;
+  if (!policy.deferred_commit) {
+    commit_batch_size = policy.commit_batch_size > 0 ?
+        static_cast<size_t>(policy.commit_batch_size) :
+        kDefaultCommitBatchSize;
+  }
+
+  return new CefCoalescingCookieStore(store, commit_interval_ms,
+                                      commit_batch_size);
+}
+
+CefCoalescingCookieStore::CefCoalescingCookieStore(
+    net::CookieMonster::PersistentCookieStore* store,
+    int commit_interval_ms,
+    size_t commit_batch_size)
+    : store_(store),
+      commit_interval_ms_(commit_interval_ms),
+      commit_batch_size_(commit_batch_size),
+      commit_scheduled_(false) {
+  DCHECK(store_);
+  DCHECK_GT(commit_interval_ms_, 0);
+}
+
+CefCoalescingCookieStore::~CefCoalescingCookieStore() {
+  DLOG_IF(WARNING, !pending_.empty()) << pending_.size() <<
+      " cookie changes were discarded because the store was not flushed";
+}
+
+void CefCoalescingCookieStore::Load(const LoadedCallback& loaded_callback) {
+  store_->Load(loaded_callback);
+}
+
+void CefCoalescingCookieStore::LoadCookiesForKey(
+    const std::string& key,
+    const LoadedCallback& loaded_callback) {
+  store_->LoadCookiesForKey(key, loaded_callback);
+}
+
+void CefCoalescingCookieStore::AddCookie(const net::CanonicalCookie& cc) {
+  AddOperation(OPERATION_ADD, cc);
+}
+
+void CefCoalescingCookieStore::UpdateCookieAccessTime(
+    const net::CanonicalCookie& cc) {
+  AddOperation(OPERATION_UPDATE_ACCESS_TIME, cc);
+}
+
+void CefCoalescingCookieStore::DeleteCookie(const net::CanonicalCookie& cc) {
+  AddOperation(OPERATION_DELETE, cc);
+}
+
+void CefCoalescingCookieStore::SetForceKeepSessionState() {
+  store_->SetForceKeepSessionState();
+}
+
+void CefCoalescingCookieStore::Flush(const base::Closure& callback) {
+  Commit(callback);
+}
+
+void CefCoalescingCookieStore::AddOperation(OperationType type,
+                                            const net::CanonicalCookie& cc) {
+  CEF_REQUIRE_IOT();
+
+  const int64 key = cc.CreationDate().ToInternalValue();
+  PendingMap::iterator it = pending_.find(key);
+  if (it == pending_.end()) {
+    pending_.insert(std::make_pair(key, PendingOperation(type, cc)));
+  } else {
+    PendingOperation& pending = it->second;
+    switch (type) {
+      case OPERATION_ADD:
+        // An add following a delete replaces the existing cookie.
+        pending.type = (pending.type == OPERATION_DELETE) ?
+            OPERATION_REPLACE : OPERATION_ADD;
+        pending.cookie = cc;
+        break;
+      case OPERATION_UPDATE_ACCESS_TIME:
+        // An access time update is folded into a pending add or replace.
+        if (pending.type != OPERATION_DELETE)
+          pending.cookie = cc;
+        break;
+      case OPERATION_DELETE:
+        if (pending.type == OPERATION_ADD) {
+          // The cookie never reached the backing store.
+          pending_.erase(it);
+        } else {
+          pending.type = OPERATION_DELETE;
+          pending.cookie = cc;
+        }
+        break;
+      case OPERATION_REPLACE:
+        NOTREACHED();
+        break;
+    }
+  }
+
+  if (commit_batch_size_ > 0 && pending_.size() >= commit_batch_size_) {
+    Commit(base::Closure());
+  } else if (!commit_scheduled_ && !pending_.empty()) {
+    commit_scheduled_ = true;
+    CEF_POST_DELAYED_TASK(CEF_IOT,
+        base::Bind(&CefCoalescingCookieStore::OnCommitTimer, this),
+        base::TimeDelta::FromMilliseconds(commit_interval_ms_));
+  }
+}
+
+void CefCoalescingCookieStore::Commit(const base::Closure& callback) {
+  CEF_REQUIRE_IOT();
+
+  PendingMap pending;
+  pending.swap(pending_);
+
+  PendingMap::const_iterator it = pending.begin();
+  for (; it != pending.end(); ++it) {
+    const net::CanonicalCookie& cc = it->second.cookie;
+    switch (it->second.type) {
+      case OPERATION_ADD:
+        store_->AddCookie(cc);
+        break;
+      case OPERATION_UPDATE_ACCESS_TIME:
+        store_->UpdateCookieAccessTime(cc);
+        break;
+      case OPERATION_DELETE:
+        store_->DeleteCookie(cc);
+        break;
+      case OPERATION_REPLACE:
+        store_->DeleteCookie(cc);
+        store_->AddCookie(cc);
+        break;
+    }
+  }
+
+  // Write the changes to disk now instead of waiting for the backing store's
+  // own commit interval.
+  if (!pending.empty() || !callback.is_null())
+    store_->Flush(callback);
+}
+
+void CefCoalescingCookieStore::OnCommitTimer() {
+  CEF_REQUIRE_IOT();
+  commit_scheduled_ = false;
+  Commit(base::Closure());
+}
@@ -0,0 +1,111 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_COALESCING_COOKIE_STORE_H_
+#define CEF_LIBCEF_BROWSER_COALESCING_COOKIE_STORE_H_
+#pragma once
+
+#include <map>
+
+#include "base/callback.h"
+#include "base/compiler_specific.h"
+#include "base/file_path.h"
+#include "base/memory/ref_counted.h"
+#include "include/internal/cef_types_wrappers.h"
+#include "net/cookies/cookie_monster.h"
+
+// Persistent cookie store that buffers changes in memory and forwards them to
+// a backing store in batches. Repeated changes to the same cookie between
+// commits are coalesced so that, for example, a session cookie that is added
+// and then deleted before the next commit never reaches the backing store.
+// Pending changes are committed, and the backing store flushed to disk, when
+// the commit interval elapses, when the batch size is reached or when Flush()
+// is called. Changes are not committed on destruction because the destructor
+// may run during shutdown after the DB thread has stopped; owners must call
+// Flush() before releasing the store. All methods must be called on the IO
+// thread.
+class CefCoalescingCookieStore
+    : public net::CookieMonster::PersistentCookieStore {
+ public:
+  // Commit policy for the on-disk cookie database. The members have the same
+  // meaning as the CefSettings cookie_commit_* members.
+  struct Policy {
+    // Creates an unset policy that uses the SQLite store's own behavior.
+    Policy();
+    // Creates the policy configured in |settings|.
+    explicit Policy(const CefSettings& settings);
+
+    int commit_interval;
+    int commit_batch_size;
+    bool deferred_commit;
+  };
+
+  // Returns the persistent store that should be used for the cookie database
+  // at |cookie_path|. If |policy| is unset the SQLite store is returned
+  // directly.
+  static scoped_refptr<net::CookieMonster::PersistentCookieStore>
+      CreateForPath(const FilePath& cookie_path, const Policy& policy);
+
+  // If |commit_batch_size| is 0 the batch size will not trigger a commit.
+  CefCoalescingCookieStore(net::CookieMonster::PersistentCookieStore* store,
+                           int commit_interval_ms,
+                           size_t commit_batch_size);
+
+  // net::CookieMonster::PersistentCookieStore methods.
+  virtual void Load(const LoadedCallback& loaded_callback) OVERRIDE;
+  virtual void LoadCookiesForKey(const std::string& key,
+                                 const LoadedCallback& loaded_callback)
+      OVERRIDE;
+  virtual void AddCookie(const net::CanonicalCookie& cc) OVERRIDE;
+  virtual void UpdateCookieAccessTime(const net::CanonicalCookie& cc) OVERRIDE;
+  virtual void DeleteCookie(const net::CanonicalCookie& cc) OVERRIDE;
+  virtual void SetForceKeepSessionState() OVERRIDE;
+  virtual void Flush(const base::Closure& callback) OVERRIDE;
+
+ private:
+  virtual ~CefCoalescingCookieStore();
+
+  enum OperationType {
+    OPERATION_ADD,
+    OPERATION_UPDATE_ACCESS_TIME,
+    OPERATION_DELETE,
+    // A delete of an existing cookie followed by an add of a new cookie with
+    // the same creation time.
+    OPERATION_REPLACE,
+  };
+
+  struct PendingOperation {
+    PendingOperation(OperationType type, const net::CanonicalCookie& cc)
+        : type(type), cookie(cc) {}
+
+    OperationType type;
+    net::CanonicalCookie cookie;
+  };
+
+  // Keyed by the cookie creation time which uniquely identifies a cookie in
+  // the backing store.
+  typedef std::map<int64, PendingOperation> PendingMap;
+
+  // Record a change to |cc| and schedule a commit if necessary.
+  void AddOperation(OperationType type, const net::CanonicalCookie& cc);
+
+  // Forward all pending changes to the backing store and flush it to disk.
+  // |callback| will be executed when the flush completes.
+  void Commit(const base::Closure& callback);
+
+  // Called when the commit interval elapses.
+  void OnCommitTimer();
+
+  scoped_refptr<net::CookieMonster::PersistentCookieStore> store_;
+  const int commit_interval_ms_;
+  const size_t commit_batch_size_;
+
+  // Only accessed on the IO thread.
+  PendingMap pending_;
+  bool commit_scheduled_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefCoalescingCookieStore);
+};
+
+#endif  // CEF_LIBCEF_BROWSER_COALESCING_COOKIE_STORE_H_
@@ -13,8 +13,10 @@
 #include "libcef/browser/browser_settings.h"
 #include "libcef/browser/chrome_scheme_handler.h"
 #include "libcef/browser/context.h"
+#include "libcef/browser/render_process_groups.h"
 #include "libcef/browser/resource_dispatcher_host_delegate.h"
 #include "libcef/browser/thread_util.h"
+#include "libcef/browser/web_contents_view_osr.h"
 #include "libcef/browser/web_plugin_impl.h"
 #include "libcef/common/cef_switches.h"
 #include "libcef/common/command_line_impl.h"
@@ -247,11 +249,45 @@ content::BrowserMainParts* CefContentBrowserClient::CreateBrowserMainParts(
   return browser_main_parts_;
 }
 
+content::WebContentsView*
+    CefContentBrowserClient::OverrideCreateWebContentsView(
+        content::WebContents* web_contents,
+        content::RenderViewHostDelegateView** render_view_host_delegate_view) {
+  CefBrowserContext* browser_context =
+      static_cast<CefBrowserContext*>(web_contents->GetBrowserContext());
+  if (!browser_context->use_osr_next_contents_view())
+    return NULL;
+
+  // Only the WebContents that is currently being created is affected.
+  browser_context->set_use_osr_next_contents_view(false);
+
+  CefWebContentsViewOSR* view = new CefWebContentsViewOSR(web_contents);
+  *render_view_host_delegate_view = view;
+  return view;
+}
+
 void CefContentBrowserClient::RenderProcessHostCreated(
     content::RenderProcessHost* host) {
   host->GetChannel()->AddFilter(new CefBrowserMessageFilter(host));
 }
 
+bool CefContentBrowserClient::IsSuitableHost(
+    content::RenderProcessHost* process_host,
+    const GURL& site_url) {
+  CefRenderProcessGroups* groups = _Context->GetRenderProcessGroups();
+  if (groups)
+    return groups->IsSuitableHost(process_host);
+  return true;
+}
+
+bool CefContentBrowserClient::ShouldTryToUseExistingProcessHost(
+    content::BrowserContext* browser_context, const GURL& url) {
+  CefRenderProcessGroups* groups = _Context->GetRenderProcessGroups();
+  if (groups)
+    return groups->ShouldTryToUseExistingProcessHost();
+  return false;
+}
+
 void CefContentBrowserClient::AppendExtraCommandLineSwitches(
     CommandLine* command_line, int child_process_id) {
   const CommandLine& browser_cmd = *CommandLine::ForCurrentProcess();
@@ -329,6 +365,15 @@ void CefContentBrowserClient::OverrideWebkitPrefs(
 
   // Populate WebPreferences based on CefBrowserSettings.
   BrowserToWebSettings(browser->settings(), *prefs);
+
+  if (browser->IsWindowRenderingDisabled()) {
+    // Off-screen browsers are painted in software using the backing store.
+    // Accelerated content would be drawn to a surface that is never displayed.
+    prefs->accelerated_compositing_enabled = false;
+    prefs->accelerated_2d_canvas_enabled = false;
+    prefs->accelerated_painting_enabled = false;
+    prefs->experimental_webgl_enabled = false;
+  }
 }
 
 void CefContentBrowserClient::BrowserURLHandlerCreated(
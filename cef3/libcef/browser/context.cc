@@ -8,10 +8,13 @@
 #include "libcef/browser/browser_main.h"
 #include "libcef/browser/browser_message_loop.h"
 #include "libcef/browser/content_browser_client.h"
+#include "libcef/browser/render_process_groups.h"
+#include "libcef/browser/render_process_pool.h"
 #include "libcef/browser/scheme_registration.h"
 #include "libcef/browser/thread_util.h"
 #include "libcef/browser/trace_subscriber.h"
 #include "libcef/common/main_delegate.h"
+#include "libcef/common/worker_pool.h"
 
 #include "base/bind.h"
 #include "base/command_line.h"
@@ -168,7 +171,8 @@ CefContext::CefContext()
   : initialized_(false),
     shutting_down_(false),
     init_thread_id_(0),
-    next_browser_id_(kNextBrowserIdReset) {
+    next_browser_id_(kNextBrowserIdReset),
+    first_browser_load_recorded_(false) {
 }
 
 CefContext::~CefContext() {
@@ -179,26 +183,31 @@ CefContext::~CefContext() {
 bool CefContext::Initialize(const CefMainArgs& args,
                             const CefSettings& settings,
                             CefRefPtr<CefApp> application) {
+  CefScopedStartupPhase initialize_phase("CefInitialize");
+
   init_thread_id_ = base::PlatformThread::CurrentId();
   settings_ = settings;
 
-  cache_path_ = FilePath(CefString(&settings.cache_path));
-  if (!cache_path_.empty() &&
-      !file_util::DirectoryExists(cache_path_) &&
-      !file_util::CreateDirectory(cache_path_)) {
-    NOTREACHED() << "The cache_path directory could not be created";
-    cache_path_ = FilePath();
-  }
-  if (cache_path_.empty()) {
-    // Create and use a temporary directory.
-    if (cache_temp_dir_.CreateUniqueTempDir()) {
-      cache_path_ = cache_temp_dir_.path();
-    } else {
-      NOTREACHED() << "Failed to create temporary cache_path directory";
+  {
+    CefScopedStartupPhase phase("CreateCacheDirectory");
+    cache_path_ = FilePath(CefString(&settings.cache_path));
+    if (!cache_path_.empty() &&
+        !file_util::DirectoryExists(cache_path_) &&
+        !file_util::CreateDirectory(cache_path_)) {
+      NOTREACHED() << "The cache_path directory could not be created";
+      cache_path_ = FilePath();
+    }
+    if (cache_path_.empty()) {
+      // Create and use a temporary directory.
+      if (cache_temp_dir_.CreateUniqueTempDir()) {
+        cache_path_ = cache_temp_dir_.path();
+      } else {
+        NOTREACHED() << "Failed to create temporary cache_path directory";
+      }
     }
   }
 
-#if !defined(OS_WIN)
+#if defined(OS_MACOSX)
   if (settings.multi_threaded_message_loop) {
     NOTIMPLEMENTED() << "multi_threaded_message_loop is not supported.";
     return false;
@@ -211,17 +220,20 @@ bool CefContext::Initialize(const CefMainArgs& args,
   int exit_code;
 
   // Initialize the content runner.
+  {
+    CefScopedStartupPhase phase("ContentMainRunner::Initialize");
 #if defined(OS_WIN)
-  sandbox::SandboxInterfaceInfo sandbox_info = {0};
-  content::InitializeSandboxInfo(&sandbox_info);
+    sandbox::SandboxInterfaceInfo sandbox_info = {0};
+    content::InitializeSandboxInfo(&sandbox_info);
 
-  exit_code = main_runner_->Initialize(args.instance, &sandbox_info,
-                                       main_delegate_.get());
+    exit_code = main_runner_->Initialize(args.instance, &sandbox_info,
+                                         main_delegate_.get());
 #else
-  exit_code = main_runner_->Initialize(args.argc,
-                                       const_cast<const char**>(args.argv),
-                                       main_delegate_.get());
+    exit_code = main_runner_->Initialize(args.argc,
+                                         const_cast<const char**>(args.argv),
+                                         main_delegate_.get());
 #endif
+  }
 
   DCHECK_LT(exit_code, 0);
   if (exit_code >= 0)
@@ -229,7 +241,10 @@ bool CefContext::Initialize(const CefMainArgs& args,
 
   // Run the process. Results in a call to CefMainDelegate::RunProcess() which
   // will create the browser runner and message loop without blocking.
-  exit_code = main_runner_->Run();
+  {
+    CefScopedStartupPhase phase("ContentMainRunner::Run");
+    exit_code = main_runner_->Run();
+  }
 
   initialized_ = true;
 
@@ -245,6 +260,11 @@ void CefContext::Shutdown() {
 
   shutting_down_ = true;
 
+  // Stop the worker threads while the browser threads still exist so that
+  // running worker tasks can finish. Worker tasks that have not started are
+  // discarded.
+  CefWorkerPool::GetInstance()->Shutdown();
+
   if (settings_.multi_threaded_message_loop) {
     // Events that will be used to signal when shutdown is complete. Start in
     // non-signaled mode so that the event will block.
@@ -366,12 +386,89 @@ CefTraceSubscriber* CefContext::GetTraceSubscriber() {
   return trace_subscriber_.get();
 }
 
+void CefContext::OnStartupPhases(
+    CefProcessId process,
+    const CefStartupTimeline::PhaseList& phases) {
+  if (!CEF_CURRENTLY_ON_UIT()) {
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefContext::OnStartupPhases, this, process, phases));
+    return;
+  }
+
+  if (shutting_down_)
+    return;
+  CefRefPtr<CefApp> app = application();
+  if (!app.get())
+    return;
+  CefRefPtr<CefBrowserProcessHandler> handler = app->GetBrowserProcessHandler();
+  if (!handler.get())
+    return;
+
+  const base::TimeTicks origin = CefStartupTimeline::GetInstance()->origin();
+  CefStartupTimeline::PhaseList::const_iterator it = phases.begin();
+  for (; it != phases.end(); ++it) {
+    if (it->inherited &&
+        !inherited_phases_.insert(
+            std::make_pair(it->process_id, it->name)).second) {
+      continue;
+    }
+    handler->OnStartupPhase(process, it->name,
+                            (it->start_time - origin).InMicroseconds(),
+                            (it->end_time - it->start_time).InMicroseconds());
+  }
+}
+
+void CefContext::OnBrowserCreated() {
+  CEF_REQUIRE_UIT();
+  if (first_browser_create_time_.is_null())
+    first_browser_create_time_ = base::TimeTicks::Now();
+}
+
+void CefContext::OnMainFrameLoadEnd() {
+  CEF_REQUIRE_UIT();
+  if (first_browser_load_recorded_ || first_browser_create_time_.is_null())
+    return;
+
+  first_browser_load_recorded_ = true;
+  CefStartupTimeline::GetInstance()->AddPhase("FirstBrowserLoad",
+      first_browser_create_time_, base::TimeTicks::Now());
+}
+
+CefRenderProcessPool* CefContext::GetRenderProcessPool() {
+  CEF_REQUIRE_UIT();
+  if (shutting_down_)
+    return NULL;
+  return render_process_pool_.get();
+}
+
+CefRenderProcessGroups* CefContext::GetRenderProcessGroups() {
+  CEF_REQUIRE_UIT();
+  if (shutting_down_)
+    return NULL;
+  return render_process_groups_.get();
+}
+
 void CefContext::OnContextInitialized() {
   CEF_REQUIRE_UIT();
 
   // Register internal scheme handlers.
   scheme::RegisterInternalHandlers();
 
+  // Report browser process startup phases to the handler.
+  CefStartupTimeline::GetInstance()->SetDelegate(
+      base::Bind(&CefContext::OnStartupPhases, this, PID_BROWSER));
+
+  if (!settings_.single_process)
+    render_process_groups_.reset(new CefRenderProcessGroups());
+
+  // Launch spare render processes.
+  if (settings_.spare_render_process_count > 0 && !settings_.single_process) {
+    render_process_pool_.reset(
+        new CefRenderProcessPool(browser_context(),
+                                 settings_.spare_render_process_count));
+    render_process_pool_->Fill();
+  }
+
   // Notify the handler.
   CefRefPtr<CefApp> app = application();
   if (app.get()) {
@@ -406,6 +503,16 @@ void CefContext::FinishShutdownOnUIThread(
   if (trace_subscriber_.get())
     trace_subscriber_.reset(NULL);
 
+  if (render_process_pool_.get())
+    render_process_pool_.reset(NULL);
+
+  if (render_process_groups_.get())
+    render_process_groups_.reset(NULL);
+
+  // Release the reference held by the startup timeline delegate.
+  CefStartupTimeline::GetInstance()->SetDelegate(
+      CefStartupTimeline::Delegate());
+
   if (uithread_shutdown_event)
     uithread_shutdown_event->Signal();
 }
@@ -8,10 +8,13 @@
 
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <utility>
 
 #include "include/cef_app.h"
 #include "include/cef_base.h"
+#include "libcef/common/startup_timeline.h"
 
 #include "base/file_path.h"
 #include "base/memory/scoped_ptr.h"
@@ -30,6 +33,8 @@ class CefBrowserContext;
 class CefBrowserHostImpl;
 class CefDevToolsDelegate;
 class CefMainDelegate;
+class CefRenderProcessGroups;
+class CefRenderProcessPool;
 class CefTraceSubscriber;
 
 class CefContext : public CefBase {
@@ -72,6 +77,25 @@ class CefContext : public CefBase {
 
   CefTraceSubscriber* GetTraceSubscriber();
 
+  // Returns the pool of spare render processes or NULL if the pool is disabled
+  // or the context is shutting down. Must be called on the UI thread.
+  CefRenderProcessPool* GetRenderProcessPool();
+
+  // Returns the render process groups or NULL if running in single-process
+  // mode or the context is shutting down. Must be called on the UI thread.
+  CefRenderProcessGroups* GetRenderProcessGroups();
+
+  // Notify the browser process handler of completed startup phases. May be
+  // called on any thread.
+  void OnStartupPhases(CefProcessId process,
+                       const CefStartupTimeline::PhaseList& phases);
+
+  // Record the time from the first browser creation until the first main frame
+  // load completes as the FirstBrowserLoad startup phase. Must be called on the
+  // UI thread.
+  void OnBrowserCreated();
+  void OnMainFrameLoadEnd();
+
  private:
   void OnContextInitialized();
 
@@ -99,9 +123,21 @@ class CefContext : public CefBase {
   // Used for assigning unique IDs to browser instances.
   int next_browser_id_;
 
+  // Creation time of the first browser. Only accessed on the UI thread.
+  base::TimeTicks first_browser_create_time_;
+  bool first_browser_load_recorded_;
+
+  // Render process phases that were recorded in another process, keyed by the
+  // recording process ID and phase name. Phases recorded in the zygote process
+  // are sent by every render process forked from it and are only reported
+  // once. Only accessed on the UI thread.
+  std::set<std::pair<base::ProcessId, std::string> > inherited_phases_;
+
   scoped_ptr<CefMainDelegate> main_delegate_;
   scoped_ptr<content::ContentMainRunner> main_runner_;
   scoped_ptr<CefTraceSubscriber> trace_subscriber_;
+  scoped_ptr<CefRenderProcessGroups> render_process_groups_;
+  scoped_ptr<CefRenderProcessPool> render_process_pool_;
 
   IMPLEMENT_REFCOUNTING(CefContext);
   IMPLEMENT_LOCKING(CefContext);
@@ -4,11 +4,13 @@
 
 #include "libcef/browser/cookie_manager_impl.h"
 
+#include <algorithm>
 #include <set>
 #include <string>
 #include <vector>
 
 #include "libcef/browser/browser_context.h"
+#include "libcef/browser/coalescing_cookie_store.h"
 #include "libcef/browser/context.h"
 #include "libcef/browser/thread_util.h"
 #include "libcef/browser/url_request_context_getter.h"
@@ -17,9 +19,10 @@
 #include "base/bind.h"
 #include "base/file_util.h"
 #include "base/format_macros.h"
+#include "base/hash_tables.h"
 #include "base/logging.h"
+#include "base/string_util.h"
 #include "base/threading/thread_restrictions.h"
-#include "chrome/browser/net/sqlite_persistent_cookie_store.h"
 #include "googleurl/src/gurl.h"
 #include "net/cookies/cookie_util.h"
 #include "net/cookies/parsed_cookie.h"
@@ -27,6 +30,16 @@
 
 namespace {
 
+// Commit pending changes for |cookie_monster| to its backing store, if any.
+void FlushCookieMonster(scoped_refptr<net::CookieMonster> cookie_monster) {
+  if (CEF_CURRENTLY_ON_IOT()) {
+    cookie_monster->FlushStore(base::Closure());
+  } else {
+    // Execute on the IO thread.
+    CEF_POST_TASK(CEF_IOT, base::Bind(&FlushCookieMonster, cookie_monster));
+  }
+}
+
 // Callback class for visiting cookies.
 class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
  public:
@@ -63,6 +76,143 @@ class VisitCookiesCallback : public base::RefCounted<VisitCookiesCallback> {
   CefRefPtr<CefCookieVisitor> visitor_;
 };
 
+// Hashed lookup table for matching cookie domains against a set of requested
+// domains. A cookie matches if its domain is one of the requested domains or a
+// subdomain of one. net::CookieMonster has no public lookup by domain so every
+// cookie is still visited once, but the cost of each match depends only on the
+// number of labels in the cookie domain and not on the number of requested
+// domains.
+class CookieDomainMatcher {
+ public:
+  explicit CookieDomainMatcher(const std::vector<CefString>& domains) {
+    std::vector<CefString>::const_iterator it = domains.begin();
+    for (; it != domains.end(); ++it) {
+      std::string domain = StringToLowerASCII(it->ToString());
+      if (!domain.empty() && domain[0] == '.')
+        domain.erase(0, 1);
+      if (!domain.empty())
+        domains_.insert(domain);
+    }
+  }
+
+  bool empty() const { return domains_.empty(); }
+
+  bool Matches(const std::string& cookie_domain) const {
+    // Canonical cookie domains are already lowercase. Test the domain and then
+    // each parent domain in turn.
+    size_t pos = (!cookie_domain.empty() && cookie_domain[0] == '.') ? 1 : 0;
+    while (pos < cookie_domain.size()) {
+      if (domains_.find(cookie_domain.substr(pos)) != domains_.end())
+        return true;
+      pos = cookie_domain.find('.', pos);
+      if (pos == std::string::npos)
+        break;
+      ++pos;
+    }
+    return false;
+  }
+
+ private:
+  base::hash_set<std::string> domains_;
+};
+
+// Callback class for visiting cookies in batches.
+class VisitCookieBatchesCallback
+    : public base::RefCounted<VisitCookieBatchesCallback> {
+ public:
+  VisitCookieBatchesCallback(const std::vector<CefString>& domains,
+                             int batch_size,
+                             CefRefPtr<CefCookieBatchVisitor> visitor)
+    : matcher_(domains),
+      batch_size_(batch_size),
+      visitor_(visitor) {
+  }
+
+  void Run(const net::CookieList& list) {
+    CEF_REQUIRE_IOT();
+
+    std::vector<const net::CanonicalCookie*> matches;
+    matches.reserve(list.size());
+
+    net::CookieList::const_iterator it = list.begin();
+    for (; it != list.end(); ++it) {
+      if (matcher_.empty() || matcher_.Matches(it->Domain()))
+        matches.push_back(&(*it));
+    }
+
+    const int total = static_cast<int>(matches.size());
+    const int batch_size = batch_size_ > 0 ? batch_size_ : total;
+
+    std::vector<CefCookie> batch;
+    for (int offset = 0; offset < total; offset += batch_size) {
+      const int count = std::min(batch_size, total - offset);
+      batch.resize(count);
+      for (int i = 0; i < count; ++i)
+        CefCookieManagerImpl::GetCefCookie(*matches[offset + i], batch[i]);
+
+      if (!visitor_->VisitBatch(batch, offset, total))
+        break;
+    }
+  }
+
+ private:
+  CookieDomainMatcher matcher_;
+  int batch_size_;
+  CefRefPtr<CefCookieBatchVisitor> visitor_;
+};
+
+// Callback class for deleting the cookies that belong to a set of domains.
+class DeleteDomainCookiesCallback
+    : public base::RefCounted<DeleteDomainCookiesCallback> {
+ public:
+  DeleteDomainCookiesCallback(net::CookieMonster* cookie_monster,
+                              const std::vector<CefString>& domains)
+    : cookie_monster_(cookie_monster),
+      matcher_(domains) {
+  }
+
+  void Run(const net::CookieList& list) {
+    CEF_REQUIRE_IOT();
+
+    net::CookieList::const_iterator it = list.begin();
+    for (; it != list.end(); ++it) {
+      if (matcher_.Matches(it->Domain())) {
+        cookie_monster_->DeleteCanonicalCookieAsync(*it,
+            net::CookieMonster::DeleteCookieCallback());
+      }
+    }
+  }
+
+ private:
+  scoped_refptr<net::CookieMonster> cookie_monster_;
+  CookieDomainMatcher matcher_;
+};
+
+// Execute the completion handler on the IO thread. The backing store may run
+// the flush callback on a different thread.
+void RunCompletionOnIOThread(CefRefPtr<CefCompletionHandler> handler) {
+  if (!handler.get())
+    return;
+  CEF_POST_TASK(CEF_IOT,
+      base::Bind(&CefCompletionHandler::OnComplete, handler));
+}
+
+// Returns the URL that will be used when setting |cookie| without an explicit
+// URL.
+GURL GetCookieUrl(const CefCookie& cookie) {
+  std::string domain = CefString(&cookie.domain).ToString();
+  if (!domain.empty() && domain[0] == '.')
+    domain.erase(0, 1);
+  if (domain.empty())
+    return GURL();
+
+  std::string path = CefString(&cookie.path).ToString();
+  if (path.empty() || path[0] != '/')
+    path.insert(0, "/");
+
+  return GURL((cookie.secure ? "https://" : "http://") + domain + path);
+}
+
 
 // Methods extracted from net/cookies/cookie_monster.cc
 
@@ -81,10 +231,15 @@ bool GetCookieDomain(const GURL& url,
 
 
 CefCookieManagerImpl::CefCookieManagerImpl(bool is_global)
-  : is_global_(is_global) {
+  : is_global_(is_global),
+    commit_policy_(_Context->settings()) {
 }
 
 CefCookieManagerImpl::~CefCookieManagerImpl() {
+  // The cookie store does not commit pending changes on destruction. The
+  // global cookie store is flushed by the request context on shutdown.
+  if (cookie_monster_ && !is_global_)
+    FlushCookieMonster(cookie_monster_);
 }
 
 void CefCookieManagerImpl::Initialize(const CefString& path) {
@@ -202,18 +357,7 @@ bool CefCookieManagerImpl::SetCookie(const CefString& url,
   if (!gurl.is_valid())
     return false;
 
-  std::string name = CefString(&cookie.name).ToString();
-  std::string value = CefString(&cookie.value).ToString();
-  std::string domain = CefString(&cookie.domain).ToString();
-  std::string path = CefString(&cookie.path).ToString();
-
-  base::Time expiration_time;
-  if (cookie.has_expires)
-    cef_time_to_basetime(cookie.expires, expiration_time);
-
-  cookie_monster_->SetCookieWithDetailsAsync(gurl, name, value, domain, path,
-      expiration_time, cookie.secure, cookie.httponly,
-      net::CookieStore::SetCookiesCallback());
+  SetCookieInternal(gurl, cookie);
   return true;
 }
 
@@ -245,6 +389,88 @@ bool CefCookieManagerImpl::DeleteCookies(const CefString& url,
   return true;
 }
 
+bool CefCookieManagerImpl::SetCookies(const CefString& url,
+                                      const std::vector<CefCookie>& cookies) {
+  if (CEF_CURRENTLY_ON_IOT()) {
+    if (!cookie_monster_)
+      return false;
+
+    GURL gurl;
+    if (!url.empty()) {
+      gurl = GURL(url.ToString());
+      if (!gurl.is_valid())
+        return false;
+    }
+
+    std::vector<CefCookie>::const_iterator it = cookies.begin();
+    for (; it != cookies.end(); ++it) {
+      if (url.empty()) {
+        GURL cookie_url = GetCookieUrl(*it);
+        if (cookie_url.is_valid())
+          SetCookieInternal(cookie_url, *it);
+      } else {
+        SetCookieInternal(gurl, *it);
+      }
+    }
+  } else {
+    // Execute on the IO thread.
+    CEF_POST_TASK(CEF_IOT,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::SetCookies),
+                   this, url, cookies));
+  }
+
+  return true;
+}
+
+bool CefCookieManagerImpl::DeleteDomainCookies(
+    const std::vector<CefString>& domains) {
+  if (domains.empty())
+    return false;
+
+  if (CEF_CURRENTLY_ON_IOT()) {
+    if (!cookie_monster_)
+      return false;
+
+    scoped_refptr<DeleteDomainCookiesCallback> callback(
+        new DeleteDomainCookiesCallback(cookie_monster_, domains));
+
+    cookie_monster_->GetAllCookiesAsync(
+        base::Bind(&DeleteDomainCookiesCallback::Run, callback.get()));
+  } else {
+    // Execute on the IO thread.
+    CEF_POST_TASK(CEF_IOT,
+        base::Bind(
+            base::IgnoreResult(&CefCookieManagerImpl::DeleteDomainCookies),
+            this, domains));
+  }
+
+  return true;
+}
+
+bool CefCookieManagerImpl::VisitDomainCookies(
+    const std::vector<CefString>& domains,
+    int batch_size,
+    CefRefPtr<CefCookieBatchVisitor> visitor) {
+  if (CEF_CURRENTLY_ON_IOT()) {
+    if (!cookie_monster_)
+      return false;
+
+    scoped_refptr<VisitCookieBatchesCallback> callback(
+        new VisitCookieBatchesCallback(domains, batch_size, visitor));
+
+    cookie_monster_->GetAllCookiesAsync(
+        base::Bind(&VisitCookieBatchesCallback::Run, callback.get()));
+  } else {
+    // Execute on the IO thread.
+    CEF_POST_TASK(CEF_IOT,
+        base::Bind(
+            base::IgnoreResult(&CefCookieManagerImpl::VisitDomainCookies),
+            this, domains, batch_size, visitor));
+  }
+
+  return true;
+}
+
 bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
   if (CEF_CURRENTLY_ON_IOT()) {
     FilePath new_path;
@@ -268,7 +494,7 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
       return true;
     }
 
-    scoped_refptr<SQLitePersistentCookieStore> persistent_store;
+    scoped_refptr<net::CookieMonster::PersistentCookieStore> persistent_store;
     if (!new_path.empty()) {
       // TODO(cef): Move directory creation to the blocking pool instead of
       // allowing file IO on this thread.
@@ -277,16 +503,20 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
           file_util::CreateDirectory(new_path)) {
         const FilePath& cookie_path = new_path.AppendASCII("Cookies");
         persistent_store =
-            new SQLitePersistentCookieStore(cookie_path, false, NULL);
+            CefCoalescingCookieStore::CreateForPath(cookie_path,
+                                                    commit_policy_);
       } else {
         NOTREACHED() << "The cookie storage directory could not be created";
         storage_path_.clear();
       }
     }
 
-    // Set the new cookie store that will be used for all new requests. The old
-    // cookie store, if any, will be automatically flushed and closed when no
-    // longer referenced.
+    // Commit pending changes for the old cookie store, if any. It will be
+    // closed when no longer referenced.
+    if (cookie_monster_)
+      cookie_monster_->FlushStore(base::Closure());
+
+    // Set the new cookie store that will be used for all new requests.
     cookie_monster_ = new net::CookieMonster(persistent_store.get(), NULL);
     storage_path_ = new_path;
 
@@ -302,6 +532,45 @@ bool CefCookieManagerImpl::SetStoragePath(const CefString& path) {
   return true;
 }
 
+bool CefCookieManagerImpl::SetCommitPolicy(int commit_interval,
+                                           int commit_batch_size,
+                                           bool deferred_commit) {
+  // The global cookie store always uses the CefSettings policy.
+  if (is_global_)
+    return false;
+
+  if (CEF_CURRENTLY_ON_IOT()) {
+    commit_policy_.commit_interval = commit_interval;
+    commit_policy_.commit_batch_size = commit_batch_size;
+    commit_policy_.deferred_commit = deferred_commit;
+  } else {
+    // Execute on the IO thread.
+    CEF_POST_TASK(CEF_IOT,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::SetCommitPolicy),
+                   this, commit_interval, commit_batch_size, deferred_commit));
+  }
+
+  return true;
+}
+
+bool CefCookieManagerImpl::FlushStore(
+    CefRefPtr<CefCompletionHandler> handler) {
+  if (CEF_CURRENTLY_ON_IOT()) {
+    if (!cookie_monster_)
+      return false;
+
+    cookie_monster_->FlushStore(
+        base::Bind(&RunCompletionOnIOThread, handler));
+  } else {
+    // Execute on the IO thread.
+    CEF_POST_TASK(CEF_IOT,
+        base::Bind(base::IgnoreResult(&CefCookieManagerImpl::FlushStore),
+                   this, handler));
+  }
+
+  return true;
+}
+
 void CefCookieManagerImpl::SetGlobal() {
   if (CEF_CURRENTLY_ON_IOT()) {
     if (_Context->browser_context()) {
@@ -315,6 +584,24 @@ void CefCookieManagerImpl::SetGlobal() {
   }
 }
 
+void CefCookieManagerImpl::SetCookieInternal(const GURL& url,
+                                             const CefCookie& cookie) {
+  CEF_REQUIRE_IOT();
+
+  std::string name = CefString(&cookie.name).ToString();
+  std::string value = CefString(&cookie.value).ToString();
+  std::string domain = CefString(&cookie.domain).ToString();
+  std::string path = CefString(&cookie.path).ToString();
+
+  base::Time expiration_time;
+  if (cookie.has_expires)
+    cef_time_to_basetime(cookie.expires, expiration_time);
+
+  cookie_monster_->SetCookieWithDetailsAsync(url, name, value, domain, path,
+      expiration_time, cookie.secure, cookie.httponly,
+      net::CookieStore::SetCookiesCallback());
+}
+
 // static
 bool CefCookieManagerImpl::GetCefCookie(const net::CanonicalCookie& cc,
                                         CefCookie& cookie) {
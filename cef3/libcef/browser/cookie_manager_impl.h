@@ -6,6 +6,7 @@
 #define CEF_LIBCEF_BROWSER_COOKIE_MANAGER_IMPL_H_
 
 #include "include/cef_cookie.h"
+#include "libcef/browser/coalescing_cookie_store.h"
 #include "base/file_path.h"
 #include "net/cookies/cookie_monster.h"
 
@@ -28,7 +29,18 @@ class CefCookieManagerImpl : public CefCookieManager {
                          const CefCookie& cookie) OVERRIDE;
   virtual bool DeleteCookies(const CefString& url,
                              const CefString& cookie_name) OVERRIDE;
+  virtual bool SetCookies(const CefString& url,
+                          const std::vector<CefCookie>& cookies) OVERRIDE;
+  virtual bool DeleteDomainCookies(const std::vector<CefString>& domains)
+      OVERRIDE;
+  virtual bool VisitDomainCookies(const std::vector<CefString>& domains,
+                                  int batch_size,
+                                  CefRefPtr<CefCookieBatchVisitor> visitor)
+      OVERRIDE;
   virtual bool SetStoragePath(const CefString& path) OVERRIDE;
+  virtual bool SetCommitPolicy(int commit_interval, int commit_batch_size,
+                               bool deferred_commit) OVERRIDE;
+  virtual bool FlushStore(CefRefPtr<CefCompletionHandler> handler) OVERRIDE;
 
   net::CookieMonster* cookie_monster() { return cookie_monster_; }
 
@@ -39,9 +51,13 @@ class CefCookieManagerImpl : public CefCookieManager {
  private:
   void SetGlobal();
 
+  // Set a single cookie. Must be called on the IO thread.
+  void SetCookieInternal(const GURL& url, const CefCookie& cookie);
+
   scoped_refptr<net::CookieMonster> cookie_monster_;
   bool is_global_;
   FilePath storage_path_;
+  CefCoalescingCookieStore::Policy commit_policy_;
   std::vector<CefString> supported_schemes_;
 
   IMPLEMENT_REFCOUNTING(CefCookieManagerImpl);
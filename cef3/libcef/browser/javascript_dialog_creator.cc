@@ -107,6 +107,12 @@ void CefJavaScriptDialogCreator::RunJavaScriptDialog(
     }
   }
 
+  if (browser_->IsWindowRenderingDisabled()) {
+    // Native dialogs require a browser window.
+    *did_suppress_message = true;
+    return;
+  }
+
 #if defined(OS_MACOSX) || defined(OS_WIN) || defined(TOOLKIT_GTK)
   *did_suppress_message = false;
 
@@ -153,6 +159,12 @@ void CefJavaScriptDialogCreator::RunBeforeUnloadDialog(
     }
   }
 
+  if (browser_->IsWindowRenderingDisabled()) {
+    // Native dialogs require a browser window. Allow the navigation.
+    callback.Run(true, string16());
+    return;
+  }
+
 #if defined(OS_MACOSX) || defined(OS_WIN) || defined(TOOLKIT_GTK)
   if (dialog_.get()) {
     // Seriously!?
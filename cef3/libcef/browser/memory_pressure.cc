@@ -0,0 +1,130 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/browser/memory_pressure.h"
+
+#include <map>
+#include <vector>
+
+#include "libcef/browser/thread_util.h"
+#include "libcef/common/cef_messages.h"
+
+#include "base/lazy_instance.h"
+#include "content/public/browser/notification_observer.h"
+#include "content/public/browser/notification_registrar.h"
+#include "content/public/browser/notification_service.h"
+#include "content/public/browser/notification_source.h"
+#include "content/public/browser/notification_types.h"
+#include "content/public/browser/render_process_host.h"
+
+namespace {
+
+// Class that tracks memory pressure requests that are waiting for a response
+// from a render process.
+class CefMemoryPressureManager : public content::NotificationObserver {
+ public:
+  CefMemoryPressureManager()
+      : next_request_id_(0) {
+  }
+
+  void Send(content::RenderProcessHost* host,
+            cef_memory_pressure_level_t level,
+            CefRefPtr<CefMemoryPressureCallback> callback) {
+    CEF_REQUIRE_UIT();
+
+    // Request ID 0 means that the caller does not expect a response.
+    int request_id = 0;
+    if (callback.get()) {
+      if (registrar_.IsEmpty()) {
+        registrar_.Add(this, content::NOTIFICATION_RENDERER_PROCESS_CLOSED,
+            content::NotificationService::AllBrowserContextsAndSources());
+      }
+
+      request_id = ++next_request_id_;
+      PendingRequest request;
+      request.render_process_id = host->GetID();
+      request.callback = callback;
+      pending_requests_.insert(std::make_pair(request_id, request));
+    }
+
+    if (!host->Send(new CefProcessMsg_MemoryPressure(request_id, level)) &&
+        request_id != 0) {
+      // The render process is not running.
+      pending_requests_.erase(request_id);
+      callback->OnMemoryReleased(-1);
+    }
+  }
+
+  void OnMemoryReleased(int render_process_id,
+                        int request_id,
+                        int64 bytes_freed) {
+    CEF_REQUIRE_UIT();
+
+    PendingRequestMap::iterator it = pending_requests_.find(request_id);
+    if (it == pending_requests_.end() ||
+        it->second.render_process_id != render_process_id) {
+      return;
+    }
+
+    CefRefPtr<CefMemoryPressureCallback> callback = it->second.callback;
+    pending_requests_.erase(it);
+    callback->OnMemoryReleased(bytes_freed);
+  }
+
+ private:
+  struct PendingRequest {
+    int render_process_id;
+    CefRefPtr<CefMemoryPressureCallback> callback;
+  };
+
+  // Map of request ID to pending request.
+  typedef std::map<int, PendingRequest> PendingRequestMap;
+
+  // content::NotificationObserver methods.
+  virtual void Observe(int type,
+                       const content::NotificationSource& source,
+                       const content::NotificationDetails& details) OVERRIDE {
+    DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CLOSED);
+    int render_process_id =
+        content::Source<content::RenderProcessHost>(source)->GetID();
+
+    // The render process will never respond to these requests.
+    std::vector<CefRefPtr<CefMemoryPressureCallback> > callbacks;
+    PendingRequestMap::iterator it = pending_requests_.begin();
+    while (it != pending_requests_.end()) {
+      if (it->second.render_process_id == render_process_id) {
+        callbacks.push_back(it->second.callback);
+        pending_requests_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+
+    for (size_t i = 0; i < callbacks.size(); ++i)
+      callbacks[i]->OnMemoryReleased(-1);
+  }
+
+  int next_request_id_;
+  PendingRequestMap pending_requests_;
+  content::NotificationRegistrar registrar_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefMemoryPressureManager);
+};
+
+base::LazyInstance<CefMemoryPressureManager>::Leaky g_manager =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+void CefSendMemoryPressure(content::RenderProcessHost* host,
+                           cef_memory_pressure_level_t level,
+                           CefRefPtr<CefMemoryPressureCallback> callback) {
+  g_manager.Get().Send(host, level, callback);
+}
+
+void CefMemoryReleased(int render_process_id,
+                       int request_id,
+                       int64 bytes_freed) {
+  g_manager.Get().OnMemoryReleased(render_process_id, request_id, bytes_freed);
+}
@@ -0,0 +1,28 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_MEMORY_PRESSURE_H_
+#define CEF_LIBCEF_BROWSER_MEMORY_PRESSURE_H_
+#pragma once
+
+#include "include/cef_browser.h"
+
+namespace content {
+class RenderProcessHost;
+}
+
+// Ask the render process represented by |host| to release memory. |callback|
+// may be NULL. Must be called on the UI thread.
+void CefSendMemoryPressure(content::RenderProcessHost* host,
+                           cef_memory_pressure_level_t level,
+                           CefRefPtr<CefMemoryPressureCallback> callback);
+
+// Called when the render process identified by |render_process_id| has
+// released memory in response to the request identified by |request_id|. Must
+// be called on the UI thread.
+void CefMemoryReleased(int render_process_id,
+                       int request_id,
+                       int64 bytes_freed);
+
+#endif  // CEF_LIBCEF_BROWSER_MEMORY_PRESSURE_H_
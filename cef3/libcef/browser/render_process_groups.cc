@@ -0,0 +1,114 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/browser/render_process_groups.h"
+#include "libcef/browser/thread_util.h"
+
+#include "base/logging.h"
+#include "content/public/browser/notification_source.h"
+#include "content/public/browser/notification_service.h"
+#include "content/public/browser/notification_types.h"
+#include "content/public/browser/render_process_host.h"
+
+CefRenderProcessGroups::ScopedGroup::ScopedGroup(
+    CefRenderProcessGroups* groups,
+    const std::string& group)
+    : groups_(groups),
+      had_previous_group_(false) {
+  if (!groups_)
+    return;
+
+  had_previous_group_ = groups_->has_current_group_;
+  previous_group_ = groups_->current_group_;
+  groups_->has_current_group_ = true;
+  groups_->current_group_ = group;
+  if (!group.empty())
+    groups_->grouping_enabled_ = true;
+}
+
+CefRenderProcessGroups::ScopedGroup::~ScopedGroup() {
+  if (!groups_)
+    return;
+
+  groups_->has_current_group_ = had_previous_group_;
+  groups_->current_group_ = previous_group_;
+}
+
+CefRenderProcessGroups::CefRenderProcessGroups()
+    : grouping_enabled_(false),
+      has_current_group_(false) {
+  registrar_.Add(this, content::NOTIFICATION_RENDERER_PROCESS_CLOSED,
+                 content::NotificationService::AllBrowserContextsAndSources());
+}
+
+CefRenderProcessGroups::~CefRenderProcessGroups() {
+}
+
+bool CefRenderProcessGroups::ShouldTryToUseExistingProcessHost() const {
+  CEF_REQUIRE_UIT();
+  return has_current_group_ && !current_group_.empty();
+}
+
+bool CefRenderProcessGroups::IsSuitableHost(
+    content::RenderProcessHost* host) const {
+  CEF_REQUIRE_UIT();
+
+  if (!grouping_enabled_)
+    return true;
+
+  // Processes that have not been assigned yet, like spare processes, are never
+  // reused.
+  ProcessGroupMap::const_iterator it = process_groups_.find(host->GetID());
+  if (it == process_groups_.end())
+    return false;
+
+  // Don't risk sharing a process between groups when the group of the
+  // selecting browser is unknown.
+  if (!has_current_group_)
+    return false;
+
+  return (it->second == current_group_);
+}
+
+bool CefRenderProcessGroups::HasProcess(const std::string& group) const {
+  CEF_REQUIRE_UIT();
+
+  ProcessGroupMap::const_iterator it = process_groups_.begin();
+  for (; it != process_groups_.end(); ++it) {
+    if (it->second == group)
+      return true;
+  }
+  return false;
+}
+
+void CefRenderProcessGroups::OnProcessAssigned(
+    content::RenderProcessHost* host,
+    const std::string& group) {
+  CEF_REQUIRE_UIT();
+
+  if (!group.empty())
+    grouping_enabled_ = true;
+
+  std::pair<ProcessGroupMap::iterator, bool> result =
+      process_groups_.insert(std::make_pair(host->GetID(), group));
+  if (!result.second && result.first->second != group) {
+    // This can happen for popups that specify a different group than their
+    // opener because they share the opener's process.
+    LOG(WARNING) << "render process " << host->GetID() <<
+        " is already assigned to group \"" << result.first->second << "\"";
+  }
+}
+
+void CefRenderProcessGroups::Observe(
+    int type,
+    const content::NotificationSource& source,
+    const content::NotificationDetails& details) {
+  DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CLOSED);
+  content::RenderProcessHost* host =
+      content::Source<content::RenderProcessHost>(source).ptr();
+
+  // The host may be reused for a new process after a crash. The new process is
+  // assigned again when a view is created in it.
+  process_groups_.erase(host->GetID());
+}
@@ -0,0 +1,91 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_RENDER_PROCESS_GROUPS_H_
+#define CEF_LIBCEF_BROWSER_RENDER_PROCESS_GROUPS_H_
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "base/basictypes.h"
+#include "content/public/browser/notification_observer.h"
+#include "content/public/browser/notification_registrar.h"
+
+namespace content {
+class RenderProcessHost;
+}
+
+// Assigns render processes to the groups specified via
+// CefBrowserSettings.renderer_process_group. Content asks whether an existing
+// render process may be reused when the process limit has been reached, when
+// process-per-site is enabled or when ShouldTryToUseExistingProcessHost()
+// returns true. Only processes that belong to the group of the browser
+// selecting the process are considered suitable. All methods must be called on
+// the UI thread.
+class CefRenderProcessGroups : public content::NotificationObserver {
+ public:
+  // Identifies the group of the browser that is selecting a render process for
+  // the lifespan of this object. Scopes may be nested, in which case the
+  // previous group is restored on destruction. |groups| may be NULL.
+  class ScopedGroup {
+   public:
+    ScopedGroup(CefRenderProcessGroups* groups, const std::string& group);
+    ~ScopedGroup();
+
+   private:
+    CefRenderProcessGroups* groups_;
+    bool had_previous_group_;
+    std::string previous_group_;
+
+    DISALLOW_COPY_AND_ASSIGN(ScopedGroup);
+  };
+
+  CefRenderProcessGroups();
+  virtual ~CefRenderProcessGroups();
+
+  // Returns true if an existing render process should be reused even when the
+  // process limit has not been reached. True for browsers with a non-empty
+  // group so that browsers in the same group share a render process.
+  bool ShouldTryToUseExistingProcessHost() const;
+
+  // Returns true if |host| may be used by the browser that is currently
+  // selecting a render process.
+  bool IsSuitableHost(content::RenderProcessHost* host) const;
+
+  // Returns true if a render process has been assigned to |group|.
+  bool HasProcess(const std::string& group) const;
+
+  // Called when a browser in |group| has created a view in |host|. The first
+  // group to use a process owns it for the lifespan of the process.
+  void OnProcessAssigned(content::RenderProcessHost* host,
+                         const std::string& group);
+
+ private:
+  // Map of render process ID to group.
+  typedef std::map<int, std::string> ProcessGroupMap;
+
+  // content::NotificationObserver methods.
+  virtual void Observe(int type,
+                       const content::NotificationSource& source,
+                       const content::NotificationDetails& details) OVERRIDE;
+
+  ProcessGroupMap process_groups_;
+
+  // True once a browser with a non-empty group has been created. Until then
+  // processes are selected using the default content behavior.
+  bool grouping_enabled_;
+
+  // Group of the browser that is currently selecting a render process. When no
+  // browser is selecting a process the group is unknown and existing grouped
+  // processes are not reused.
+  bool has_current_group_;
+  std::string current_group_;
+
+  content::NotificationRegistrar registrar_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefRenderProcessGroups);
+};
+
+#endif  // CEF_LIBCEF_BROWSER_RENDER_PROCESS_GROUPS_H_
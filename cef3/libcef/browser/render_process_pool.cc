@@ -0,0 +1,152 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/browser/render_process_pool.h"
+#include "libcef/browser/context.h"
+#include "libcef/browser/thread_util.h"
+
+#include "base/logging.h"
+#include "content/public/browser/notification_source.h"
+#include "content/public/browser/notification_service.h"
+#include "content/public/browser/notification_types.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/browser/site_instance.h"
+
+CefRenderProcessPool::CefRenderProcessPool(
+    content::BrowserContext* browser_context,
+    int size)
+    : browser_context_(browser_context),
+      size_(size > 0 ? size : 0) {
+  registrar_.Add(this, content::NOTIFICATION_RENDERER_PROCESS_CLOSED,
+                 content::NotificationService::AllBrowserContextsAndSources());
+}
+
+CefRenderProcessPool::~CefRenderProcessPool() {
+  Clear();
+}
+
+void CefRenderProcessPool::Fill() {
+  CEF_REQUIRE_UIT();
+
+  while (spare_processes_.size() < size_) {
+    scoped_refptr<content::SiteInstance> site_instance =
+        content::SiteInstance::Create(browser_context_);
+    content::RenderProcessHost* host = site_instance->GetProcess();
+    if (!host->Init()) {
+      LOG(ERROR) << "failed to launch spare render process";
+      return;
+    }
+
+    SpareProcess spare;
+    spare.site_instance = site_instance;
+    spare.process_id = host->GetID();
+    spare_processes_.push_back(spare);
+  }
+}
+
+scoped_refptr<content::SiteInstance> CefRenderProcessPool::Claim() {
+  CEF_REQUIRE_UIT();
+
+  if (spare_processes_.empty())
+    return NULL;
+
+  // Prefer the process that has been initialized the longest.
+  SpareProcessList::iterator claimed = spare_processes_.begin();
+  SpareProcessList::iterator it = spare_processes_.begin();
+  for (; it != spare_processes_.end(); ++it) {
+    if (!it->ready_time.is_null() &&
+        (claimed->ready_time.is_null() ||
+         it->ready_time < claimed->ready_time)) {
+      claimed = it;
+    }
+  }
+
+  SpareProcess spare = *claimed;
+  spare_processes_.erase(claimed);
+
+  base::TimeTicks now = base::TimeTicks::Now();
+  if (spare.ready_time.is_null())
+    pending_claims_.insert(std::make_pair(spare.process_id, now));
+  else
+    NotifyClaimed(base::TimeDelta(), now - spare.ready_time);
+
+  Fill();
+
+  return spare.site_instance;
+}
+
+void CefRenderProcessPool::OnRenderThreadStarted(
+    content::RenderProcessHost* host) {
+  CEF_REQUIRE_UIT();
+
+  const int process_id = host->GetID();
+  base::TimeTicks now = base::TimeTicks::Now();
+
+  PendingClaimMap::iterator claim = pending_claims_.find(process_id);
+  if (claim != pending_claims_.end()) {
+    NotifyClaimed(now - claim->second, base::TimeDelta());
+    pending_claims_.erase(claim);
+    return;
+  }
+
+  SpareProcessList::iterator it = spare_processes_.begin();
+  for (; it != spare_processes_.end(); ++it) {
+    if (it->process_id == process_id) {
+      it->ready_time = now;
+      return;
+    }
+  }
+}
+
+void CefRenderProcessPool::Clear() {
+  CEF_REQUIRE_UIT();
+
+  SpareProcessList spare_processes;
+  spare_processes.swap(spare_processes_);
+  pending_claims_.clear();
+
+  // Spare processes have no listeners so they must be shut down explicitly.
+  SpareProcessList::iterator it = spare_processes.begin();
+  for (; it != spare_processes.end(); ++it) {
+    content::RenderProcessHost* host =
+        content::RenderProcessHost::FromID(it->process_id);
+    if (host)
+      host->Cleanup();
+  }
+}
+
+void CefRenderProcessPool::Observe(
+    int type,
+    const content::NotificationSource& source,
+    const content::NotificationDetails& details) {
+  DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CLOSED);
+
+  const int process_id =
+      content::Source<content::RenderProcessHost>(source)->GetID();
+  pending_claims_.erase(process_id);
+
+  // Remove a spare process that exited before being claimed. The pool is
+  // refilled on the next claim so that a process that repeatedly fails to
+  // start is not relaunched in a loop.
+  SpareProcessList::iterator it = spare_processes_.begin();
+  for (; it != spare_processes_.end(); ++it) {
+    if (it->process_id == process_id) {
+      spare_processes_.erase(it);
+      return;
+    }
+  }
+}
+
+void CefRenderProcessPool::NotifyClaimed(const base::TimeDelta& wait_time,
+                                         const base::TimeDelta& idle_time) {
+  CefRefPtr<CefApp> app = _Context->application();
+  if (app.get()) {
+    CefRefPtr<CefBrowserProcessHandler> handler =
+        app->GetBrowserProcessHandler();
+    if (handler.get()) {
+      handler->OnSpareRenderProcessClaimed(wait_time.InMilliseconds(),
+                                           idle_time.InMilliseconds());
+    }
+  }
+}
@@ -0,0 +1,82 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_RENDER_PROCESS_POOL_H_
+#define CEF_LIBCEF_BROWSER_RENDER_PROCESS_POOL_H_
+#pragma once
+
+#include <list>
+#include <map>
+
+#include "base/basictypes.h"
+#include "base/memory/ref_counted.h"
+#include "base/time.h"
+#include "content/public/browser/notification_observer.h"
+#include "content/public/browser/notification_registrar.h"
+
+namespace content {
+class BrowserContext;
+class RenderProcessHost;
+class SiteInstance;
+}
+
+// Pool of spare render processes that have been launched before any browser
+// needs them. Each spare process is represented by a SiteInstance that has not
+// yet been assigned a site. New browsers claim a spare SiteInstance so that
+// their first navigation uses an already initialized render process. All
+// methods must be called on the UI thread.
+class CefRenderProcessPool : public content::NotificationObserver {
+ public:
+  CefRenderProcessPool(content::BrowserContext* browser_context, int size);
+  virtual ~CefRenderProcessPool();
+
+  // Launch spare processes until the pool contains |size_| processes.
+  void Fill();
+
+  // Remove a spare SiteInstance from the pool and refill the pool. Processes
+  // that have finished initialization are preferred. Returns NULL if the pool
+  // is empty.
+  scoped_refptr<content::SiteInstance> Claim();
+
+  // Called when |host| reports that initialization is complete.
+  void OnRenderThreadStarted(content::RenderProcessHost* host);
+
+  // Terminate all spare processes that have not been claimed.
+  void Clear();
+
+ private:
+  struct SpareProcess {
+    scoped_refptr<content::SiteInstance> site_instance;
+    int process_id;
+    // Time at which the process finished initialization or null if it has not
+    // finished yet.
+    base::TimeTicks ready_time;
+  };
+  typedef std::list<SpareProcess> SpareProcessList;
+
+  // Map of claimed process ID to claim time for processes that were claimed
+  // before they finished initialization.
+  typedef std::map<int, base::TimeTicks> PendingClaimMap;
+
+  // content::NotificationObserver methods.
+  virtual void Observe(int type,
+                       const content::NotificationSource& source,
+                       const content::NotificationDetails& details) OVERRIDE;
+
+  // Notify the browser process handler that a spare process was claimed.
+  void NotifyClaimed(const base::TimeDelta& wait_time,
+                     const base::TimeDelta& idle_time);
+
+  content::BrowserContext* browser_context_;
+  const size_t size_;
+
+  SpareProcessList spare_processes_;
+  PendingClaimMap pending_claims_;
+
+  content::NotificationRegistrar registrar_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefRenderProcessPool);
+};
+
+#endif  // CEF_LIBCEF_BROWSER_RENDER_PROCESS_POOL_H_
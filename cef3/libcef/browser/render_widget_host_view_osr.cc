@@ -0,0 +1,480 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors.
+// Portions copyright (c) 2012 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "libcef/browser/render_widget_host_view_osr.h"
+#include "libcef/browser/backing_store_osr.h"
+#include "libcef/browser/browser_host_impl.h"
+#include "libcef/browser/thread_util.h"
+
+#include "content/browser/renderer_host/render_widget_host_impl.h"
+#include "content/public/browser/native_web_keyboard_event.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/WebInputEvent.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/WebScreenInfo.h"
+
+namespace {
+
+// Screen depth reported to the renderer. Off-screen contents are always
+// painted as 32-bit BGRA.
+const int kScreenDepth = 24;
+const int kScreenDepthPerComponent = 8;
+
+}  // namespace
+
+CefRenderWidgetHostViewOSR::CefRenderWidgetHostViewOSR(
+    content::RenderWidgetHost* widget)
+    : render_widget_host_(content::RenderWidgetHostImpl::From(widget)),
+      is_hidden_(false),
+      has_focus_(false) {
+  render_widget_host_->SetView(this);
+}
+
+CefRenderWidgetHostViewOSR::~CefRenderWidgetHostViewOSR() {
+}
+
+
+// RenderWidgetHostView methods.
+// -----------------------------------------------------------------------------
+
+void CefRenderWidgetHostViewOSR::InitAsChild(gfx::NativeView parent_view) {
+}
+
+content::RenderWidgetHost*
+    CefRenderWidgetHostViewOSR::GetRenderWidgetHost() const {
+  return render_widget_host_;
+}
+
+void CefRenderWidgetHostViewOSR::SetSize(const gfx::Size& size) {
+  // The size is controlled by the CefRenderHandler.
+}
+
+void CefRenderWidgetHostViewOSR::SetBounds(const gfx::Rect& rect) {
+  // The bounds are controlled by the CefRenderHandler.
+}
+
+gfx::NativeView CefRenderWidgetHostViewOSR::GetNativeView() const {
+  return NULL;
+}
+
+gfx::NativeViewId CefRenderWidgetHostViewOSR::GetNativeViewId() const {
+  return 0;
+}
+
+gfx::NativeViewAccessible
+    CefRenderWidgetHostViewOSR::GetNativeViewAccessible() {
+  return NULL;
+}
+
+void CefRenderWidgetHostViewOSR::Focus() {
+  SendFocusEvent(true);
+}
+
+bool CefRenderWidgetHostViewOSR::HasFocus() const {
+  return has_focus_;
+}
+
+bool CefRenderWidgetHostViewOSR::IsSurfaceAvailableForCopy() const {
+  // Copies are made from the backing store instead.
+  return false;
+}
+
+void CefRenderWidgetHostViewOSR::Show() {
+  WasRestored();
+}
+
+void CefRenderWidgetHostViewOSR::Hide() {
+  WasHidden();
+}
+
+bool CefRenderWidgetHostViewOSR::IsShowing() {
+  return !is_hidden_;
+}
+
+gfx::Rect CefRenderWidgetHostViewOSR::GetViewBounds() const {
+  if (!browser_.get())
+    return gfx::Rect();
+
+  CefRefPtr<CefClient> client = browser_->GetClient();
+  if (!client.get())
+    return gfx::Rect();
+
+  CefRefPtr<CefRenderHandler> handler = client->GetRenderHandler();
+  if (!handler.get())
+    return gfx::Rect();
+
+  CefRect rect;
+  if (!handler->GetViewRect(browser_.get(), rect))
+    return gfx::Rect();
+  return gfx::Rect(rect.x, rect.y, rect.width, rect.height);
+}
+
+#if defined(OS_MACOSX)
+void CefRenderWidgetHostViewOSR::SetActive(bool active) {
+}
+
+void CefRenderWidgetHostViewOSR::SetTakesFocusOnlyOnMouseDown(bool flag) {
+}
+
+void CefRenderWidgetHostViewOSR::SetWindowVisibility(bool visible) {
+}
+
+void CefRenderWidgetHostViewOSR::WindowFrameChanged() {
+}
+
+void CefRenderWidgetHostViewOSR::ShowDefinitionForSelection() {
+}
+
+bool CefRenderWidgetHostViewOSR::SupportsSpeech() const {
+  return false;
+}
+
+void CefRenderWidgetHostViewOSR::SpeakSelection() {
+}
+
+bool CefRenderWidgetHostViewOSR::IsSpeaking() const {
+  return false;
+}
+
+void CefRenderWidgetHostViewOSR::StopSpeaking() {
+}
+#endif  // defined(OS_MACOSX)
+
+#if defined(TOOLKIT_GTK)
+GdkEventButton* CefRenderWidgetHostViewOSR::GetLastMouseDown() {
+  return NULL;
+}
+
+gfx::NativeView CefRenderWidgetHostViewOSR::BuildInputMethodsGtkMenu() {
+  return NULL;
+}
+#endif  // defined(TOOLKIT_GTK)
+
+
+// RenderWidgetHostViewPort methods.
+// -----------------------------------------------------------------------------
+
+void CefRenderWidgetHostViewOSR::InitAsPopup(
+    content::RenderWidgetHostView* parent_host_view,
+    const gfx::Rect& pos) {
+  // Popup widgets are created by content using the platform view.
+  NOTREACHED();
+}
+
+void CefRenderWidgetHostViewOSR::InitAsFullscreen(
+    content::RenderWidgetHostView* reference_host_view) {
+  NOTREACHED();
+}
+
+void CefRenderWidgetHostViewOSR::WasRestored() {
+  if (!is_hidden_)
+    return;
+
+  is_hidden_ = false;
+  render_widget_host_->WasRestored();
+}
+
+void CefRenderWidgetHostViewOSR::WasHidden() {
+  if (is_hidden_)
+    return;
+
+  is_hidden_ = true;
+  render_widget_host_->WasHidden();
+}
+
+void CefRenderWidgetHostViewOSR::MovePluginWindows(
+    const gfx::Point& scroll_offset,
+    const std::vector<webkit::npapi::WebPluginGeometry>& moves) {
+  // Windowed plugins are not supported without a native view.
+}
+
+void CefRenderWidgetHostViewOSR::Blur() {
+  SendFocusEvent(false);
+}
+
+void CefRenderWidgetHostViewOSR::UpdateCursor(const WebCursor& cursor) {
+}
+
+void CefRenderWidgetHostViewOSR::SetIsLoading(bool is_loading) {
+}
+
+void CefRenderWidgetHostViewOSR::TextInputStateChanged(
+    ui::TextInputType type,
+    bool can_compose_inline) {
+}
+
+void CefRenderWidgetHostViewOSR::ImeCancelComposition() {
+}
+
+void CefRenderWidgetHostViewOSR::ImeCompositionRangeChanged(
+    const ui::Range& range,
+    const std::vector<gfx::Rect>& character_bounds) {
+}
+
+void CefRenderWidgetHostViewOSR::DidUpdateBackingStore(
+    const gfx::Rect& scroll_rect, int scroll_dx, int scroll_dy,
+    const std::vector<gfx::Rect>& copy_rects) {
+  if (is_hidden_)
+    return;
+
+  std::vector<gfx::Rect> rects(copy_rects);
+  if ((scroll_dx != 0 || scroll_dy != 0) && !scroll_rect.IsEmpty())
+    rects.push_back(scroll_rect);
+  Paint(rects);
+}
+
+void CefRenderWidgetHostViewOSR::RenderViewGone(base::TerminationStatus status,
+                                                int error_code) {
+  Destroy();
+}
+
+#if defined(OS_WIN) && !defined(USE_AURA)
+void CefRenderWidgetHostViewOSR::WillWmDestroy() {
+}
+#endif
+
+void CefRenderWidgetHostViewOSR::Destroy() {
+  // There is no native view whose destruction would delete this object.
+  delete this;
+}
+
+void CefRenderWidgetHostViewOSR::SetTooltipText(
+    const string16& tooltip_text) {
+}
+
+void CefRenderWidgetHostViewOSR::SelectionBoundsChanged(
+    const gfx::Rect& start_rect,
+    WebKit::WebTextDirection start_direction,
+    const gfx::Rect& end_rect,
+    WebKit::WebTextDirection end_direction) {
+}
+
+content::BackingStore* CefRenderWidgetHostViewOSR::AllocBackingStore(
+    const gfx::Size& size) {
+  return new CefBackingStoreOSR(render_widget_host_, size);
+}
+
+void CefRenderWidgetHostViewOSR::CopyFromCompositingSurface(
+    const gfx::Rect& src_subrect,
+    const gfx::Size& dst_size,
+    const base::Callback<void(bool)>& callback,
+    skia::PlatformCanvas* output) {
+  // There is no compositing surface. RenderWidgetHostImpl copies from the
+  // backing store instead because IsSurfaceAvailableForCopy() returns false.
+  callback.Run(false);
+}
+
+void CefRenderWidgetHostViewOSR::OnAcceleratedCompositingStateChange() {
+}
+
+void CefRenderWidgetHostViewOSR::AcceleratedSurfaceBuffersSwapped(
+    const GpuHostMsg_AcceleratedSurfaceBuffersSwapped_Params& params,
+    int gpu_host_id) {
+}
+
+void CefRenderWidgetHostViewOSR::AcceleratedSurfacePostSubBuffer(
+    const GpuHostMsg_AcceleratedSurfacePostSubBuffer_Params& params,
+    int gpu_host_id) {
+}
+
+void CefRenderWidgetHostViewOSR::AcceleratedSurfaceSuspend() {
+}
+
+bool CefRenderWidgetHostViewOSR::HasAcceleratedSurface(
+    const gfx::Size& desired_size) {
+  return false;
+}
+
+#if defined(OS_MACOSX)
+void CefRenderWidgetHostViewOSR::AboutToWaitForBackingStoreMsg() {
+}
+
+bool CefRenderWidgetHostViewOSR::PostProcessEventForPluginIme(
+    const content::NativeWebKeyboardEvent& event) {
+  return false;
+}
+
+void CefRenderWidgetHostViewOSR::PluginFocusChanged(bool focused,
+                                                    int plugin_id) {
+}
+
+void CefRenderWidgetHostViewOSR::StartPluginIme() {
+}
+
+gfx::PluginWindowHandle
+    CefRenderWidgetHostViewOSR::AllocateFakePluginWindowHandle(bool opaque,
+                                                               bool root) {
+  return gfx::kNullPluginWindow;
+}
+
+void CefRenderWidgetHostViewOSR::DestroyFakePluginWindowHandle(
+    gfx::PluginWindowHandle window) {
+}
+
+void CefRenderWidgetHostViewOSR::AcceleratedSurfaceSetIOSurface(
+    gfx::PluginWindowHandle window,
+    int32 width,
+    int32 height,
+    uint64 io_surface_identifier) {
+}
+
+void CefRenderWidgetHostViewOSR::AcceleratedSurfaceSetTransportDIB(
+    gfx::PluginWindowHandle window,
+    int32 width,
+    int32 height,
+    TransportDIB::Handle transport_dib) {
+}
+#endif  // defined(OS_MACOSX)
+
+void CefRenderWidgetHostViewOSR::GetScreenInfo(
+    WebKit::WebScreenInfo* results) {
+  gfx::Rect screen_rect = GetRootWindowBounds();
+
+  results->rect = WebKit::WebRect(screen_rect.x(), screen_rect.y(),
+                                  screen_rect.width(), screen_rect.height());
+  results->availableRect = results->rect;
+  results->depth = kScreenDepth;
+  results->depthPerComponent = kScreenDepthPerComponent;
+  results->deviceScaleFactor = 1.0f;
+}
+
+gfx::Rect CefRenderWidgetHostViewOSR::GetRootWindowBounds() {
+  if (browser_.get()) {
+    CefRefPtr<CefClient> client = browser_->GetClient();
+    if (client.get()) {
+      CefRefPtr<CefRenderHandler> handler = client->GetRenderHandler();
+      CefRect rect;
+      if (handler.get() && handler->GetRootScreenRect(browser_.get(), rect))
+        return gfx::Rect(rect.x, rect.y, rect.width, rect.height);
+    }
+  }
+
+  // Default to the view bounds.
+  return GetViewBounds();
+}
+
+gfx::GLSurfaceHandle CefRenderWidgetHostViewOSR::GetCompositingSurface() {
+  // An empty handle disables GPU compositing for this view.
+  return gfx::GLSurfaceHandle();
+}
+
+void CefRenderWidgetHostViewOSR::ProcessTouchAck(
+    WebKit::WebInputEvent::Type type,
+    bool processed) {
+}
+
+void CefRenderWidgetHostViewOSR::SetHasHorizontalScrollbar(
+    bool has_horizontal_scrollbar) {
+}
+
+void CefRenderWidgetHostViewOSR::SetScrollOffsetPinning(
+    bool is_pinned_to_left, bool is_pinned_to_right) {
+}
+
+bool CefRenderWidgetHostViewOSR::LockMouse() {
+  return false;
+}
+
+void CefRenderWidgetHostViewOSR::UnlockMouse() {
+}
+
+void CefRenderWidgetHostViewOSR::UnhandledWheelEvent(
+    const WebKit::WebMouseWheelEvent& event) {
+}
+
+void CefRenderWidgetHostViewOSR::GestureEventAck(int gesture_event_type) {
+}
+
+
+// CefRenderWidgetHostViewOSR methods.
+// -----------------------------------------------------------------------------
+
+void CefRenderWidgetHostViewOSR::SetBrowser(CefBrowserHostImpl* browser) {
+  CEF_REQUIRE_UIT();
+  browser_ = browser;
+  if (browser_.get())
+    WasResized();
+}
+
+void CefRenderWidgetHostViewOSR::WasResized() {
+  render_widget_host_->WasResized();
+}
+
+void CefRenderWidgetHostViewOSR::Invalidate(const gfx::Rect& rect) {
+  std::vector<gfx::Rect> rects;
+  rects.push_back(rect);
+  Paint(rects);
+}
+
+void CefRenderWidgetHostViewOSR::SendKeyEvent(
+    const content::NativeWebKeyboardEvent& event) {
+  render_widget_host_->ForwardKeyboardEvent(event);
+}
+
+void CefRenderWidgetHostViewOSR::SendMouseEvent(
+    const WebKit::WebMouseEvent& event) {
+  render_widget_host_->ForwardMouseEvent(event);
+}
+
+void CefRenderWidgetHostViewOSR::SendMouseWheelEvent(
+    const WebKit::WebMouseWheelEvent& event) {
+  render_widget_host_->ForwardWheelEvent(event);
+}
+
+void CefRenderWidgetHostViewOSR::SendFocusEvent(bool focus) {
+  if (has_focus_ == focus)
+    return;
+
+  has_focus_ = focus;
+  if (focus) {
+    render_widget_host_->GotFocus();
+    render_widget_host_->SetActive(true);
+  } else {
+    render_widget_host_->SetActive(false);
+    render_widget_host_->Blur();
+  }
+}
+
+void CefRenderWidgetHostViewOSR::SendCaptureLostEvent() {
+  render_widget_host_->LostCapture();
+}
+
+void CefRenderWidgetHostViewOSR::Paint(const std::vector<gfx::Rect>& rects) {
+  if (!browser_.get())
+    return;
+
+  CefRefPtr<CefClient> client = browser_->GetClient();
+  if (!client.get())
+    return;
+
+  CefRefPtr<CefRenderHandler> handler = client->GetRenderHandler();
+  if (!handler.get())
+    return;
+
+  // Don't force creation of the backing store. It will be created when the
+  // renderer sends the first update.
+  content::BackingStore* backing_store =
+      render_widget_host_->GetBackingStore(false);
+  if (!backing_store)
+    return;
+
+  CefBackingStoreOSR* backing_store_osr =
+      CefBackingStoreOSR::From(backing_store);
+  const gfx::Rect bounds(backing_store->size());
+
+  CefRenderHandler::RectList dirty_rects;
+  std::vector<gfx::Rect>::const_iterator it = rects.begin();
+  for (; it != rects.end(); ++it) {
+    gfx::Rect rect = it->Intersect(bounds);
+    if (!rect.IsEmpty()) {
+      dirty_rects.push_back(
+          CefRect(rect.x(), rect.y(), rect.width(), rect.height()));
+    }
+  }
+  if (dirty_rects.empty())
+    return;
+
+  handler->OnPaint(browser_.get(), dirty_rects,
+                   backing_store_osr->GetPixels(),
+                   bounds.width(), bounds.height());
+}
@@ -6,6 +6,7 @@
 #include "libcef/browser/resource_request_job.h"
 
 #include <map>
+#include <sstream>
 #include <vector>
 
 #include "include/cef_callback.h"
@@ -15,9 +16,13 @@
 #include "libcef/common/response_impl.h"
 
 #include "base/logging.h"
+#include "net/base/filter.h"
 #include "net/base/io_buffer.h"
 #include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
 #include "net/http/http_response_headers.h"
+#include "net/http/http_util.h"
 #include "net/url_request/url_request.h"
 #include "net/url_request/url_request_context.h"
 
@@ -123,6 +128,59 @@ class CefResourceRequestJobCallback : public CefCallback {
   IMPLEMENT_REFCOUNTING(Callback);
 };
 
+// Provides request state to the filters used for decoding response content.
+class CefResourceRequestJobFilterContext : public net::FilterContext {
+ public:
+  explicit CefResourceRequestJobFilterContext(CefResourceRequestJob* job)
+      : job_(job) {
+  }
+
+  // net::FilterContext methods.
+  virtual bool GetMimeType(std::string* mime_type) const OVERRIDE {
+    return job_->GetMimeType(mime_type);
+  }
+
+  virtual bool GetURL(GURL* gurl) const OVERRIDE {
+    if (!job_->request())
+      return false;
+    *gurl = job_->request()->url();
+    return true;
+  }
+
+  virtual base::Time GetRequestTime() const OVERRIDE {
+    return job_->request() ? job_->request()->request_time() : base::Time();
+  }
+
+  virtual bool IsCachedContent() const OVERRIDE {
+    return false;
+  }
+
+  virtual bool IsDownload() const OVERRIDE {
+    return job_->request() &&
+           (job_->request()->load_flags() & net::LOAD_IS_DOWNLOAD);
+  }
+
+  virtual bool IsSdchResponse() const OVERRIDE {
+    return false;
+  }
+
+  virtual int64 GetByteReadCount() const OVERRIDE {
+    return job_->prefilter_bytes_read();
+  }
+
+  virtual int GetResponseCode() const OVERRIDE {
+    return job_->response_.get() ? job_->response_->GetStatus() : -1;
+  }
+
+  virtual void RecordPacketStats(StatisticSelector statistic) const OVERRIDE {
+  }
+
+ private:
+  CefResourceRequestJob* job_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefResourceRequestJobFilterContext);
+};
+
 CefResourceRequestJob::CefResourceRequestJob(
     net::URLRequest* request,
     net::NetworkDelegate* network_delegate,
@@ -131,6 +189,8 @@ CefResourceRequestJob::CefResourceRequestJob(
       handler_(handler),
       remaining_bytes_(0),
       response_cookies_save_index_(0),
+      ALLOW_THIS_IN_INITIALIZER_LIST(
+          filter_context_(new CefResourceRequestJobFilterContext(this))),
       ALLOW_THIS_IN_INITIALIZER_LIST(weak_factory_(this)) {
 }
 
@@ -202,6 +262,20 @@ void CefResourceRequestJob::Kill() {
   net::URLRequestJob::Kill();
 }
 
+void CefResourceRequestJob::SetExtraRequestHeaders(
+    const net::HttpRequestHeaders& headers) {
+  std::string range_header;
+  if (headers.GetHeader(net::HttpRequestHeaders::kRange, &range_header)) {
+    // Only a single byte range is supported. Requests for multiple ranges will
+    // receive the complete response.
+    std::vector<net::HttpByteRange> ranges;
+    if (net::HttpUtil::ParseRangeHeader(range_header, &ranges) &&
+        ranges.size() == 1) {
+      byte_range_ = ranges[0];
+    }
+  }
+}
+
 bool CefResourceRequestJob::ReadRawData(net::IOBuffer* dest, int dest_size,
                                         int* bytes_read) {
   CEF_REQUIRE_IOT();
@@ -304,6 +378,26 @@ bool CefResourceRequestJob::GetMimeType(std::string* mime_type) const {
   return true;
 }
 
+net::Filter* CefResourceRequestJob::SetupFilter() const {
+  CEF_REQUIRE_IOT();
+
+  if (!response_headers_.get())
+    return NULL;
+
+  // Decode the response content if the handler specified a content encoding.
+  std::vector<net::Filter::FilterType> encoding_types;
+  std::string encoding_type;
+  void* iter = NULL;
+  while (response_headers_->EnumerateHeader(&iter, "Content-Encoding",
+                                            &encoding_type)) {
+    encoding_types.push_back(net::Filter::ConvertEncodingToType(encoding_type));
+  }
+
+  if (encoding_types.empty())
+    return NULL;
+  return net::Filter::Factory(encoding_types, *filter_context_);
+}
+
 void CefResourceRequestJob::SendHeaders() {
   CEF_REQUIRE_IOT();
 
@@ -326,6 +420,14 @@ void CefResourceRequestJob::SendHeaders() {
     redirect_url_ = GURL(redirectUrlStr);
   }
 
+  // Handlers that return a complete response of known length may be asked to
+  // skip to the start of the requested byte range.
+  if (byte_range_.IsValid() && !redirect_url_.is_valid() &&
+      response_->GetStatus() == 200 && remaining_bytes_ > 0) {
+    if (!ApplyByteRange())
+      return;
+  }
+
   if (remaining_bytes_ > 0)
     set_expected_content_size(remaining_bytes_);
 
@@ -333,6 +435,41 @@ void CefResourceRequestJob::SendHeaders() {
   SaveCookiesAndNotifyHeadersComplete();
 }
 
+bool CefResourceRequestJob::ApplyByteRange() {
+  const int64 content_length = remaining_bytes_;
+  const bool satisfiable = byte_range_.ComputeBounds(content_length);
+
+  // Ask the handler to skip to the start of the range. This is also done when
+  // the range starts at 0, or cannot be satisfied, so that the handler can
+  // indicate support.
+  const int64 first = satisfiable ? byte_range_.first_byte_position() : 0;
+  int64 bytes_skipped = 0;
+  if (!handler_->SkipResponse(first, bytes_skipped)) {
+    // The handler does not support skipping so return the complete response.
+    return true;
+  }
+  if (!satisfiable || bytes_skipped != first) {
+    NotifyStartError(URLRequestStatus(URLRequestStatus::FAILED,
+        net::ERR_REQUEST_RANGE_NOT_SATISFIABLE));
+    return false;
+  }
+
+  const int64 last = byte_range_.last_byte_position();
+
+  std::stringstream ss;
+  ss << "bytes " << first << "-" << last << "/" << content_length;
+
+  CefResponse::HeaderMap headerMap;
+  response_->GetHeaderMap(headerMap);
+  headerMap.insert(std::make_pair("Content-Range", ss.str()));
+  response_->SetHeaderMap(headerMap);
+  response_->SetStatus(206);
+  response_->SetStatusText("Partial Content");
+
+  remaining_bytes_ = last - first + 1;
+  return true;
+}
+
 void CefResourceRequestJob::AddCookieHeaderAndStart() {
   // No matter what, we want to report our status as IO pending since we will
   // be notifying our consumer asynchronously via OnStartCompleted.
@@ -12,15 +12,20 @@
 #include "include/cef_frame.h"
 #include "include/cef_request_handler.h"
 
+#include "base/memory/scoped_ptr.h"
 #include "net/cookies/cookie_monster.h"
+#include "net/http/http_byte_range.h"
 #include "net/url_request/url_request_job.h"
 
 namespace net {
+class Filter;
+class FilterContext;
 class HttpResponseHeaders;
 class URLRequest;
 }
 
 class CefResourceRequestJobCallback;
+class CefResourceRequestJobFilterContext;
 
 class CefResourceRequestJob : public net::URLRequestJob {
  public:
@@ -33,6 +38,8 @@ class CefResourceRequestJob : public net::URLRequestJob {
   // net::URLRequestJob methods.
   virtual void Start() OVERRIDE;
   virtual void Kill() OVERRIDE;
+  virtual void SetExtraRequestHeaders(const net::HttpRequestHeaders& headers)
+      OVERRIDE;
   virtual bool ReadRawData(net::IOBuffer* dest, int dest_size, int* bytes_read)
       OVERRIDE;
   virtual void GetResponseInfo(net::HttpResponseInfo* info) OVERRIDE;
@@ -40,9 +47,14 @@ class CefResourceRequestJob : public net::URLRequestJob {
   virtual bool IsRedirectResponse(GURL* location, int* http_status_code)
       OVERRIDE;
   virtual bool GetMimeType(std::string* mime_type) const OVERRIDE;
+  virtual net::Filter* SetupFilter() const OVERRIDE;
 
   void SendHeaders();
 
+  // Restrict the response to |byte_range_| if the handler supports skipping
+  // response data. Returns false if the request has failed.
+  bool ApplyByteRange();
+
   // Used for sending cookies with the request.
   void AddCookieHeaderAndStart();
   void DoLoadCookies();
@@ -65,14 +77,17 @@ class CefResourceRequestJob : public net::URLRequestJob {
   CefRefPtr<CefResponse> response_;
   GURL redirect_url_;
   int64 remaining_bytes_;
+  net::HttpByteRange byte_range_;
   CefRefPtr<CefRequest> cef_request_;
   CefRefPtr<CefResourceRequestJobCallback> callback_;
   scoped_refptr<net::HttpResponseHeaders> response_headers_;
   std::vector<std::string> response_cookies_;
   size_t response_cookies_save_index_;
+  scoped_ptr<net::FilterContext> filter_context_;
   base::WeakPtrFactory<CefResourceRequestJob> weak_factory_;
 
   friend class CefResourceRequestJobCallback;
+  friend class CefResourceRequestJobFilterContext;
 
   DISALLOW_COPY_AND_ASSIGN(CefResourceRequestJob);
 };
@@ -0,0 +1,303 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#include "libcef/browser/resource_usage.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#if defined(OS_WIN)
+#include <windows.h>
+#elif defined(OS_MACOSX)
+#include <mach/mach.h>
+#elif defined(OS_LINUX)
+#include <unistd.h>
+#endif
+
+#include "libcef/browser/browser_host_impl.h"
+#include "libcef/browser/thread_util.h"
+#include "libcef/common/cef_messages.h"
+
+#include "base/bind.h"
+#include "base/file_path.h"
+#include "base/file_util.h"
+#include "base/lazy_instance.h"
+#include "base/memory/scoped_ptr.h"
+#include "base/process_util.h"
+#include "base/string_number_conversions.h"
+#include "base/string_split.h"
+#include "base/time.h"
+#include "content/public/browser/notification_observer.h"
+#include "content/public/browser/notification_registrar.h"
+#include "content/public/browser/notification_service.h"
+#include "content/public/browser/notification_source.h"
+#include "content/public/browser/notification_types.h"
+#include "content/public/browser/render_process_host.h"
+
+#if defined(OS_MACOSX)
+#include "content/browser/mach_broker_mac.h"
+#endif
+
+namespace {
+
+// Returns the user and kernel CPU time consumed by |process| in microseconds
+// or 0 if it cannot be determined. base::ProcessMetrics only reports CPU usage
+// as a percentage between calls so the total is read from the OS directly.
+int64 GetProcessCPUTime(base::ProcessHandle process) {
+#if defined(OS_WIN)
+  FILETIME creation_time, exit_time, kernel_time, user_time;
+  if (!GetProcessTimes(process, &creation_time, &exit_time, &kernel_time,
+                       &user_time)) {
+    return 0;
+  }
+
+  // FILETIME values are in 100 nanosecond units.
+  ULARGE_INTEGER kernel, user;
+  kernel.LowPart = kernel_time.dwLowDateTime;
+  kernel.HighPart = kernel_time.dwHighDateTime;
+  user.LowPart = user_time.dwLowDateTime;
+  user.HighPart = user_time.dwHighDateTime;
+  return static_cast<int64>((kernel.QuadPart + user.QuadPart) / 10);
+#elif defined(OS_MACOSX)
+  mach_port_t task = (process == base::GetCurrentProcessHandle()) ?
+      mach_task_self() :
+      content::MachBroker::GetInstance()->TaskForPid(process);
+  if (task == MACH_PORT_NULL)
+    return 0;
+
+  // Times of the live threads.
+  task_thread_times_info_data_t thread_info;
+  mach_msg_type_number_t count = TASK_THREAD_TIMES_INFO_COUNT;
+  if (task_info(task, TASK_THREAD_TIMES_INFO,
+                reinterpret_cast<task_info_t>(&thread_info),
+                &count) != KERN_SUCCESS) {
+    return 0;
+  }
+
+  // Times of the terminated threads.
+  task_basic_info_64 basic_info;
+  count = TASK_BASIC_INFO_64_COUNT;
+  if (task_info(task, TASK_BASIC_INFO_64,
+                reinterpret_cast<task_info_t>(&basic_info),
+                &count) != KERN_SUCCESS) {
+    return 0;
+  }
+
+  time_value_add(&thread_info.user_time, &thread_info.system_time);
+  time_value_add(&thread_info.user_time, &basic_info.user_time);
+  time_value_add(&thread_info.user_time, &basic_info.system_time);
+  return static_cast<int64>(thread_info.user_time.seconds) *
+         base::Time::kMicrosecondsPerSecond +
+         thread_info.user_time.microseconds;
+#elif defined(OS_LINUX)
+  std::string stat;
+  const FilePath& stat_path = FilePath("/proc").Append(
+      base::IntToString(process)).Append("stat");
+  if (!file_util::ReadFileToString(stat_path, &stat))
+    return 0;
+
+  // The process name in the second field may contain spaces so start after
+  // its closing parenthesis. The following field is the 3rd, utime is the
+  // 14th and stime is the 15th.
+  const size_t name_end = stat.rfind(')');
+  if (name_end == std::string::npos)
+    return 0;
+  std::vector<std::string> fields;
+  base::SplitString(stat.substr(name_end + 2), ' ', &fields);
+  const size_t kUserTimeIndex = 14 - 3;
+  const size_t kSystemTimeIndex = 15 - 3;
+  int64 user_ticks, system_ticks;
+  if (fields.size() <= kSystemTimeIndex ||
+      !base::StringToInt64(fields[kUserTimeIndex], &user_ticks) ||
+      !base::StringToInt64(fields[kSystemTimeIndex], &system_ticks)) {
+    return 0;
+  }
+
+  const long ticks_per_second = sysconf(_SC_CLK_TCK);
+  if (ticks_per_second <= 0)
+    return 0;
+  return (user_ticks + system_ticks) * base::Time::kMicrosecondsPerSecond /
+         ticks_per_second;
+#else
+  return 0;
+#endif
+}
+
+// Returns the private memory of |process| in bytes or 0 if it cannot be
+// determined.
+int64 GetProcessPrivateMemory(base::ProcessHandle process) {
+#if defined(OS_MACOSX)
+  scoped_ptr<base::ProcessMetrics> metrics(
+      base::ProcessMetrics::CreateProcessMetrics(
+          process, content::MachBroker::GetInstance()));
+#else
+  scoped_ptr<base::ProcessMetrics> metrics(
+      base::ProcessMetrics::CreateProcessMetrics(process));
+#endif
+
+  base::WorkingSetKBytes working_set;
+  if (!metrics->GetWorkingSetKBytes(&working_set))
+    return 0;
+  return static_cast<int64>(working_set.priv) * 1024;
+}
+
+// Class that tracks resource usage requests that are waiting for a response
+// from a render process.
+class CefResourceUsageManager : public content::NotificationObserver {
+ public:
+  CefResourceUsageManager()
+      : next_request_id_(0) {
+  }
+
+  void Query(CefRefPtr<CefBrowserHostImpl> browser,
+             content::RenderProcessHost* host,
+             CefRefPtr<CefResourceUsageCallback> callback) {
+    CEF_REQUIRE_UIT();
+
+    if (host) {
+      if (registrar_.IsEmpty()) {
+        registrar_.Add(this, content::NOTIFICATION_RENDERER_PROCESS_CLOSED,
+            content::NotificationService::AllBrowserContextsAndSources());
+      }
+
+      int request_id = ++next_request_id_;
+      PendingRequest request;
+      request.render_process_id = host->GetID();
+      request.browser = browser;
+      request.callback = callback;
+      pending_requests_.insert(std::make_pair(request_id, request));
+
+      if (host->Send(new CefProcessMsg_GetResourceUsage(request_id)))
+        return;
+
+      // The render process is not running.
+      pending_requests_.erase(request_id);
+    }
+
+    Respond(browser, callback, CefResourceUsage());
+  }
+
+  void OnResourceUsage(int render_process_id,
+                       int request_id,
+                       const CefProcessHostMsg_ResourceUsage_Params& params) {
+    CEF_REQUIRE_UIT();
+
+    PendingRequestMap::iterator it = pending_requests_.find(request_id);
+    if (it == pending_requests_.end() ||
+        it->second.render_process_id != render_process_id) {
+      return;
+    }
+
+    PendingRequest request = it->second;
+    pending_requests_.erase(it);
+
+    CefResourceUsage usage;
+    usage.v8_heap_used_bytes = params.v8_heap_used_bytes;
+    usage.v8_heap_total_bytes = params.v8_heap_total_bytes;
+
+    // Measure the render process from the browser process. In single-process
+    // mode the handle is for the browser process itself.
+    content::RenderProcessHost* host =
+        content::RenderProcessHost::FromID(render_process_id);
+    if (!host || host->GetHandle() == base::kNullProcessHandle) {
+      Respond(request.browser, request.callback, usage);
+      return;
+    }
+
+    // Reading process statistics may require file IO.
+    CEF_POST_TASK(CEF_FILET,
+        base::Bind(&CefResourceUsageManager::MeasureProcess,
+                   host->GetHandle(), request.browser, request.callback,
+                   usage));
+  }
+
+ private:
+  struct PendingRequest {
+    int render_process_id;
+    CefRefPtr<CefBrowserHostImpl> browser;
+    CefRefPtr<CefResourceUsageCallback> callback;
+  };
+
+  // Map of request ID to pending request.
+  typedef std::map<int, PendingRequest> PendingRequestMap;
+
+  // Add the CPU time and private memory of |process| to |usage| and respond
+  // on the UI thread. Called on the FILE thread.
+  static void MeasureProcess(base::ProcessHandle process,
+                             CefRefPtr<CefBrowserHostImpl> browser,
+                             CefRefPtr<CefResourceUsageCallback> callback,
+                             const CefResourceUsage& usage) {
+    CEF_REQUIRE_FILET();
+
+    CefResourceUsage process_usage(usage);
+    process_usage.cpu_time_us = GetProcessCPUTime(process);
+    process_usage.private_memory_bytes = GetProcessPrivateMemory(process);
+
+    CEF_POST_TASK(CEF_UIT,
+        base::Bind(&CefResourceUsageManager::Respond, browser, callback,
+                   process_usage));
+  }
+
+  // Execute |callback| with the network usage of |browser| added to the
+  // render process values in |usage|.
+  static void Respond(CefRefPtr<CefBrowserHostImpl> browser,
+                      CefRefPtr<CefResourceUsageCallback> callback,
+                      const CefResourceUsage& usage) {
+    CEF_REQUIRE_UIT();
+
+    CefResourceUsage browser_usage(usage);
+    browser->GetNetworkUsage(&browser_usage.network_bytes_received,
+                             &browser_usage.network_bytes_sent);
+    callback->OnResourceUsage(browser.get(), browser_usage);
+  }
+
+  // content::NotificationObserver methods.
+  virtual void Observe(int type,
+                       const content::NotificationSource& source,
+                       const content::NotificationDetails& details) OVERRIDE {
+    DCHECK_EQ(type, content::NOTIFICATION_RENDERER_PROCESS_CLOSED);
+    int render_process_id =
+        content::Source<content::RenderProcessHost>(source)->GetID();
+
+    // The render process will never respond to these requests.
+    std::vector<PendingRequest> requests;
+    PendingRequestMap::iterator it = pending_requests_.begin();
+    while (it != pending_requests_.end()) {
+      if (it->second.render_process_id == render_process_id) {
+        requests.push_back(it->second);
+        pending_requests_.erase(it++);
+      } else {
+        ++it;
+      }
+    }
+
+    for (size_t i = 0; i < requests.size(); ++i)
+      Respond(requests[i].browser, requests[i].callback, CefResourceUsage());
+  }
+
+  int next_request_id_;
+  PendingRequestMap pending_requests_;
+  content::NotificationRegistrar registrar_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefResourceUsageManager);
+};
+
+base::LazyInstance<CefResourceUsageManager>::Leaky g_manager =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+void CefQueryResourceUsage(CefRefPtr<CefBrowserHostImpl> browser,
+                           content::RenderProcessHost* host,
+                           CefRefPtr<CefResourceUsageCallback> callback) {
+  g_manager.Get().Query(browser, host, callback);
+}
+
+void CefResourceUsageReceived(
+    int render_process_id,
+    int request_id,
+    const CefProcessHostMsg_ResourceUsage_Params& params) {
+  g_manager.Get().OnResourceUsage(render_process_id, request_id, params);
+}
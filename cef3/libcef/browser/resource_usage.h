@@ -0,0 +1,32 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that can
+// be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_RESOURCE_USAGE_H_
+#define CEF_LIBCEF_BROWSER_RESOURCE_USAGE_H_
+#pragma once
+
+#include "include/cef_browser.h"
+
+namespace content {
+class RenderProcessHost;
+}
+
+class CefBrowserHostImpl;
+struct CefProcessHostMsg_ResourceUsage_Params;
+
+// Query the render process represented by |host| for the resource usage of
+// |browser|. |host| may be NULL in which case only the network values are
+// reported. Must be called on the UI thread.
+void CefQueryResourceUsage(CefRefPtr<CefBrowserHostImpl> browser,
+                           content::RenderProcessHost* host,
+                           CefRefPtr<CefResourceUsageCallback> callback);
+
+// Called when the render process identified by |render_process_id| responds
+// to the request identified by |request_id|. Must be called on the UI thread.
+void CefResourceUsageReceived(
+    int render_process_id,
+    int request_id,
+    const CefProcessHostMsg_ResourceUsage_Params& params);
+
+#endif  // CEF_LIBCEF_BROWSER_RESOURCE_USAGE_H_
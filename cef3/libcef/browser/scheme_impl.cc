@@ -3,7 +3,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-#include <map>
+#include <string>
 
 #include "include/cef_browser.h"
 #include "include/cef_scheme.h"
@@ -18,6 +18,7 @@
 #include "libcef/common/response_impl.h"
 
 #include "base/bind.h"
+#include "base/hash_tables.h"
 #include "base/lazy_instance.h"
 #include "base/logging.h"
 #include "base/message_loop.h"
@@ -89,12 +90,12 @@ net::URLRequestJob* GetBuiltinSchemeRequestJob(
 }
 
 std::string ToLower(const std::string& str) {
-  std::string str_lower = str;
-  std::transform(str_lower.begin(), str_lower.end(), str_lower.begin(),
-      towlower);
-  return str;
+  return StringToLowerASCII(str);
 }
 
+// Prefix used to register a factory for all subdomains of a domain.
+const char kWildcardPrefix[] = "*.";
+
 // Class that manages the CefSchemeHandlerFactory instances.
 class CefUrlRequestManager {
  protected:
@@ -142,13 +143,18 @@ class CefUrlRequestManager {
     CEF_REQUIRE_IOT();
 
     std::string scheme_lower = ToLower(scheme);
-    std::string domain_lower = ToLower(domain);
 
-    // Hostname is only supported for standard schemes.
-    if (!IsStandardScheme(scheme_lower))
-      domain_lower.clear();
+    SchemeMap::iterator it = scheme_map_.find(scheme_lower);
+    if (it == scheme_map_.end()) {
+      it = scheme_map_.insert(
+          std::make_pair(scheme_lower, SchemeEntry())).first;
+      it->second.is_standard = IsStandardScheme(scheme_lower);
+    }
 
-    handler_map_[make_pair(scheme_lower, domain_lower)] = factory;
+    // Registering a factory resets the hit count.
+    FactoryEntry* entry = GetFactoryEntry(&it->second, domain, true);
+    entry->factory = factory;
+    entry->hit_count = 0;
 
     net::URLRequestJobFactory* job_factory = GetJobFactory();
     job_factory->SetProtocolHandler(scheme_lower,
@@ -161,17 +167,24 @@ class CefUrlRequestManager {
                      const std::string& domain) {
     CEF_REQUIRE_IOT();
 
-    std::string scheme_lower = ToLower(scheme);
-    std::string domain_lower = ToLower(domain);
+    SchemeMap::iterator it = scheme_map_.find(ToLower(scheme));
+    if (it == scheme_map_.end())
+      return;
 
-    // Hostname is only supported for standard schemes.
-    if (!IsStandardScheme(scheme_lower))
-      domain_lower.clear();
+    SchemeEntry& scheme_entry = it->second;
 
-    HandlerMap::iterator iter =
-        handler_map_.find(make_pair(scheme_lower, domain_lower));
-    if (iter != handler_map_.end())
-      handler_map_.erase(iter);
+    bool is_wildcard;
+    std::string key;
+    if (ParseDomain(scheme_entry, domain, &is_wildcard, &key)) {
+      DomainMap& domain_map =
+          is_wildcard ? scheme_entry.wildcard_domains : scheme_entry.domains;
+      domain_map.erase(key);
+    } else {
+      scheme_entry.all_domains.factory = NULL;
+    }
+
+    if (scheme_entry.IsEmpty())
+      scheme_map_.erase(it);
   }
 
   // Clear all the existing URL handlers and unregister the ProtocolFactory.
@@ -181,44 +194,149 @@ class CefUrlRequestManager {
     net::URLRequestJobFactory* job_factory = GetJobFactory();
 
     // Unregister with the ProtocolFactory.
-    std::set<std::string> schemes;
-    for (HandlerMap::const_iterator i = handler_map_.begin();
-        i != handler_map_.end(); ++i) {
-      schemes.insert(i->first.first);
-    }
-    for (std::set<std::string>::const_iterator scheme = schemes.begin();
-        scheme != schemes.end(); ++scheme) {
-      job_factory->SetProtocolHandler(*scheme, NULL);
+    for (SchemeMap::const_iterator i = scheme_map_.begin();
+        i != scheme_map_.end(); ++i) {
+      job_factory->SetProtocolHandler(i->first, NULL);
     }
 
-    handler_map_.clear();
+    scheme_map_.clear();
+  }
+
+  // Returns the number of requests that have been dispatched to the factory
+  // registered for |scheme| and |domain| or -1 if no such factory exists.
+  int64 GetHitCount(const std::string& scheme, const std::string& domain) {
+    CEF_REQUIRE_IOT();
+
+    SchemeMap::iterator it = scheme_map_.find(ToLower(scheme));
+    if (it == scheme_map_.end())
+      return -1;
+
+    FactoryEntry* entry = GetFactoryEntry(&it->second, domain, false);
+    if (!entry || !entry->factory.get())
+      return -1;
+    return entry->hit_count;
   }
 
  private:
-  // Retrieve the matching handler factory, if any. |scheme| will already be in
-  // lower case.
-  CefRefPtr<CefSchemeHandlerFactory> GetHandlerFactory(
-      net::URLRequest* request, const std::string& scheme) {
+  // Registration state for a single factory.
+  struct FactoryEntry {
+    FactoryEntry() : hit_count(0) {}
+
     CefRefPtr<CefSchemeHandlerFactory> factory;
+    int64 hit_count;
+  };
+
+  // Map of lower-case domain names to factories.
+  typedef base::hash_map<std::string, FactoryEntry> DomainMap;
 
-    if (request->url().is_valid() && IsStandardScheme(scheme)) {
-      // Check for a match with a domain first.
-      const std::string& domain = request->url().host();
+  // Factories registered for a single scheme.
+  struct SchemeEntry {
+    SchemeEntry() : is_standard(false) {}
 
-      HandlerMap::iterator i = handler_map_.find(make_pair(scheme, domain));
-      if (i != handler_map_.end())
-        factory = i->second;
+    bool IsEmpty() const {
+      return domains.empty() && wildcard_domains.empty() &&
+             !all_domains.factory.get();
     }
 
-    if (!factory.get()) {
-      // Check for a match with no specified domain.
-      HandlerMap::iterator i =
-          handler_map_.find(make_pair(scheme, std::string()));
-      if (i != handler_map_.end())
-        factory = i->second;
+    // True if the scheme is standard. Domains are only matched for standard
+    // schemes.
+    bool is_standard;
+
+    // Factories registered for an exact domain.
+    DomainMap domains;
+
+    // Factories registered for all subdomains of a domain. The key is the
+    // domain without the wildcard prefix.
+    DomainMap wildcard_domains;
+
+    // Factory registered with an empty domain that matches all domains.
+    FactoryEntry all_domains;
+  };
+
+  // Map of lower-case scheme names to factories.
+  typedef base::hash_map<std::string, SchemeEntry> SchemeMap;
+
+  // Parse |domain| as registered for |scheme_entry|. Returns false if the
+  // registration matches all domains. Otherwise, sets |is_wildcard| and the
+  // lower-case lookup |key|.
+  static bool ParseDomain(const SchemeEntry& scheme_entry,
+                          const std::string& domain,
+                          bool* is_wildcard,
+                          std::string* key) {
+    // Hostname is only supported for standard schemes.
+    if (!scheme_entry.is_standard || domain.empty() || domain == "*")
+      return false;
+
+    *is_wildcard = StartsWithASCII(domain, kWildcardPrefix, true);
+    if (*is_wildcard)
+      *key = ToLower(domain.substr(arraysize(kWildcardPrefix) - 1));
+    else
+      *key = ToLower(domain);
+    return !key->empty();
+  }
+
+  // Returns the entry for |domain| in |scheme_entry|. If |create| is true the
+  // entry will be created if it does not already exist.
+  static FactoryEntry* GetFactoryEntry(SchemeEntry* scheme_entry,
+                                       const std::string& domain,
+                                       bool create) {
+    bool is_wildcard;
+    std::string key;
+    if (!ParseDomain(*scheme_entry, domain, &is_wildcard, &key))
+      return &scheme_entry->all_domains;
+
+    DomainMap& domain_map = is_wildcard ?
+        scheme_entry->wildcard_domains : scheme_entry->domains;
+    if (create)
+      return &domain_map[key];
+
+    DomainMap::iterator it = domain_map.find(key);
+    if (it == domain_map.end())
+      return NULL;
+    return &it->second;
+  }
+
+  // Retrieve the matching handler factory entry, if any. |scheme| will already
+  // be in lower case.
+  FactoryEntry* GetHandlerFactory(net::URLRequest* request,
+                                  const std::string& scheme) {
+    SchemeMap::iterator scheme_it = scheme_map_.find(scheme);
+    if (scheme_it == scheme_map_.end())
+      return NULL;
+
+    SchemeEntry& scheme_entry = scheme_it->second;
+
+    if (scheme_entry.is_standard && request->url().is_valid()) {
+      // The host component of a standard URL is already canonicalized to
+      // lower case.
+      const std::string& host = request->url().host();
+
+      // Check for a match with an exact domain first.
+      if (!scheme_entry.domains.empty()) {
+        DomainMap::iterator it = scheme_entry.domains.find(host);
+        if (it != scheme_entry.domains.end())
+          return &it->second;
+      }
+
+      // Check for a match with a wildcard domain. Longer suffixes are checked
+      // first so that the most specific registration wins.
+      if (!scheme_entry.wildcard_domains.empty()) {
+        size_t pos = host.find('.');
+        while (pos != std::string::npos) {
+          DomainMap::iterator it =
+              scheme_entry.wildcard_domains.find(host.substr(pos + 1));
+          if (it != scheme_entry.wildcard_domains.end())
+            return &it->second;
+          pos = host.find('.', pos + 1);
+        }
+      }
     }
 
-    return factory;
+    // Check for a match with no specified domain.
+    if (scheme_entry.all_domains.factory.get())
+      return &scheme_entry.all_domains;
+
+    return NULL;
   }
 
   // Create the job that will handle the request. |scheme| will already be in
@@ -227,9 +345,14 @@ class CefUrlRequestManager {
                                     net::NetworkDelegate* network_delegate,
                                     const std::string& scheme) {
     net::URLRequestJob* job = NULL;
-    CefRefPtr<CefSchemeHandlerFactory> factory =
-        GetHandlerFactory(request, scheme);
-    if (factory) {
+    FactoryEntry* entry = GetHandlerFactory(request, scheme);
+    if (entry) {
+      entry->hit_count++;
+
+      // Keep a reference to the factory in case it is unregistered while
+      // creating the handler.
+      CefRefPtr<CefSchemeHandlerFactory> factory = entry->factory;
+
       CefRefPtr<CefBrowserHostImpl> browser =
           CefBrowserHostImpl::GetBrowserForRequest(request);
       CefRefPtr<CefFrame> frame;
@@ -260,11 +383,9 @@ class CefUrlRequestManager {
     return job;
   }
 
-  // Map (scheme, domain) to factories. This map will only be accessed on the IO
-  // thread.
-  typedef std::map<std::pair<std::string, std::string>,
-      CefRefPtr<CefSchemeHandlerFactory> > HandlerMap;
-  HandlerMap handler_map_;
+  // Map schemes to registered factories. This map will only be accessed on the
+  // IO thread.
+  SchemeMap scheme_map_;
 
   DISALLOW_EVIL_CONSTRUCTORS(CefUrlRequestManager);
 };
@@ -319,3 +440,17 @@ bool CefClearSchemeHandlerFactories() {
 
   return true;
 }
+
+int64 CefGetSchemeHandlerFactoryHitCount(const CefString& scheme_name,
+                                         const CefString& domain_name) {
+  // Verify that the context is in a valid state.
+  if (!CONTEXT_STATE_VALID()) {
+    NOTREACHED() << "context not valid";
+    return -1;
+  }
+
+  CEF_REQUIRE_IOT_RETURN(-1);
+
+  return CefUrlRequestManager::GetInstance()->GetHitCount(scheme_name,
+                                                          domain_name);
+}
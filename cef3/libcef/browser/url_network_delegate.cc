@@ -5,12 +5,15 @@
 #include "libcef/browser/url_network_delegate.h"
 
 #include <string>
+#include <vector>
 
 #include "libcef/browser/browser_host_impl.h"
 #include "libcef/browser/thread_util.h"
 #include "libcef/common/request_impl.h"
 
 #include "net/base/net_errors.h"
+#include "net/base/upload_data.h"
+#include "net/http/http_request_headers.h"
 #include "net/url_request/url_request.h"
 
 namespace {
@@ -130,6 +133,32 @@ int CefNetworkDelegate::OnBeforeSendHeaders(
 void CefNetworkDelegate::OnSendHeaders(
     net::URLRequest* request,
     const net::HttpRequestHeaders& headers) {
+  // Headers are sent again after a redirect. The browser does not change.
+  RequestInfoMap::iterator info = request_info_.find(request);
+  if (info == request_info_.end()) {
+    info = request_info_.insert(
+        std::make_pair(request, RequestInfo())).first;
+    info->second.browser = CefBrowserHostImpl::GetBrowserForRequest(request);
+  }
+  if (!info->second.browser.get())
+    return;
+
+  // The request line is written by the network stack and is not included.
+  int64 bytes_sent = headers.ToString().length();
+
+  // Only in-memory upload data is counted. File contents are streamed by the
+  // network stack and are not visible here.
+  const net::UploadData* upload = request->get_upload();
+  if (upload) {
+    const std::vector<net::UploadElement>* elements = upload->elements();
+    std::vector<net::UploadElement>::const_iterator it = elements->begin();
+    for (; it != elements->end(); ++it) {
+      if (it->type() == net::UploadElement::TYPE_BYTES)
+        bytes_sent += it->bytes_length();
+    }
+  }
+
+  info->second.pending_bytes_sent += bytes_sent;
 }
 
 int CefNetworkDelegate::OnHeadersReceived(
@@ -142,19 +171,45 @@ int CefNetworkDelegate::OnHeadersReceived(
 
 void CefNetworkDelegate::OnBeforeRedirect(net::URLRequest* request,
                                           const GURL& new_location) {
+  CommitBytesSent(request);
 }
 
 void CefNetworkDelegate::OnResponseStarted(net::URLRequest* request) {
+  CommitBytesSent(request);
 }
 
 void CefNetworkDelegate::OnRawBytesRead(const net::URLRequest& request,
                                         int bytes_read) {
+  // Responses from the HTTP cache or from in-process handlers such as
+  // CefResourceHandler are not received over the network.
+  if (!request.response_info().network_accessed)
+    return;
+
+  // Requests received over the network have sent headers.
+  RequestInfoMap::const_iterator info = request_info_.find(&request);
+  if (info != request_info_.end() && info->second.browser.get())
+    info->second.browser->OnNetworkBytesReceived(bytes_read);
 }
 
 void CefNetworkDelegate::OnCompleted(net::URLRequest* request, bool started) {
 }
 
 void CefNetworkDelegate::OnURLRequestDestroyed(net::URLRequest* request) {
+  request_info_.erase(request);
+}
+
+void CefNetworkDelegate::CommitBytesSent(net::URLRequest* request) {
+  RequestInfoMap::iterator info = request_info_.find(request);
+  if (info == request_info_.end())
+    return;
+
+  const int64 bytes_sent = info->second.pending_bytes_sent;
+  info->second.pending_bytes_sent = 0;
+
+  if (bytes_sent == 0 || !request->response_info().network_accessed)
+    return;
+
+  info->second.browser->OnNetworkBytesSent(bytes_sent);
 }
 
 void CefNetworkDelegate::OnPACScriptError(int line_number,
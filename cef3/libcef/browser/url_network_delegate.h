@@ -6,8 +6,13 @@
 #define CEF_LIBCEF_BROWSER_URL_NETWORK_DELEGATE_H_
 #pragma once
 
+#include <map>
+
+#include "include/cef_base.h"
 #include "net/base/network_delegate.h"
 
+class CefBrowserHostImpl;
+
 // Used for intercepting resource requests, redirects and responses. The single
 // instance of this class is managed by CefURLRequestContextGetter.
 class CefNetworkDelegate : public net::NetworkDelegate {
@@ -60,6 +65,27 @@ class CefNetworkDelegate : public net::NetworkDelegate {
   virtual void OnRequestWaitStateChange(const net::URLRequest& request,
                                         RequestWaitState state) OVERRIDE;
 
+  // Attribute the bytes sent for |request| to its browser if the response was
+  // received over the network.
+  void CommitBytesSent(net::URLRequest* request);
+
+  // Network byte accounting state for a request that has sent headers.
+  struct RequestInfo {
+    RequestInfo() : pending_bytes_sent(0) {}
+
+    // Browser that the request belongs to, if any. Resolved once when the
+    // headers are first sent so that it is not looked up for each chunk of
+    // response data.
+    CefRefPtr<CefBrowserHostImpl> browser;
+
+    // Bytes sent that have not been attributed yet. Requests answered from the
+    // HTTP cache also send headers to the cache layer so the bytes are only
+    // counted once the response source is known.
+    int64 pending_bytes_sent;
+  };
+  typedef std::map<const net::URLRequest*, RequestInfo> RequestInfoMap;
+  RequestInfoMap request_info_;
+
   DISALLOW_COPY_AND_ASSIGN(CefNetworkDelegate);
 };
 
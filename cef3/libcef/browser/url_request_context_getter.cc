@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 
+#include "libcef/browser/coalescing_cookie_store.h"
 #include "libcef/browser/context.h"
 #include "libcef/browser/thread_util.h"
 #include "libcef/browser/url_network_delegate.h"
@@ -22,7 +23,6 @@
 #include "base/string_split.h"
 #include "base/threading/thread_restrictions.h"
 #include "base/threading/worker_pool.h"
-#include "chrome/browser/net/sqlite_persistent_cookie_store.h"
 #include "content/public/browser/browser_thread.h"
 #include "net/base/cert_verifier.h"
 #include "net/base/default_server_bound_cert_store.h"
@@ -312,7 +312,7 @@ void CefURLRequestContextGetter::SetCookieStoragePath(const FilePath& path) {
     return;
   }
 
-  scoped_refptr<SQLitePersistentCookieStore> persistent_store;
+  scoped_refptr<net::CookieMonster::PersistentCookieStore> persistent_store;
   if (!path.empty()) {
     // TODO(cef): Move directory creation to the blocking pool instead of
     // allowing file IO on this thread.
@@ -320,16 +320,18 @@ void CefURLRequestContextGetter::SetCookieStoragePath(const FilePath& path) {
     if (file_util::DirectoryExists(path) ||
         file_util::CreateDirectory(path)) {
       const FilePath& cookie_path = path.AppendASCII("Cookies");
-      persistent_store =
-          new SQLitePersistentCookieStore(cookie_path, false, NULL);
+      persistent_store = CefCoalescingCookieStore::CreateForPath(cookie_path,
+          CefCoalescingCookieStore::Policy(_Context->settings()));
     } else {
       NOTREACHED() << "The cookie storage directory could not be created";
     }
   }
 
-  // Set the new cookie store that will be used for all new requests. The old
-  // cookie store, if any, will be automatically flushed and closed when no
-  // longer referenced.
+  // Commit pending changes for the old cookie store, if any. It will be closed
+  // when no longer referenced.
+  FlushCookieStore();
+
+  // Set the new cookie store that will be used for all new requests.
   storage_->set_cookie_store(
       new net::CookieMonster(persistent_store.get(), NULL));
   cookie_store_path_ = path;
@@ -338,6 +340,16 @@ void CefURLRequestContextGetter::SetCookieStoragePath(const FilePath& path) {
   SetCookieSupportedSchemes(cookie_supported_schemes_);
 }
 
+void CefURLRequestContextGetter::FlushCookieStore() {
+  CEF_REQUIRE_IOT();
+
+  if (!url_request_context_.get() || !url_request_context_->cookie_store())
+    return;
+
+  url_request_context_->cookie_store()->GetCookieMonster()->FlushStore(
+      base::Closure());
+}
+
 void CefURLRequestContextGetter::SetCookieSupportedSchemes(
     const std::vector<std::string>& schemes) {
   CEF_REQUIRE_IOT();
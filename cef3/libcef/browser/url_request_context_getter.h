@@ -45,6 +45,9 @@ class CefURLRequestContextGetter : public net::URLRequestContextGetter {
   net::HostResolver* host_resolver();
 
   void SetCookieStoragePath(const FilePath& path);
+  // Commit pending changes for the current cookie store to disk. Must be called
+  // before shutdown while the DB thread is still running.
+  void FlushCookieStore();
   void SetCookieSupportedSchemes(const std::vector<std::string>& schemes);
 
   // Manage URLRequestContext proxy objects. It's important that proxy objects
@@ -0,0 +1,145 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors.
+// Portions copyright (c) 2012 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "libcef/browser/web_contents_view_osr.h"
+#include "libcef/browser/render_widget_host_view_osr.h"
+
+#include "content/browser/renderer_host/render_view_host_impl.h"
+#include "content/public/browser/render_widget_host.h"
+#include "content/public/browser/web_contents.h"
+
+CefWebContentsViewOSR::CefWebContentsViewOSR(
+    content::WebContents* web_contents)
+    : web_contents_(web_contents) {
+}
+
+CefWebContentsViewOSR::~CefWebContentsViewOSR() {
+}
+
+
+// WebContentsView methods.
+// -----------------------------------------------------------------------------
+
+void CefWebContentsViewOSR::CreateView(const gfx::Size& initial_size) {
+}
+
+content::RenderWidgetHostView* CefWebContentsViewOSR::CreateViewForWidget(
+    content::RenderWidgetHost* render_widget_host) {
+  if (render_widget_host->GetView()) {
+    // During testing, the view will already be set up in most cases to the
+    // test view, so we don't want to clobber it with a real one.
+    return render_widget_host->GetView();
+  }
+
+  // The view deletes itself when the RenderWidgetHost is destroyed.
+  return new CefRenderWidgetHostViewOSR(render_widget_host);
+}
+
+gfx::NativeView CefWebContentsViewOSR::GetNativeView() const {
+  return gfx::NativeView();
+}
+
+gfx::NativeView CefWebContentsViewOSR::GetContentNativeView() const {
+  return gfx::NativeView();
+}
+
+gfx::NativeWindow CefWebContentsViewOSR::GetTopLevelNativeWindow() const {
+  return gfx::NativeWindow();
+}
+
+void CefWebContentsViewOSR::GetContainerBounds(gfx::Rect* out) const {
+  *out = GetViewBounds();
+}
+
+void CefWebContentsViewOSR::SetPageTitle(const string16& title) {
+}
+
+void CefWebContentsViewOSR::OnTabCrashed(base::TerminationStatus status,
+                                         int error_code) {
+}
+
+void CefWebContentsViewOSR::SizeContents(const gfx::Size& size) {
+  // The size is controlled by the CefRenderHandler.
+}
+
+void CefWebContentsViewOSR::RenderViewCreated(content::RenderViewHost* host) {
+}
+
+void CefWebContentsViewOSR::Focus() {
+}
+
+void CefWebContentsViewOSR::SetInitialFocus() {
+}
+
+void CefWebContentsViewOSR::StoreFocus() {
+}
+
+void CefWebContentsViewOSR::RestoreFocus() {
+}
+
+WebDropData* CefWebContentsViewOSR::GetDropData() const {
+  return NULL;
+}
+
+bool CefWebContentsViewOSR::IsEventTracking() const {
+  return false;
+}
+
+void CefWebContentsViewOSR::CloseTabAfterEventTracking() {
+}
+
+gfx::Rect CefWebContentsViewOSR::GetViewBounds() const {
+  content::RenderWidgetHostView* view =
+      web_contents_->GetRenderWidgetHostView();
+  return view ? view->GetViewBounds() : gfx::Rect();
+}
+
+
+// RenderViewHostDelegateView methods.
+// -----------------------------------------------------------------------------
+
+void CefWebContentsViewOSR::ShowContextMenu(
+    const content::ContextMenuParams& params) {
+  // Context menus require a native view.
+}
+
+#if defined(OS_MACOSX) || defined(OS_ANDROID)
+void CefWebContentsViewOSR::ShowPopupMenu(
+    const gfx::Rect& bounds,
+    int item_height,
+    double item_font_size,
+    int selected_item,
+    const std::vector<WebMenuItem>& items,
+    bool right_aligned) {
+#if defined(OS_MACOSX)
+  // Popup menus cannot be displayed without a native view. Cancel the menu so
+  // that the renderer does not wait for a selection.
+  content::RenderViewHostImpl* host = static_cast<content::RenderViewHostImpl*>(
+      web_contents_->GetRenderViewHost());
+  if (host)
+    host->DidCancelPopupMenu();
+#endif
+}
+#endif
+
+void CefWebContentsViewOSR::StartDragging(
+    const WebDropData& drop_data,
+    WebKit::WebDragOperationsMask allowed_ops,
+    const gfx::ImageSkia& image,
+    const gfx::Point& image_offset) {
+  // Drag & drop requires a native view. End the drag immediately so the
+  // renderer doesn't wait for it.
+  web_contents_->SystemDragEnded();
+}
+
+void CefWebContentsViewOSR::UpdateDragCursor(
+    WebKit::WebDragOperation operation) {
+}
+
+void CefWebContentsViewOSR::GotFocus() {
+}
+
+void CefWebContentsViewOSR::TakeFocus(bool reverse) {
+}
@@ -0,0 +1,76 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors.
+// Portions copyright (c) 2012 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_BROWSER_WEB_CONTENTS_VIEW_OSR_H_
+#define CEF_LIBCEF_BROWSER_WEB_CONTENTS_VIEW_OSR_H_
+#pragma once
+
+#include <vector>
+
+#include "content/port/browser/render_view_host_delegate_view.h"
+#include "content/public/browser/web_contents_view.h"
+
+namespace content {
+class WebContents;
+}
+
+// WebContentsView implementation used for browsers with window rendering
+// disabled. No native view is created. A CefRenderWidgetHostViewOSR is created
+// for each RenderWidgetHost and drag & drop, context menus and focus changes
+// that would require a native view are ignored.
+class CefWebContentsViewOSR : public content::WebContentsView,
+                              public content::RenderViewHostDelegateView {
+ public:
+  explicit CefWebContentsViewOSR(content::WebContents* web_contents);
+  virtual ~CefWebContentsViewOSR();
+
+  // WebContentsView methods.
+  virtual void CreateView(const gfx::Size& initial_size) OVERRIDE;
+  virtual content::RenderWidgetHostView* CreateViewForWidget(
+      content::RenderWidgetHost* render_widget_host) OVERRIDE;
+  virtual gfx::NativeView GetNativeView() const OVERRIDE;
+  virtual gfx::NativeView GetContentNativeView() const OVERRIDE;
+  virtual gfx::NativeWindow GetTopLevelNativeWindow() const OVERRIDE;
+  virtual void GetContainerBounds(gfx::Rect *out) const OVERRIDE;
+  virtual void SetPageTitle(const string16& title) OVERRIDE;
+  virtual void OnTabCrashed(base::TerminationStatus status,
+                            int error_code) OVERRIDE;
+  virtual void SizeContents(const gfx::Size& size) OVERRIDE;
+  virtual void RenderViewCreated(content::RenderViewHost* host) OVERRIDE;
+  virtual void Focus() OVERRIDE;
+  virtual void SetInitialFocus() OVERRIDE;
+  virtual void StoreFocus() OVERRIDE;
+  virtual void RestoreFocus() OVERRIDE;
+  virtual WebDropData* GetDropData() const OVERRIDE;
+  virtual bool IsEventTracking() const OVERRIDE;
+  virtual void CloseTabAfterEventTracking() OVERRIDE;
+  virtual gfx::Rect GetViewBounds() const OVERRIDE;
+
+  // RenderViewHostDelegateView methods.
+  virtual void ShowContextMenu(
+      const content::ContextMenuParams& params) OVERRIDE;
+#if defined(OS_MACOSX) || defined(OS_ANDROID)
+  virtual void ShowPopupMenu(const gfx::Rect& bounds,
+                             int item_height,
+                             double item_font_size,
+                             int selected_item,
+                             const std::vector<WebMenuItem>& items,
+                             bool right_aligned) OVERRIDE;
+#endif
+  virtual void StartDragging(const WebDropData& drop_data,
+                             WebKit::WebDragOperationsMask allowed_ops,
+                             const gfx::ImageSkia& image,
+                             const gfx::Point& image_offset) OVERRIDE;
+  virtual void UpdateDragCursor(WebKit::WebDragOperation operation) OVERRIDE;
+  virtual void GotFocus() OVERRIDE;
+  virtual void TakeFocus(bool reverse) OVERRIDE;
+
+ private:
+  content::WebContents* web_contents_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefWebContentsViewOSR);
+};
+
+#endif  // CEF_LIBCEF_BROWSER_WEB_CONTENTS_VIEW_OSR_H_
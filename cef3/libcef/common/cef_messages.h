@@ -6,6 +6,7 @@
 // IPC messages for CEF.
 // Multiply-included message file, hence no include guard.
 
+#include "base/process.h"
 #include "base/shared_memory.h"
 #include "base/values.h"
 #include "content/public/common/common_param_traits.h"
@@ -131,12 +132,62 @@ IPC_MESSAGE_CONTROL5(CefProcessMsg_ModifyCrossOriginWhitelistEntry,
 // Sent to child processes to clear the cross-origin whitelist.
 IPC_MESSAGE_CONTROL0(CefProcessMsg_ClearCrossOriginWhitelist)
 
+// Sent to render processes to release memory. |level| is a
+// cef_memory_pressure_level_t value. The render process responds with
+// CefProcessHostMsg_MemoryReleased.
+IPC_MESSAGE_CONTROL2(CefProcessMsg_MemoryPressure,
+                     int /* request_id */,
+                     int /* level */)
+
+// Sent to render processes to retrieve resource usage. The render process
+// responds with CefProcessHostMsg_ResourceUsage.
+IPC_MESSAGE_CONTROL1(CefProcessMsg_GetResourceUsage,
+                     int /* request_id */)
+
 
 // Messages sent from the renderer to the browser.
 
-// Sent when the render thread has started and all filters are attached.
+// Sent when the render thread has started, all filters are attached and
+// CefRenderProcessHandler::OnRenderThreadCreated() has returned.
 IPC_MESSAGE_CONTROL0(CefProcessHostMsg_RenderThreadStarted)
 
+// Parameters structure for a completed startup phase.
+IPC_STRUCT_BEGIN(CefProcessHostMsg_StartupPhase_Params)
+  // Phase name.
+  IPC_STRUCT_MEMBER(std::string, name)
+
+  // Internal values of the base::TimeTicks start and end times.
+  IPC_STRUCT_MEMBER(int64, start_time)
+  IPC_STRUCT_MEMBER(int64, end_time)
+
+  // Process that recorded the phase and whether it is the zygote process that
+  // the render process was forked from.
+  IPC_STRUCT_MEMBER(base::ProcessId, process_id)
+  IPC_STRUCT_MEMBER(bool, inherited)
+IPC_STRUCT_END()
+
+// Sent when startup phases complete in the render process.
+IPC_MESSAGE_CONTROL1(CefProcessHostMsg_StartupPhases,
+                     std::vector<CefProcessHostMsg_StartupPhase_Params>)
+
+// Sent after memory has been released in response to
+// CefProcessMsg_MemoryPressure.
+IPC_MESSAGE_CONTROL2(CefProcessHostMsg_MemoryReleased,
+                     int /* request_id */,
+                     int64 /* bytes_freed */)
+
+// Parameters structure for render process resource usage. CPU time and
+// private memory are measured by the browser process.
+IPC_STRUCT_BEGIN(CefProcessHostMsg_ResourceUsage_Params)
+  IPC_STRUCT_MEMBER(int64, v8_heap_used_bytes)
+  IPC_STRUCT_MEMBER(int64, v8_heap_total_bytes)
+IPC_STRUCT_END()
+
+// Sent in response to CefProcessMsg_GetResourceUsage.
+IPC_MESSAGE_CONTROL2(CefProcessHostMsg_ResourceUsage,
+                     int /* request_id */,
+                     CefProcessHostMsg_ResourceUsage_Params)
+
 // Sent when a frame is identified for the first time.
 IPC_MESSAGE_ROUTED3(CefHostMsg_FrameIdentified,
                     int64 /* frame_id */,
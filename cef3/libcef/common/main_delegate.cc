@@ -7,6 +7,7 @@
 #include "libcef/browser/context.h"
 #include "libcef/common/cef_switches.h"
 #include "libcef/common/command_line_impl.h"
+#include "libcef/common/startup_timeline.h"
 #include "libcef/renderer/content_renderer_client.h"
 
 #include "base/command_line.h"
@@ -29,6 +30,10 @@
 #include <Objbase.h>  // NOLINT(build/include_order)
 #endif
 
+#if defined(OS_LINUX)
+#include <X11/Xlib.h>  // NOLINT(build/include_order)
+#endif
+
 #if defined(OS_MACOSX)
 #include "base/mac/bundle_locations.h"
 #include "base/mac/foundation_util.h"
@@ -110,6 +115,7 @@ class CefUIThread : public base::Thread {
     browser_runner_.reset(content::BrowserMainRunner::Create());
 
     // Initialize browser process state. Uses the current thread's mesage loop.
+    CefScopedStartupPhase phase("BrowserMainRunner::Initialize");
     int exit_code = browser_runner_->Initialize(main_function_params_);
     CHECK_EQ(exit_code, -1);
   }
@@ -165,6 +171,17 @@ bool CefMainDelegate::BasicStartupComplete(int* exit_code) {
     if (settings.single_process)
       command_line->AppendSwitch(switches::kSingleProcess);
 
+    if (settings.renderer_process_limit > 0) {
+      command_line->AppendSwitchASCII(switches::kRendererProcessLimit,
+          base::IntToString(settings.renderer_process_limit));
+    }
+
+    if (settings.process_per_site)
+      command_line->AppendSwitch(switches::kProcessPerSite);
+
+    if (settings.windowless_rendering_only)
+      command_line->AppendSwitch(switches::kDisableToolkitInitialization);
+
     if (settings.browser_subprocess_path.length > 0) {
       FilePath file_path =
           FilePath(CefString(&settings.browser_subprocess_path));
@@ -321,6 +338,7 @@ void CefMainDelegate::PreSandboxStartup() {
   if (command_line.HasSwitch(switches::kPackLoadingDisabled))
     content_client_.set_pack_loading_disabled(true);
 
+  CefScopedStartupPhase phase("InitializeResourceBundle");
   InitializeResourceBundle();
 }
 
@@ -336,10 +354,17 @@ int CefMainDelegate::RunProcess(
       // Initialize browser process state. Results in a call to
       // CefBrowserMain::PreMainMessageLoopStart() which creates the UI message
       // loop.
+      CefScopedStartupPhase phase("BrowserMainRunner::Initialize");
       int exit_code = browser_runner_->Initialize(main_function_params);
       if (exit_code >= 0)
         return exit_code;
     } else {
+#if defined(OS_LINUX)
+      // The application thread and the UI thread may both make Xlib calls.
+      // Enable Xlib locking before the UI thread initializes GTK.
+      XInitThreads();
+#endif
+
       // Run the UI on a separate thread.
       scoped_ptr<base::Thread> thread;
       thread.reset(new CefUIThread(main_function_params));
@@ -390,6 +415,10 @@ void CefMainDelegate::InitializeResourceBundle() {
   const CommandLine& command_line = *CommandLine::ForCurrentProcess();
   FilePath cef_pak_file, devtools_pak_file, locales_dir;
 
+  // DevTools resources are only served by the browser process.
+  const bool load_devtools_pak =
+      !command_line.HasSwitch(switches::kProcessType);
+
   if (!content_client_.pack_loading_disabled()) {
     FilePath resources_dir;
     if (command_line.HasSwitch(switches::kResourcesDirPath)) {
@@ -401,8 +430,10 @@ void CefMainDelegate::InitializeResourceBundle() {
 
     if (!resources_dir.empty()) {
       cef_pak_file = resources_dir.Append(FILE_PATH_LITERAL("cef.pak"));
-      devtools_pak_file =
-          resources_dir.Append(FILE_PATH_LITERAL("devtools_resources.pak"));
+      if (load_devtools_pak) {
+        devtools_pak_file =
+            resources_dir.Append(FILE_PATH_LITERAL("devtools_resources.pak"));
+      }
     }
 
     if (command_line.HasSwitch(switches::kLocalesDirPath))
@@ -415,6 +446,10 @@ void CefMainDelegate::InitializeResourceBundle() {
   std::string locale = command_line.GetSwitchValueASCII(switches::kLang);
   DCHECK(!locale.empty());
 
+  // Pack files are memory mapped and resources are located using the index at
+  // the start of each file, so pages are only read from disk when a resource
+  // is first used. Only the pack file for |locale| is mapped.
+
   const std::string loaded_locale =
       ui::ResourceBundle::InitSharedInstanceWithLocale(locale,
                                                        &content_client_);
@@ -430,7 +465,8 @@ void CefMainDelegate::InitializeResourceBundle() {
       NOTREACHED() << "Could not load cef.pak";
     }
 
-    if (file_util::PathExists(devtools_pak_file)) {
+    if (!devtools_pak_file.empty() &&
+        file_util::PathExists(devtools_pak_file)) {
       ResourceBundle::GetSharedInstance().AddDataPackFromPath(
           devtools_pak_file, ui::SCALE_FACTOR_NONE);
     }
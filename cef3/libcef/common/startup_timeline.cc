@@ -0,0 +1,89 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/startup_timeline.h"
+
+#include "base/debug/trace_event.h"
+#include "base/lazy_instance.h"
+#include "base/process_util.h"
+
+namespace {
+
+const char kStartupTraceCategory[] = "cef.startup";
+
+// The timeline must remain valid for phases that complete during shutdown.
+base::LazyInstance<CefStartupTimeline>::Leaky g_startup_timeline =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+CefStartupTimeline::Phase::Phase()
+    : process_id(base::kNullProcessId),
+      inherited(false) {
+}
+
+// static
+CefStartupTimeline* CefStartupTimeline::GetInstance() {
+  return g_startup_timeline.Pointer();
+}
+
+CefStartupTimeline::CefStartupTimeline()
+    : origin_(base::TimeTicks::Now()) {
+}
+
+void CefStartupTimeline::AddPhase(const std::string& name,
+                                  base::TimeTicks start_time,
+                                  base::TimeTicks end_time) {
+  Phase phase;
+  phase.name = name;
+  phase.start_time = start_time;
+  phase.end_time = end_time;
+  phase.process_id = base::GetCurrentProcId();
+
+  Delegate delegate;
+  {
+    base::AutoLock lock_scope(lock_);
+    if (delegate_.is_null()) {
+      pending_phases_.push_back(phase);
+      return;
+    }
+    delegate = delegate_;
+  }
+
+  delegate.Run(PhaseList(1, phase));
+}
+
+void CefStartupTimeline::SetDelegate(const Delegate& delegate) {
+  PhaseList phases;
+  {
+    base::AutoLock lock_scope(lock_);
+    delegate_ = delegate;
+    if (delegate_.is_null())
+      return;
+    phases.swap(pending_phases_);
+  }
+
+  // Phases buffered before a fork were recorded by the parent process.
+  const base::ProcessId process_id = base::GetCurrentProcId();
+  PhaseList::iterator it = phases.begin();
+  for (; it != phases.end(); ++it)
+    it->inherited = (it->process_id != process_id);
+
+  if (!phases.empty())
+    delegate.Run(phases);
+}
+
+CefScopedStartupPhase::CefScopedStartupPhase(const char* name)
+    : name_(name) {
+  // Create the timeline first so that its origin precedes this phase.
+  CefStartupTimeline::GetInstance();
+  start_time_ = base::TimeTicks::Now();
+  TRACE_EVENT_BEGIN0(kStartupTraceCategory, name_);
+}
+
+CefScopedStartupPhase::~CefScopedStartupPhase() {
+  TRACE_EVENT_END0(kStartupTraceCategory, name_);
+  CefStartupTimeline::GetInstance()->AddPhase(name_, start_time_,
+                                              base::TimeTicks::Now());
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_STARTUP_TIMELINE_H_
+#define CEF_LIBCEF_COMMON_STARTUP_TIMELINE_H_
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "base/basictypes.h"
+#include "base/callback.h"
+#include "base/process.h"
+#include "base/synchronization/lock.h"
+#include "base/time.h"
+
+// Records named phases of process startup using monotonic timestamps. One
+// instance exists in each process. Completed phases are buffered until a
+// delegate is set and then passed to the delegate as they complete. The browser
+// process delegate notifies CefBrowserProcessHandler::OnStartupPhase() and the
+// render process delegate forwards phases to the browser process. All methods
+// may be called on any thread.
+class CefStartupTimeline {
+ public:
+  struct Phase {
+    Phase();
+
+    std::string name;
+    base::TimeTicks start_time;
+    base::TimeTicks end_time;
+
+    // Process that recorded the phase. A process forked from the zygote
+    // inherits the phases that the zygote recorded, in which case |inherited|
+    // is true.
+    base::ProcessId process_id;
+    bool inherited;
+  };
+  typedef std::vector<Phase> PhaseList;
+
+  // Callback that receives completed phases. May be executed on any thread.
+  typedef base::Callback<void(const PhaseList&)> Delegate;
+
+  static CefStartupTimeline* GetInstance();
+
+  // Returns the time at which the timeline was created.
+  base::TimeTicks origin() const { return origin_; }
+
+  // Record a completed phase.
+  void AddPhase(const std::string& name,
+                base::TimeTicks start_time,
+                base::TimeTicks end_time);
+
+  // Set the delegate that will receive completed phases. Phases that completed
+  // before the delegate was set are passed to the delegate immediately with
+  // |inherited| set for phases recorded by a different process. Pass a null
+  // callback to buffer phases again.
+  void SetDelegate(const Delegate& delegate);
+
+ private:
+  CefStartupTimeline();
+
+  const base::TimeTicks origin_;
+
+  base::Lock lock_;
+  PhaseList pending_phases_;
+  Delegate delegate_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefStartupTimeline);
+};
+
+// Records a startup phase that lasts for the lifespan of this object. The phase
+// is also recorded as a trace event in the "cef.startup" category. |name| must
+// be a string literal.
+class CefScopedStartupPhase {
+ public:
+  explicit CefScopedStartupPhase(const char* name);
+  ~CefScopedStartupPhase();
+
+ private:
+  const char* name_;
+  base::TimeTicks start_time_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefScopedStartupPhase);
+};
+
+#endif  // CEF_LIBCEF_COMMON_STARTUP_TIMELINE_H_
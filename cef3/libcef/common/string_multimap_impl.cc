@@ -2,14 +2,18 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
-#include <map>
 #include "include/internal/cef_string_multimap.h"
+#include "libcef/common/string_pair_list.h"
 #include "base/logging.h"
 
-typedef std::multimap<CefString, CefString> StringMultimap;
+typedef CefStringPairList StringMultimap;
 
 CEF_EXPORT cef_string_multimap_t cef_string_multimap_alloc() {
-  return new StringMultimap;
+  return new StringMultimap(false);
+}
+
+CEF_EXPORT cef_string_multimap_t cef_string_multimap_alloc_case_insensitive() {
+  return new StringMultimap(true);
 }
 
 CEF_EXPORT int cef_string_multimap_size(cef_string_multimap_t map) {
@@ -23,7 +27,7 @@ CEF_EXPORT int cef_string_multimap_find_count(cef_string_multimap_t map,
   DCHECK(map);
   DCHECK(key);
   StringMultimap* impl = reinterpret_cast<StringMultimap*>(map);
-  return impl->count(CefString(key));
+  return impl->Count(key);
 }
 
 CEF_EXPORT int cef_string_multimap_enumerate(cef_string_multimap_t map,
@@ -35,25 +39,17 @@ CEF_EXPORT int cef_string_multimap_enumerate(cef_string_multimap_t map,
   DCHECK(value);
 
   StringMultimap* impl = reinterpret_cast<StringMultimap*>(map);
-  CefString key_str(key);
 
   DCHECK_GE(value_index, 0);
-  DCHECK_LT(value_index, static_cast<int>(impl->count(key_str)));
-  if (value_index < 0 || value_index >= static_cast<int>(impl->count(key_str)))
+  if (value_index < 0)
     return 0;
 
-  std::pair<StringMultimap::iterator, StringMultimap::iterator> range_it =
-      impl->equal_range(key_str);
-
-  int count = value_index;
-  while (count-- && range_it.first != range_it.second)
-    range_it.first++;
-
-  if (range_it.first == range_it.second)
+  const CefString* val = impl->Find(key, value_index);
+  DCHECK(val);
+  if (!val)
     return 0;
 
-  const CefString& val = range_it.first->second;
-  return cef_string_set(val.c_str(), val.length(), value, true);
+  return cef_string_share(val->GetStruct(), value);
 }
 
 CEF_EXPORT int cef_string_multimap_key(cef_string_multimap_t map, int index,
@@ -66,12 +62,8 @@ CEF_EXPORT int cef_string_multimap_key(cef_string_multimap_t map, int index,
   if (index < 0 || index >= static_cast<int>(impl->size()))
     return 0;
 
-  StringMultimap::const_iterator it = impl->begin();
-  for (int ct = 0; it != impl->end(); ++it, ct++) {
-    if (ct == index)
-      return cef_string_set(it->first.c_str(), it->first.length(), key, true);
-  }
-  return 0;
+  const CefString& val = impl->key(index);
+  return cef_string_share(val.GetStruct(), key);
 }
 
 CEF_EXPORT int cef_string_multimap_value(cef_string_multimap_t map, int index,
@@ -84,14 +76,8 @@ CEF_EXPORT int cef_string_multimap_value(cef_string_multimap_t map, int index,
   if (index < 0 || index >= static_cast<int>(impl->size()))
     return 0;
 
-  StringMultimap::const_iterator it = impl->begin();
-  for (int ct = 0; it != impl->end(); ++it, ct++) {
-    if (ct == index) {
-      return cef_string_set(it->second.c_str(), it->second.length(), value,
-          true);
-    }
-  }
-  return 0;
+  const CefString& val = impl->value(index);
+  return cef_string_share(val.GetStruct(), value);
 }
 
 CEF_EXPORT int cef_string_multimap_append(cef_string_multimap_t map,
@@ -99,14 +85,14 @@ CEF_EXPORT int cef_string_multimap_append(cef_string_multimap_t map,
                                           const cef_string_t* value) {
   DCHECK(map);
   StringMultimap* impl = reinterpret_cast<StringMultimap*>(map);
-  impl->insert(std::make_pair(CefString(key), CefString(value)));
+  impl->Append(key, value);
   return 1;
 }
 
 CEF_EXPORT void cef_string_multimap_clear(cef_string_multimap_t map) {
   DCHECK(map);
   StringMultimap* impl = reinterpret_cast<StringMultimap*>(map);
-  impl->clear();
+  impl->Clear();
 }
 
 CEF_EXPORT void cef_string_multimap_free(cef_string_multimap_t map) {
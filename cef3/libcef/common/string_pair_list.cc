@@ -0,0 +1,113 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/string_pair_list.h"
+
+namespace {
+
+const cef_string_t kEmptyString = {NULL, 0, NULL};
+
+inline uint32 FoldASCIICase(uint32 c) {
+  return (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
+}
+
+// Returns |key| or an empty string if |key| is NULL.
+inline const cef_string_t* GetKey(const cef_string_t* key) {
+  return key ? key : &kEmptyString;
+}
+
+}  // namespace
+
+CefStringPairList::CefStringPairList(bool case_insensitive)
+    : case_insensitive_(case_insensitive) {
+}
+
+size_t CefStringPairList::Count(const cef_string_t* key) const {
+  const IndexList* indices = FindIndices(key);
+  if (!indices)
+    return 0;
+
+  size_t count = 0;
+  for (size_t i = 0; i < indices->size(); ++i) {
+    if (Equals(entries_[(*indices)[i]].first.GetStruct(), key))
+      count++;
+  }
+  return count;
+}
+
+const CefString* CefStringPairList::Find(const cef_string_t* key,
+                                         size_t value_index) const {
+  const IndexList* indices = FindIndices(key);
+  if (!indices)
+    return NULL;
+
+  for (size_t i = 0; i < indices->size(); ++i) {
+    const std::pair<CefString, CefString>& entry = entries_[(*indices)[i]];
+    if (Equals(entry.first.GetStruct(), key) && value_index-- == 0)
+      return &entry.second;
+  }
+  return NULL;
+}
+
+void CefStringPairList::Append(const cef_string_t* key,
+                               const cef_string_t* value) {
+  // Share or copy the strings. The CefString constructor only references the
+  // data. Every entry has a string structure so that it can be shared with
+  // callers.
+  entries_.push_back(std::make_pair(CefString(), CefString()));
+  std::pair<CefString, CefString>& entry = entries_.back();
+  cef_string_t* entry_key = entry.first.GetWritableStruct();
+  if (key)
+    cef_string_share(key, entry_key);
+  cef_string_t* entry_value = entry.second.GetWritableStruct();
+  if (value)
+    cef_string_share(value, entry_value);
+
+  index_[Hash(key)].push_back(entries_.size() - 1);
+}
+
+void CefStringPairList::Clear() {
+  entries_.clear();
+  index_.clear();
+}
+
+size_t CefStringPairList::Hash(const cef_string_t* key) const {
+  key = GetKey(key);
+
+  // FNV-1a hash of the character values.
+  size_t hash = 2166136261U;
+  for (size_t i = 0; i < key->length; ++i) {
+    uint32 c = static_cast<uint32>(key->str[i]);
+    if (case_insensitive_)
+      c = FoldASCIICase(c);
+    hash = (hash ^ c) * 16777619U;
+  }
+  return hash;
+}
+
+bool CefStringPairList::Equals(const cef_string_t* key1,
+                               const cef_string_t* key2) const {
+  key1 = GetKey(key1);
+  key2 = GetKey(key2);
+  if (key1->length != key2->length)
+    return false;
+
+  for (size_t i = 0; i < key1->length; ++i) {
+    uint32 c1 = static_cast<uint32>(key1->str[i]);
+    uint32 c2 = static_cast<uint32>(key2->str[i]);
+    if (c1 == c2)
+      continue;
+    if (!case_insensitive_ || FoldASCIICase(c1) != FoldASCIICase(c2))
+      return false;
+  }
+  return true;
+}
+
+const CefStringPairList::IndexList* CefStringPairList::FindIndices(
+    const cef_string_t* key) const {
+  IndexMap::const_iterator it = index_.find(Hash(key));
+  if (it == index_.end())
+    return NULL;
+  return &it->second;
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_STRING_PAIR_LIST_H_
+#define CEF_LIBCEF_COMMON_STRING_PAIR_LIST_H_
+#pragma once
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "include/internal/cef_string.h"
+#include "base/basictypes.h"
+#include "base/hash_tables.h"
+
+// Flat list of key/value string pairs used to implement the cef_string_map_t
+// and cef_string_multimap_t types. Entries are kept in insertion order so that
+// indexed access is O(1). Keys are hashed so that lookup by key does not
+// require a scan of all entries. Keys may optionally be compared without
+// regard to ASCII case, as is required for HTTP header names.
+class CefStringPairList {
+ public:
+  explicit CefStringPairList(bool case_insensitive);
+
+  size_t size() const { return entries_.size(); }
+  bool case_insensitive() const { return case_insensitive_; }
+
+  // Returns the key or value at |index|, which must be less than size().
+  const CefString& key(size_t index) const { return entries_[index].first; }
+  const CefString& value(size_t index) const { return entries_[index].second; }
+
+  // Returns the number of entries with the specified |key|.
+  size_t Count(const cef_string_t* key) const;
+
+  // Returns the value of the |value_index|-th entry with the specified |key|
+  // in insertion order or NULL if no such entry exists.
+  const CefString* Find(const cef_string_t* key, size_t value_index) const;
+
+  // Append a new entry.
+  void Append(const cef_string_t* key, const cef_string_t* value);
+
+  // Remove all entries.
+  void Clear();
+
+ private:
+  typedef std::vector<size_t> IndexList;
+
+  size_t Hash(const cef_string_t* key) const;
+  bool Equals(const cef_string_t* key1, const cef_string_t* key2) const;
+
+  // Returns the indices of entries whose keys have the same hash as |key| or
+  // NULL if no such entries exist.
+  const IndexList* FindIndices(const cef_string_t* key) const;
+
+  bool case_insensitive_;
+
+  // A deque is used so that existing entries are not copied when new entries
+  // are appended.
+  std::deque<std::pair<CefString, CefString> > entries_;
+
+  // Map of key hash to entry indices in insertion order.
+  typedef base::hash_map<size_t, IndexList> IndexMap;
+  IndexMap index_;
+};
+
+#endif  // CEF_LIBCEF_COMMON_STRING_PAIR_LIST_H_
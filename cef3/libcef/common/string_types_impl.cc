@@ -3,22 +3,241 @@
 // can be found in the LICENSE file.
 
 #include "include/internal/cef_string_types.h"
+#include "base/atomic_ref_count.h"
+#include "base/basictypes.h"
 #include "base/logging.h"
 #include "base/string16.h"
+#include "base/utf_string_conversion_utils.h"
 #include "base/utf_string_conversions.h"
+#include "build/build_config.h"
+
+#if defined(ARCH_CPU_X86_64)
+// SSE2 is always available on x86-64.
+#include <emmintrin.h>
+#define CEF_STRING_USE_SSE2 1
+#endif
 
 namespace {
 
+// Header that precedes the character data of strings copied by this module.
+// The data is immutable and shared between string structures by incrementing
+// the reference count. The header is padded so that the character data that
+// follows it remains suitably aligned.
+union SharedStringHeader {
+  base::AtomicRefCount ref_count;
+  int64 padding;
+};
+
+SharedStringHeader* GetSharedStringHeader(void* str) {
+  return reinterpret_cast<SharedStringHeader*>(
+      reinterpret_cast<char*>(str) - sizeof(SharedStringHeader));
+}
+
+// Allocate a buffer for |len| characters plus the terminating NULL with a
+// reference count of 1.
+template <typename CharType>
+CharType* AllocSharedString(size_t len) {
+  char* buffer =
+      new char[sizeof(SharedStringHeader) + (len + 1) * sizeof(CharType)];
+  SharedStringHeader* header = reinterpret_cast<SharedStringHeader*>(buffer);
+  header->ref_count = 1;
+  return reinterpret_cast<CharType*>(buffer + sizeof(SharedStringHeader));
+}
+
+void AddRefSharedString(void* str) {
+  base::AtomicRefCountInc(&GetSharedStringHeader(str)->ref_count);
+}
+
+void ReleaseSharedString(void* str) {
+  SharedStringHeader* header = GetSharedStringHeader(str);
+  if (!base::AtomicRefCountDec(&header->ref_count))
+    delete [] reinterpret_cast<char*>(header);
+}
+
 void string_wide_dtor(wchar_t* str) {
-  delete [] str;
+  ReleaseSharedString(str);
 }
 
 void string_utf8_dtor(char* str) {
-  delete [] str;
+  ReleaseSharedString(str);
 }
 
 void string_utf16_dtor(char16* str) {
-  delete [] str;
+  ReleaseSharedString(str);
+}
+
+// Make |output| share the data of |src| if the data was allocated by this
+// module. Returns false without modifying |output| otherwise.
+template <typename CharType, typename StructType>
+bool ShareString(const StructType* src, StructType* output,
+                 void (*dtor)(CharType*)) {
+  if (src->dtor != dtor || !src->str)
+    return false;
+
+  // Add the reference before clearing |output| in case it already shares the
+  // same data.
+  AddRefSharedString(src->str);
+  if (output->dtor && output->str)
+    output->dtor(output->str);
+
+  output->str = src->str;
+  output->length = src->length;
+  output->dtor = dtor;
+  return true;
+}
+
+// Returns the number of leading characters in |src| that are ASCII.
+template <typename CharType>
+size_t ASCIIPrefixLength(const CharType* src, size_t src_len) {
+  size_t i = 0;
+  for (; i < src_len; ++i) {
+    if (static_cast<uint32>(src[i]) >= 0x80)
+      break;
+  }
+  return i;
+}
+
+size_t ASCIIPrefixLength(const char* src, size_t src_len) {
+  size_t i = 0;
+#if defined(CEF_STRING_USE_SSE2)
+  // Test 16 characters at a time using the high bit of each byte.
+  for (; i + 16 <= src_len; i += 16) {
+    __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    if (_mm_movemask_epi8(chars))
+      break;
+  }
+#endif
+  for (; i < src_len; ++i) {
+    if (static_cast<unsigned char>(src[i]) >= 0x80)
+      break;
+  }
+  return i;
+}
+
+size_t ASCIIPrefixLength(const char16* src, size_t src_len) {
+  size_t i = 0;
+#if defined(CEF_STRING_USE_SSE2)
+  // Test 8 characters at a time for any bits above the ASCII range.
+  const __m128i non_ascii_mask = _mm_set1_epi16(static_cast<int16>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= src_len; i += 8) {
+    __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i non_ascii = _mm_and_si128(chars, non_ascii_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, zero)) != 0xFFFF)
+      break;
+  }
+#endif
+  for (; i < src_len; ++i) {
+    if (src[i] >= 0x80)
+      break;
+  }
+  return i;
+}
+
+// Copy |src_len| ASCII characters from |src| to |dest| changing only the
+// character width.
+template <typename SrcCharType, typename DestCharType>
+void CopyASCII(const SrcCharType* src, size_t src_len, DestCharType* dest) {
+  for (size_t i = 0; i < src_len; ++i)
+    dest[i] = static_cast<DestCharType>(src[i]);
+}
+
+void CopyASCII(const char* src, size_t src_len, char16* dest) {
+  size_t i = 0;
+#if defined(CEF_STRING_USE_SSE2)
+  // Widen 16 characters at a time by interleaving with zero bytes.
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= src_len; i += 16) {
+    __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+                     _mm_unpacklo_epi8(chars, zero));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i + 8),
+                     _mm_unpackhi_epi8(chars, zero));
+  }
+#endif
+  for (; i < src_len; ++i)
+    dest[i] = static_cast<unsigned char>(src[i]);
+}
+
+void CopyASCII(const char16* src, size_t src_len, char* dest) {
+  size_t i = 0;
+#if defined(CEF_STRING_USE_SSE2)
+  // Narrow 16 characters at a time. ASCII values are unaffected by the
+  // saturation.
+  for (; i + 16 <= src_len; i += 16) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 8));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i),
+                     _mm_packus_epi16(low, high));
+  }
+#endif
+  for (; i < src_len; ++i)
+    dest[i] = static_cast<char>(src[i]);
+}
+
+// Write |src_len| ASCII characters from |src| directly into |output| without
+// an intermediate string.
+template <typename SrcCharType, typename DestCharType, typename DestStructType>
+void SetFromASCII(const SrcCharType* src, size_t src_len,
+                  DestStructType* output, void (*dtor)(DestCharType*)) {
+  if (output->dtor && output->str)
+    output->dtor(output->str);
+  output->str = NULL;
+  output->length = 0;
+  output->dtor = NULL;
+
+  if (!src || src_len == 0)
+    return;
+
+  DestCharType* dest = AllocSharedString<DestCharType>(src_len);
+  CopyASCII(src, src_len, dest);
+  dest[src_len] = 0;
+
+  output->str = dest;
+  output->length = src_len;
+  output->dtor = dtor;
+}
+
+// Convert |src| directly into |output| if it contains only ASCII characters.
+// Returns false without modifying |output| otherwise. |ascii_len| is set to
+// the number of leading ASCII characters in |src|.
+template <typename SrcCharType, typename DestCharType, typename DestStructType>
+bool ConvertFromASCII(const SrcCharType* src, size_t src_len,
+                      DestStructType* output, void (*dtor)(DestCharType*),
+                      size_t* ascii_len) {
+  *ascii_len = src ? ASCIIPrefixLength(src, src_len) : 0;
+  if (src && *ascii_len != src_len)
+    return false;
+  SetFromASCII(src, src_len, output, dtor);
+  return true;
+}
+
+// Convert |src| into |output| when the first |ascii_len| characters are known
+// to be ASCII. The prefix is copied as is and only the remaining characters
+// are decoded. Invalid characters are replaced with U+FFFD. Returns false if
+// any invalid characters were found.
+template <typename SrcCharType, typename DestStringType>
+bool ConvertFromOffset(const SrcCharType* src, size_t src_len,
+                       size_t ascii_len, DestStringType* output) {
+  output->reserve(src_len);
+  output->assign(src, src + ascii_len);
+
+  bool success = true;
+  const int32 src_len32 = static_cast<int32>(src_len);
+  for (int32 i = static_cast<int32>(ascii_len); i < src_len32; ++i) {
+    uint32 code_point;
+    if (base::ReadUnicodeCharacter(src, src_len32, &i, &code_point)) {
+      base::WriteUnicodeCharacter(code_point, output);
+    } else {
+      base::WriteUnicodeCharacter(0xFFFD, output);
+      success = false;
+    }
+  }
+  return success;
 }
 
 }  // namespace
@@ -29,10 +248,7 @@ CEF_EXPORT int cef_string_wide_set(const wchar_t* src, size_t src_len,
 
   if (copy) {
     if (src && src_len > 0) {
-      output->str = new wchar_t[src_len+1];
-      if (!output->str)
-        return 0;
-
+      output->str = AllocSharedString<wchar_t>(src_len);
       memcpy(output->str, src, src_len * sizeof(wchar_t));
       output->str[src_len] = 0;
       output->length = src_len;
@@ -51,10 +267,7 @@ CEF_EXPORT int cef_string_utf8_set(const char* src, size_t src_len,
   cef_string_utf8_clear(output);
   if (copy) {
     if (src && src_len > 0) {
-      output->str = new char[src_len+1];
-      if (!output->str)
-        return 0;
-
+      output->str = AllocSharedString<char>(src_len);
       memcpy(output->str, src, src_len * sizeof(char));
       output->str[src_len] = 0;
       output->length = src_len;
@@ -74,10 +287,7 @@ CEF_EXPORT int cef_string_utf16_set(const char16* src, size_t src_len,
 
   if (copy) {
     if (src && src_len > 0) {
-      output->str = new char16[src_len+1];
-      if (!output->str)
-        return 0;
-
+      output->str = AllocSharedString<char16>(src_len);
       memcpy(output->str, src, src_len * sizeof(char16));
       output->str[src_len] = 0;
       output->length = src_len;
@@ -91,6 +301,30 @@ CEF_EXPORT int cef_string_utf16_set(const char16* src, size_t src_len,
   return 1;
 }
 
+CEF_EXPORT int cef_string_wide_share(const cef_string_wide_t* src,
+                                     cef_string_wide_t* output) {
+  DCHECK(src != NULL);
+  if (src == output || ShareString(src, output, string_wide_dtor))
+    return 1;
+  return cef_string_wide_set(src->str, src->length, output, true);
+}
+
+CEF_EXPORT int cef_string_utf8_share(const cef_string_utf8_t* src,
+                                     cef_string_utf8_t* output) {
+  DCHECK(src != NULL);
+  if (src == output || ShareString(src, output, string_utf8_dtor))
+    return 1;
+  return cef_string_utf8_set(src->str, src->length, output, true);
+}
+
+CEF_EXPORT int cef_string_utf16_share(const cef_string_utf16_t* src,
+                                      cef_string_utf16_t* output) {
+  DCHECK(src != NULL);
+  if (src == output || ShareString(src, output, string_utf16_dtor))
+    return 1;
+  return cef_string_utf16_set(src->str, src->length, output, true);
+}
+
 CEF_EXPORT void cef_string_wide_clear(cef_string_wide_t* str) {
   DCHECK(str != NULL);
   if (str->dtor && str->str)
@@ -170,8 +404,12 @@ CEF_EXPORT int cef_string_utf16_cmp(const cef_string_utf16_t* str1,
 
 CEF_EXPORT int cef_string_wide_to_utf8(const wchar_t* src, size_t src_len,
                                        cef_string_utf8_t* output) {
+  size_t ascii_len;
+  if (ConvertFromASCII(src, src_len, output, string_utf8_dtor, &ascii_len))
+    return true;
+
   std::string str;
-  bool ret = WideToUTF8(src, src_len, &str);
+  bool ret = ConvertFromOffset(src, src_len, ascii_len, &str);
   if (!cef_string_utf8_set(str.c_str(), str.length(), output, true))
     return false;
   return ret;
@@ -179,8 +417,12 @@ CEF_EXPORT int cef_string_wide_to_utf8(const wchar_t* src, size_t src_len,
 
 CEF_EXPORT int cef_string_utf8_to_wide(const char* src, size_t src_len,
                                        cef_string_wide_t* output) {
+  size_t ascii_len;
+  if (ConvertFromASCII(src, src_len, output, string_wide_dtor, &ascii_len))
+    return true;
+
   std::wstring str;
-  bool ret = UTF8ToWide(src, src_len, &str);
+  bool ret = ConvertFromOffset(src, src_len, ascii_len, &str);
   if (!cef_string_wide_set(str.c_str(), str.length(), output, true))
     return false;
   return ret;
@@ -188,8 +430,17 @@ CEF_EXPORT int cef_string_utf8_to_wide(const char* src, size_t src_len,
 
 CEF_EXPORT int cef_string_wide_to_utf16(const wchar_t* src, size_t src_len,
                                         cef_string_utf16_t* output) {
+  size_t ascii_len;
+  if (ConvertFromASCII(src, src_len, output, string_utf16_dtor, &ascii_len))
+    return true;
+
   string16 str;
+#if defined(WCHAR_T_IS_UTF16)
+  // Wide and UTF16 strings have the same encoding.
   bool ret = WideToUTF16(src, src_len, &str);
+#else
+  bool ret = ConvertFromOffset(src, src_len, ascii_len, &str);
+#endif
   if (!cef_string_utf16_set(str.c_str(), str.length(), output, true))
     return false;
   return ret;
@@ -197,8 +448,17 @@ CEF_EXPORT int cef_string_wide_to_utf16(const wchar_t* src, size_t src_len,
 
 CEF_EXPORT int cef_string_utf16_to_wide(const char16* src, size_t src_len,
                                         cef_string_wide_t* output) {
+  size_t ascii_len;
+  if (ConvertFromASCII(src, src_len, output, string_wide_dtor, &ascii_len))
+    return true;
+
   std::wstring str;
+#if defined(WCHAR_T_IS_UTF16)
+  // Wide and UTF16 strings have the same encoding.
   bool ret = UTF16ToWide(src, src_len, &str);
+#else
+  bool ret = ConvertFromOffset(src, src_len, ascii_len, &str);
+#endif
   if (!cef_string_wide_set(str.c_str(), str.length(), output, true))
     return false;
   return ret;
@@ -206,8 +466,12 @@ CEF_EXPORT int cef_string_utf16_to_wide(const char16* src, size_t src_len,
 
 CEF_EXPORT int cef_string_utf8_to_utf16(const char* src, size_t src_len,
                                         cef_string_utf16_t* output) {
+  size_t ascii_len;
+  if (ConvertFromASCII(src, src_len, output, string_utf16_dtor, &ascii_len))
+    return true;
+
   string16 str;
-  bool ret = UTF8ToUTF16(src, src_len, &str);
+  bool ret = ConvertFromOffset(src, src_len, ascii_len, &str);
   if (!cef_string_utf16_set(str.c_str(), str.length(), output, true))
     return false;
   return ret;
@@ -215,8 +479,12 @@ CEF_EXPORT int cef_string_utf8_to_utf16(const char* src, size_t src_len,
 
 CEF_EXPORT int cef_string_utf16_to_utf8(const char16* src, size_t src_len,
                                         cef_string_utf8_t* output) {
+  size_t ascii_len;
+  if (ConvertFromASCII(src, src_len, output, string_utf8_dtor, &ascii_len))
+    return true;
+
   std::string str;
-  bool ret = UTF16ToUTF8(src, src_len, &str);
+  bool ret = ConvertFromOffset(src, src_len, ascii_len, &str);
   if (!cef_string_utf8_set(str.c_str(), str.length(), output, true))
     return false;
   return ret;
@@ -224,14 +492,16 @@ CEF_EXPORT int cef_string_utf16_to_utf8(const char16* src, size_t src_len,
 
 CEF_EXPORT int cef_string_ascii_to_wide(const char* src, size_t src_len,
                                         cef_string_wide_t* output) {
-  std::wstring str = ASCIIToWide(std::string(src, src_len));
-  return cef_string_wide_set(str.c_str(), str.length(), output, true);
+  DCHECK(!src || ASCIIPrefixLength(src, src_len) == src_len);
+  SetFromASCII(src, src_len, output, string_wide_dtor);
+  return true;
 }
 
 CEF_EXPORT int cef_string_ascii_to_utf16(const char* src, size_t src_len,
                                          cef_string_utf16_t* output) {
-  string16 str = ASCIIToUTF16(std::string(src, src_len));
-  return cef_string_utf16_set(str.c_str(), str.length(), output, true);
+  DCHECK(!src || ASCIIPrefixLength(src, src_len) == src_len);
+  SetFromASCII(src, src_len, output, string_utf16_dtor);
+  return true;
 }
 
 CEF_EXPORT cef_string_userfree_wide_t cef_string_userfree_wide_alloc() {
@@ -4,15 +4,20 @@
 
 #include "include/cef_task.h"
 #include "libcef/browser/thread_util.h"
+#include "libcef/common/task_queue.h"
+#include "libcef/common/worker_pool.h"
 #include "libcef/renderer/thread_util.h"
 
 #include "base/bind.h"
+#include "base/bind_helpers.h"
+#include "base/lazy_instance.h"
 
 using content::BrowserThread;
 
 namespace {
 
 const int kRenderThreadId = -1;
+const int kWorkerThreadId = -2;
 const int kInvalidThreadId = -10;
 
 int GetThreadId(CefThreadId threadId) {
@@ -43,6 +48,9 @@ int GetThreadId(CefThreadId threadId) {
   case TID_RENDERER:
     id = kRenderThreadId;
     break;
+  case TID_WORKER:
+    // The worker pool is available in all processes.
+    return kWorkerThreadId;
   default:
     NOTREACHED() << "invalid thread id " << threadId;
     return kInvalidThreadId;
@@ -63,46 +71,196 @@ int GetThreadId(CefThreadId threadId) {
   return kInvalidThreadId;
 }
 
-}  // namespace
+// Holds a function posted with cef_post_task_function() and calls the release
+// function, if any, when destroyed without having run.
+class TaskFunctionHolder {
+ public:
+  TaskFunctionHolder(cef_task_function_t function,
+                     cef_task_function_t release,
+                     void* context)
+      : function_(function),
+        release_(release),
+        context_(context),
+        executed_(false) {
+  }
 
-bool CefCurrentlyOn(CefThreadId threadId) {
+  ~TaskFunctionHolder() {
+    if (!executed_ && release_)
+      release_(context_);
+  }
+
+  void Run() {
+    executed_ = true;
+    function_(context_);
+  }
+
+ private:
+  cef_task_function_t function_;
+  cef_task_function_t release_;
+  void* context_;
+  bool executed_;
+
+  DISALLOW_COPY_AND_ASSIGN(TaskFunctionHolder);
+};
+
+base::Closure BindTaskFunction(cef_task_function_t function,
+                               cef_task_function_t release,
+                               void* context) {
+  // The holder is deleted along with the closure, whether or not it has run.
+  return base::Bind(&TaskFunctionHolder::Run,
+      base::Owned(new TaskFunctionHolder(function, release, context)));
+}
+
+bool PostClosure(CefThreadId threadId, const base::Closure& closure) {
   int id = GetThreadId(threadId);
   if (id >= 0) {
     // Browser process.
-    return CEF_CURRENTLY_ON(static_cast<BrowserThread::ID>(id));
+    return CEF_POST_TASK(static_cast<BrowserThread::ID>(id), closure);
   } else if (id == kRenderThreadId) {
     // Renderer process.
-    return CEF_CURRENTLY_ON_RT();
+    return CEF_POST_TASK_RT(closure);
+  } else if (id == kWorkerThreadId) {
+    return CefWorkerPool::GetInstance()->PostTask(WORKER_PRIORITY_NORMAL,
+                                                  closure, 0);
   }
   return false;
 }
 
-bool CefPostTask(CefThreadId threadId, CefRefPtr<CefTask> task) {
+bool PostDelayedClosure(CefThreadId threadId, const base::Closure& closure,
+                        int64 delay_ms) {
   int id = GetThreadId(threadId);
   if (id >= 0) {
     // Browser process.
-    return CEF_POST_TASK(static_cast<BrowserThread::ID>(id),
-        base::Bind(&CefTask::Execute, task, threadId));
+    return CEF_POST_DELAYED_TASK(static_cast<BrowserThread::ID>(id), closure,
+        base::TimeDelta::FromMilliseconds(delay_ms));
   } else if (id == kRenderThreadId) {
     // Renderer process.
-    return CEF_POST_TASK_RT(base::Bind(&CefTask::Execute, task, threadId));
+    return CEF_POST_DELAYED_TASK_RT(closure,
+        base::TimeDelta::FromMilliseconds(delay_ms));
+  } else if (id == kWorkerThreadId) {
+    return CefWorkerPool::GetInstance()->PostTask(WORKER_PRIORITY_NORMAL,
+                                                  closure, delay_ms);
   }
   return false;
 }
 
-bool CefPostDelayedTask(CefThreadId threadId, CefRefPtr<CefTask> task,
-                        int64 delay_ms) {
+// Task queues for each named thread. Tasks posted without a delay are added to
+// these queues so that many tasks posted in quick succession share a single
+// wake-up of the target thread. TID_WORKER tasks go directly to the worker
+// pool instead.
+class CefTaskQueues {
+ public:
+  CefTaskQueues() {
+    for (int i = 0; i < kQueueCount; ++i) {
+      CefThreadId threadId = static_cast<CefThreadId>(i);
+      queues_[i] = new CefTaskQueue(threadId,
+                                    base::Bind(&PostClosure, threadId));
+    }
+  }
+
+  CefTaskQueue* GetQueue(CefThreadId threadId) {
+    DCHECK_GE(threadId, 0);
+    DCHECK_LT(threadId, kQueueCount);
+    return queues_[threadId];
+  }
+
+ private:
+  static const int kQueueCount = TID_RENDERER + 1;
+
+  // Queues are never deleted.
+  CefTaskQueue* queues_[kQueueCount];
+};
+
+base::LazyInstance<CefTaskQueues>::Leaky g_task_queues =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+bool CefCurrentlyOn(CefThreadId threadId) {
   int id = GetThreadId(threadId);
   if (id >= 0) {
     // Browser process.
-    return CEF_POST_DELAYED_TASK(static_cast<BrowserThread::ID>(id),
-        base::Bind(&CefTask::Execute, task, threadId),
-            base::TimeDelta::FromMilliseconds(delay_ms));
+    return CEF_CURRENTLY_ON(static_cast<BrowserThread::ID>(id));
   } else if (id == kRenderThreadId) {
     // Renderer process.
-    return CEF_POST_DELAYED_TASK_RT(
-        base::Bind(&CefTask::Execute, task, threadId),
-            base::TimeDelta::FromMilliseconds(delay_ms));
+    return CEF_CURRENTLY_ON_RT();
+  } else if (id == kWorkerThreadId) {
+    return CefWorkerPool::GetInstance()->RunsTasksOnCurrentThread();
   }
   return false;
 }
+
+bool CefPostTask(CefThreadId threadId, CefRefPtr<CefTask> task) {
+  int id = GetThreadId(threadId);
+  if (id == kWorkerThreadId)
+    return CefPostWorkerTask(WORKER_PRIORITY_NORMAL, task);
+  if (id == kInvalidThreadId)
+    return false;
+  return g_task_queues.Get().GetQueue(threadId)->Add(task);
+}
+
+bool CefPostTaskBatch(CefThreadId threadId, const CefTaskList& tasks) {
+  int id = GetThreadId(threadId);
+  if (id == kWorkerThreadId) {
+    // Worker tasks may run in parallel so there is no ordering to preserve.
+    CefTaskList::const_iterator it = tasks.begin();
+    for (; it != tasks.end(); ++it) {
+      if (it->get() && !CefPostWorkerTask(WORKER_PRIORITY_NORMAL, *it))
+        return false;
+    }
+    return true;
+  }
+  if (id == kInvalidThreadId)
+    return false;
+  return g_task_queues.Get().GetQueue(threadId)->Add(tasks);
+}
+
+bool CefPostDelayedTask(CefThreadId threadId, CefRefPtr<CefTask> task,
+                        int64 delay_ms) {
+  return PostDelayedClosure(threadId,
+      base::Bind(&CefTask::Execute, task, threadId), delay_ms);
+}
+
+bool CefPostWorkerTask(CefWorkerPriority priority, CefRefPtr<CefTask> task) {
+  DCHECK(task.get());
+  if (!task.get())
+    return false;
+  return CefWorkerPool::GetInstance()->PostTask(priority,
+      base::Bind(&CefTask::Execute, task, TID_WORKER), 0);
+}
+
+int CefGetWorkerQueueDepth(CefWorkerPriority priority) {
+  return CefWorkerPool::GetInstance()->GetQueueDepth(priority);
+}
+
+int CefGetWorkerThreadCount() {
+  return CefWorkerPool::GetInstance()->GetThreadCount();
+}
+
+CEF_EXPORT int cef_post_task_function(cef_thread_id_t threadId,
+                                      cef_task_function_t function,
+                                      cef_task_function_t release,
+                                      void* context) {
+  DCHECK(function);
+  if (!function) {
+    if (release)
+      release(context);
+    return false;
+  }
+  return PostClosure(threadId, BindTaskFunction(function, release, context));
+}
+
+CEF_EXPORT int cef_post_delayed_task_function(cef_thread_id_t threadId,
+                                              cef_task_function_t function,
+                                              cef_task_function_t release,
+                                              void* context,
+                                              int64 delay_ms) {
+  DCHECK(function);
+  if (!function) {
+    if (release)
+      release(context);
+    return false;
+  }
+  return PostDelayedClosure(threadId,
+      BindTaskFunction(function, release, context), delay_ms);
+}
@@ -0,0 +1,141 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/task_queue.h"
+#include "base/bind.h"
+#include "base/bind_helpers.h"
+#include "base/logging.h"
+
+// Owned by the posted closure. Discards the queued tasks if the closure is
+// destroyed without running.
+class CefTaskQueue::PendingExecute {
+ public:
+  explicit PendingExecute(CefTaskQueue* queue)
+      : queue_(queue) {
+  }
+  ~PendingExecute() {
+    if (queue_)
+      queue_->Discard();
+  }
+
+  void Run() {
+    CefTaskQueue* queue = queue_;
+    queue_ = NULL;
+    queue->Execute();
+  }
+
+  // Called if the closure could not be posted. The caller of Add() handles
+  // the failure instead.
+  void Cancel() {
+    queue_ = NULL;
+  }
+
+ private:
+  // The queue is only referenced by a leaked global so the pointer is always
+  // valid.
+  CefTaskQueue* queue_;
+
+  DISALLOW_COPY_AND_ASSIGN(PendingExecute);
+};
+
+CefTaskQueue::CefTaskQueue(CefThreadId thread_id,
+                           const PostCallback& post_callback)
+    : thread_id_(thread_id),
+      post_callback_(post_callback),
+      state_(STATE_IDLE) {
+}
+
+CefTaskQueue::~CefTaskQueue() {
+}
+
+bool CefTaskQueue::Add(CefRefPtr<CefTask> task) {
+  DCHECK(task.get());
+  if (!task.get())
+    return true;
+  return AddTasks(&task, 1);
+}
+
+bool CefTaskQueue::Add(const CefTaskList& tasks) {
+  if (tasks.empty())
+    return true;
+  return AddTasks(&tasks[0], tasks.size());
+}
+
+bool CefTaskQueue::AddTasks(const CefRefPtr<CefTask>* tasks, size_t count) {
+  size_t start;
+  size_t added = 0;
+  bool post;
+  {
+    base::AutoLock lock_scope(lock_);
+    start = tasks_.size();
+    for (size_t i = 0; i < count; ++i) {
+      DCHECK(tasks[i].get());
+      if (tasks[i].get()) {
+        tasks_.push_back(tasks[i]);
+        added++;
+      }
+    }
+    if (added == 0)
+      return true;
+
+    post = (state_ == STATE_IDLE);
+    if (post)
+      state_ = STATE_POSTING;
+  }
+
+  if (!post) {
+    // A closure is pending or being posted and will execute the new tasks.
+    return true;
+  }
+
+  PendingExecute* pending = new PendingExecute(this);
+  base::Closure closure(base::Bind(&PendingExecute::Run,
+                                   base::Owned(pending)));
+  if (post_callback_.Run(closure)) {
+    base::AutoLock lock_scope(lock_);
+    // The closure may already have run or been destroyed on another thread.
+    if (state_ == STATE_POSTING)
+      state_ = STATE_PENDING;
+    return true;
+  }
+
+  // |closure| still owns |pending|. Only the tasks added by this call are
+  // removed. Tasks that other callers added while the post was in progress
+  // stay queued for the next successful post.
+  pending->Cancel();
+  std::vector<CefRefPtr<CefTask> > removed;
+  {
+    base::AutoLock lock_scope(lock_);
+    DCHECK_EQ(STATE_POSTING, state_);
+    DCHECK_LE(start + added, tasks_.size());
+    removed.assign(tasks_.begin() + start, tasks_.begin() + start + added);
+    tasks_.erase(tasks_.begin() + start, tasks_.begin() + start + added);
+    state_ = STATE_IDLE;
+  }
+  return false;
+}
+
+void CefTaskQueue::Execute() {
+  std::vector<CefRefPtr<CefTask> > tasks;
+  {
+    base::AutoLock lock_scope(lock_);
+    tasks.swap(tasks_);
+    state_ = STATE_IDLE;
+  }
+
+  std::vector<CefRefPtr<CefTask> >::const_iterator it = tasks.begin();
+  for (; it != tasks.end(); ++it)
+    (*it)->Execute(thread_id_);
+}
+
+void CefTaskQueue::Discard() {
+  // Tasks are released after the lock is released because their destructors
+  // may add new tasks.
+  std::vector<CefRefPtr<CefTask> > tasks;
+  {
+    base::AutoLock lock_scope(lock_);
+    tasks.swap(tasks_);
+    state_ = STATE_IDLE;
+  }
+}
@@ -0,0 +1,80 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_TASK_QUEUE_H_
+#define CEF_LIBCEF_COMMON_TASK_QUEUE_H_
+#pragma once
+
+#include <vector>
+
+#include "include/cef_task.h"
+#include "base/basictypes.h"
+#include "base/callback.h"
+#include "base/synchronization/lock.h"
+
+// Queue of CefTask objects that will be executed on a single target thread.
+// Tasks may be added from any thread. The tasks are executed in the order they
+// were added by a single closure that is posted to the target thread only when
+// the queue changes from empty to non-empty, so a burst of tasks from any
+// number of threads costs a single wake-up of the target thread. The lock is
+// only held while tasks are appended or taken. It is never held while the
+// closure is posted or while tasks are executed, so tasks may be added from
+// any callback that the post triggers.
+class CefTaskQueue {
+ public:
+  // Callback used to post a closure to the target thread. Returns false if the
+  // closure could not be posted.
+  typedef base::Callback<bool(const base::Closure&)> PostCallback;
+
+  CefTaskQueue(CefThreadId thread_id, const PostCallback& post_callback);
+  ~CefTaskQueue();
+
+  // Add |task| to the queue. Returns false if the target thread is not
+  // available, in which case |task| is not queued.
+  bool Add(CefRefPtr<CefTask> task);
+
+  // Add all |tasks| to the queue in order. Tasks added by other threads at the
+  // same time will not be interleaved with |tasks|. Returns false if the
+  // target thread is not available, in which case none of |tasks| are queued.
+  bool Add(const CefTaskList& tasks);
+
+ private:
+  class PendingExecute;
+
+  enum State {
+    // No closure is pending. Tasks left in the queue by a failed post are
+    // executed by the next successful post.
+    STATE_IDLE,
+    // A closure is being posted by one of the callers of Add().
+    STATE_POSTING,
+    // A closure has been posted and has not yet taken the queued tasks.
+    STATE_PENDING,
+  };
+
+  // Add |count| tasks starting at |tasks| to the queue.
+  bool AddTasks(const CefRefPtr<CefTask>* tasks, size_t count);
+
+  // Execute all queued tasks on the target thread.
+  void Execute();
+
+  // Release all queued tasks without executing them. Called if the posted
+  // closure is destroyed without running, for example because the target
+  // thread's message loop was destroyed.
+  void Discard();
+
+  const CefThreadId thread_id_;
+  PostCallback post_callback_;
+
+  // Protects the below members.
+  base::Lock lock_;
+
+  // Tasks waiting for Execute() in the order they were added.
+  std::vector<CefRefPtr<CefTask> > tasks_;
+
+  State state_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefTaskQueue);
+};
+
+#endif  // CEF_LIBCEF_COMMON_TASK_QUEUE_H_
@@ -0,0 +1,186 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "libcef/common/worker_pool.h"
+
+#include <algorithm>
+
+#include "base/lazy_instance.h"
+#include "base/logging.h"
+#include "base/sys_info.h"
+
+namespace {
+
+const char kWorkerThreadName[] = "CefWorker";
+
+base::LazyInstance<CefWorkerPool>::Leaky g_worker_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
+bool CefWorkerPool::DelayedTask::operator<(const DelayedTask& other) const {
+  // std::priority_queue returns the largest element first so the comparison
+  // is reversed.
+  if (run_time == other.run_time)
+    return sequence_num > other.sequence_num;
+  return run_time > other.run_time;
+}
+
+// static
+CefWorkerPool* CefWorkerPool::GetInstance() {
+  return g_worker_pool.Pointer();
+}
+
+CefWorkerPool::CefWorkerPool()
+    : thread_count_(std::max(1, base::SysInfo::NumberOfProcessors())),
+      task_available_(&lock_),
+      threads_started_(false),
+      shutdown_(false),
+      next_sequence_num_(0) {
+}
+
+bool CefWorkerPool::PostTask(CefWorkerPriority priority,
+                             const base::Closure& task,
+                             int64 delay_ms) {
+  if (priority < 0 || priority >= kPriorityCount) {
+    NOTREACHED() << "invalid worker priority " << priority;
+    return false;
+  }
+
+  {
+    base::AutoLock lock_scope(lock_);
+    if (shutdown_)
+      return false;
+
+    StartThreadsIfNeeded();
+
+    if (delay_ms > 0) {
+      DelayedTask delayed_task;
+      delayed_task.run_time = base::TimeTicks::Now() +
+          base::TimeDelta::FromMilliseconds(delay_ms);
+      delayed_task.sequence_num = next_sequence_num_++;
+      delayed_task.priority = priority;
+      delayed_task.task = task;
+      delayed_tasks_.push(delayed_task);
+
+      // Waiting threads may need to shorten their timeout.
+      task_available_.Broadcast();
+      return true;
+    }
+
+    pending_tasks_[priority].push_back(task);
+  }
+
+  task_available_.Signal();
+  return true;
+}
+
+void CefWorkerPool::Shutdown() {
+  DCHECK(!RunsTasksOnCurrentThread());
+
+  std::vector<base::PlatformThreadHandle> threads;
+
+  // Tasks are destroyed after the lock is released because their destructors
+  // may post new tasks.
+  std::deque<base::Closure> pending_tasks[kPriorityCount];
+  DelayedTaskQueue delayed_tasks;
+
+  {
+    base::AutoLock lock_scope(lock_);
+    if (shutdown_)
+      return;
+    shutdown_ = true;
+
+    threads.swap(threads_);
+    for (int i = 0; i < kPriorityCount; ++i)
+      pending_tasks[i].swap(pending_tasks_[i]);
+    delayed_tasks = delayed_tasks_;
+    delayed_tasks_ = DelayedTaskQueue();
+  }
+
+  // Wake all idle threads so that they exit.
+  task_available_.Broadcast();
+
+  for (size_t i = 0; i < threads.size(); ++i)
+    base::PlatformThread::Join(threads[i]);
+}
+
+bool CefWorkerPool::RunsTasksOnCurrentThread() const {
+  return is_worker_thread_.Get();
+}
+
+int CefWorkerPool::GetQueueDepth(CefWorkerPriority priority) {
+  if (priority < 0 || priority >= kPriorityCount) {
+    NOTREACHED() << "invalid worker priority " << priority;
+    return 0;
+  }
+
+  base::AutoLock lock_scope(lock_);
+  PromoteDelayedTasks(base::TimeTicks::Now());
+  return static_cast<int>(pending_tasks_[priority].size());
+}
+
+void CefWorkerPool::ThreadMain() {
+  base::PlatformThread::SetName(kWorkerThreadName);
+  is_worker_thread_.Set(true);
+
+  while (true) {
+    base::Closure task;
+    if (!TakeTask(&task))
+      return;
+    task.Run();
+  }
+}
+
+bool CefWorkerPool::TakeTask(base::Closure* task) {
+  base::AutoLock lock_scope(lock_);
+
+  while (true) {
+    if (shutdown_)
+      return false;
+
+    PromoteDelayedTasks(base::TimeTicks::Now());
+
+    for (int i = 0; i < kPriorityCount; ++i) {
+      if (!pending_tasks_[i].empty()) {
+        *task = pending_tasks_[i].front();
+        pending_tasks_[i].pop_front();
+        return true;
+      }
+    }
+
+    if (delayed_tasks_.empty()) {
+      task_available_.Wait();
+    } else {
+      task_available_.TimedWait(
+          delayed_tasks_.top().run_time - base::TimeTicks::Now());
+    }
+  }
+}
+
+void CefWorkerPool::PromoteDelayedTasks(base::TimeTicks now) {
+  lock_.AssertAcquired();
+
+  while (!delayed_tasks_.empty() && delayed_tasks_.top().run_time <= now) {
+    const DelayedTask& delayed_task = delayed_tasks_.top();
+    pending_tasks_[delayed_task.priority].push_back(delayed_task.task);
+    delayed_tasks_.pop();
+  }
+}
+
+void CefWorkerPool::StartThreadsIfNeeded() {
+  lock_.AssertAcquired();
+
+  if (threads_started_)
+    return;
+  threads_started_ = true;
+
+  for (int i = 0; i < thread_count_; ++i) {
+    base::PlatformThreadHandle thread;
+    if (base::PlatformThread::Create(0, this, &thread))
+      threads_.push_back(thread);
+    else
+      LOG(ERROR) << "failed to create worker thread";
+  }
+}
@@ -0,0 +1,104 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_COMMON_WORKER_POOL_H_
+#define CEF_LIBCEF_COMMON_WORKER_POOL_H_
+#pragma once
+
+#include <deque>
+#include <queue>
+#include <vector>
+
+#include "include/cef_task.h"
+#include "base/basictypes.h"
+#include "base/callback.h"
+#include "base/synchronization/condition_variable.h"
+#include "base/synchronization/lock.h"
+#include "base/threading/platform_thread.h"
+#include "base/threading/thread_local.h"
+#include "base/time.h"
+
+// Pool of worker threads that backs TID_WORKER. One thread is created for
+// each processor the first time a task is posted. Pending tasks are kept in a
+// separate FIFO queue for each priority and idle threads always take the
+// oldest task from the highest priority queue that is not empty. Shutdown()
+// stops and joins the threads. The pool object itself is leaked so that tasks
+// posted after shutdown fail instead of touching a deleted object.
+class CefWorkerPool : public base::PlatformThread::Delegate {
+ public:
+  // Returns the pool for the current process.
+  static CefWorkerPool* GetInstance();
+
+  CefWorkerPool();
+
+  // Post |task| for execution with the specified |priority| after |delay_ms|
+  // milliseconds. Returns false after Shutdown() has been called. May be
+  // called on any thread.
+  bool PostTask(CefWorkerPriority priority, const base::Closure& task,
+                int64 delay_ms);
+
+  // Discard tasks that have not started yet and block until the worker
+  // threads have finished their current task and exited. Tasks that are
+  // running must not wait on the calling thread. Must not be called on a
+  // worker thread.
+  void Shutdown();
+
+  // Returns true if called on a worker thread.
+  bool RunsTasksOnCurrentThread() const;
+
+  // Returns the number of tasks with the specified |priority| that are ready
+  // to run but have not yet been taken by a worker thread.
+  int GetQueueDepth(CefWorkerPriority priority);
+
+  // Returns the number of worker threads.
+  int GetThreadCount() const { return thread_count_; }
+
+ private:
+  static const int kPriorityCount = WORKER_PRIORITY_LOW + 1;
+
+  struct DelayedTask {
+    base::TimeTicks run_time;
+    int64 sequence_num;
+    CefWorkerPriority priority;
+    base::Closure task;
+
+    // Used by |delayed_tasks_| to order the earliest task first. Tasks with
+    // the same run time are ordered by the sequence in which they were posted.
+    bool operator<(const DelayedTask& other) const;
+  };
+  typedef std::priority_queue<DelayedTask> DelayedTaskQueue;
+
+  // base::PlatformThread::Delegate methods.
+  virtual void ThreadMain() OVERRIDE;
+
+  // Block until a task is ready to run and return it in |task|. Returns false
+  // if the pool is shutting down.
+  bool TakeTask(base::Closure* task);
+
+  // Move delayed tasks that are due at |now| to the pending queues. Must be
+  // called with |lock_| held.
+  void PromoteDelayedTasks(base::TimeTicks now);
+
+  // Create the worker threads if they have not already been created. Must be
+  // called with |lock_| held.
+  void StartThreadsIfNeeded();
+
+  const int thread_count_;
+
+  base::Lock lock_;
+  base::ConditionVariable task_available_;
+  bool threads_started_;
+  bool shutdown_;
+  std::vector<base::PlatformThreadHandle> threads_;
+  int64 next_sequence_num_;
+  std::deque<base::Closure> pending_tasks_[kPriorityCount];
+  DelayedTaskQueue delayed_tasks_;
+
+  // Set to true on each worker thread.
+  base::ThreadLocalBoolean is_worker_thread_;
+
+  DISALLOW_COPY_AND_ASSIGN(CefWorkerPool);
+};
+
+#endif  // CEF_LIBCEF_COMMON_WORKER_POOL_H_
@@ -15,12 +15,14 @@ MSVC_POP_WARNING();
 
 #include "libcef/common/cef_messages.h"
 #include "libcef/common/content_client.h"
+#include "libcef/common/startup_timeline.h"
 #include "libcef/renderer/browser_impl.h"
 #include "libcef/renderer/chrome_bindings.h"
 #include "libcef/renderer/render_process_observer.h"
 #include "libcef/renderer/thread_util.h"
 #include "libcef/renderer/v8_impl.h"
 
+#include "base/bind.h"
 #include "content/common/child_thread.h"
 #include "content/public/renderer/render_thread.h"
 #include "content/public/renderer/render_view.h"
@@ -63,6 +65,29 @@ class CefPrerendererClient : public content::RenderViewObserver,
   virtual void willAddPrerender(WebKit::WebPrerender* prerender) OVERRIDE {}
 };
 
+// Forward completed startup phases to the browser process.
+void SendStartupPhases(const CefStartupTimeline::PhaseList& phases) {
+  if (!CEF_CURRENTLY_ON_RT()) {
+    CEF_POST_TASK_RT(base::Bind(&SendStartupPhases, phases));
+    return;
+  }
+
+  std::vector<CefProcessHostMsg_StartupPhase_Params> params;
+  CefStartupTimeline::PhaseList::const_iterator it = phases.begin();
+  for (; it != phases.end(); ++it) {
+    CefProcessHostMsg_StartupPhase_Params param;
+    param.name = it->name;
+    param.start_time = it->start_time.ToInternalValue();
+    param.end_time = it->end_time.ToInternalValue();
+    param.process_id = it->process_id;
+    param.inherited = it->inherited;
+    params.push_back(param);
+  }
+
+  content::RenderThread::Get()->Send(
+      new CefProcessHostMsg_StartupPhases(params));
+}
+
 }  // namespace
 
 struct CefContentRendererClient::SchemeInfo {
@@ -149,6 +174,8 @@ void CefContentRendererClient::RegisterCustomSchemes() {
 }
 
 void CefContentRendererClient::RenderThreadStarted() {
+  CefScopedStartupPhase startup_phase("RenderThreadStarted");
+
   render_loop_ = base::MessageLoopProxy::current();
   observer_.reset(new CefRenderProcessObserver());
 
@@ -157,15 +184,25 @@ void CefContentRendererClient::RenderThreadStarted() {
 
   WebKit::WebPrerenderingSupport::initialize(new CefPrerenderingSupport());
 
-  thread->Send(new CefProcessHostMsg_RenderThreadStarted);
-
   // Notify the render process handler.
   CefRefPtr<CefApp> application = CefContentClient::Get()->application();
   if (application.get()) {
     CefRefPtr<CefRenderProcessHandler> handler =
         application->GetRenderProcessHandler();
-    if (handler.get())
+    if (handler.get()) {
+      CefScopedStartupPhase handler_phase("OnRenderThreadCreated");
       handler->OnRenderThreadCreated();
+    }
+  }
+
+  // Tell the browser that initialization of this process is complete.
+  thread->Send(new CefProcessHostMsg_RenderThreadStarted);
+
+  // Report startup phases to the browser process. In single-process mode the
+  // phases are reported by the browser process timeline.
+  if (!content::GetContentClient()->browser()) {
+    CefStartupTimeline::GetInstance()->SetDelegate(
+        base::Bind(&SendStartupPhases));
   }
 }
 
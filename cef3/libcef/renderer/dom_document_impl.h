@@ -60,7 +60,7 @@ class CefDOMDocumentImpl : public CefDOMDocument {
   typedef std::map<WebKit::WebNode, CefDOMNode*> NodeMap;
   NodeMap node_map_;
 
-  IMPLEMENT_REFCOUNTING(CefDOMDocumentImpl);
+  IMPLEMENT_SINGLE_THREAD_REFCOUNTING(CefDOMDocumentImpl);
 };
 
 #endif  // CEF_LIBCEF_DOM_DOCUMENT_IMPL_H_
@@ -37,7 +37,7 @@ class CefDOMEventImpl : public CefDOMEvent {
   CefRefPtr<CefDOMDocumentImpl> document_;
   WebKit::WebDOMEvent event_;
 
-  IMPLEMENT_REFCOUNTING(CefDOMEventImpl);
+  IMPLEMENT_SINGLE_THREAD_REFCOUNTING(CefDOMEventImpl);
 };
 
 #endif  // CEF_LIBCEF_DOM_EVENT_IMPL_H_
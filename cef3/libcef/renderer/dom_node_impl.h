@@ -58,7 +58,7 @@ class CefDOMNodeImpl : public CefDOMNode {
   CefRefPtr<CefDOMDocumentImpl> document_;
   WebKit::WebNode node_;
 
-  IMPLEMENT_REFCOUNTING(CefDOMNodeImpl);
+  IMPLEMENT_SINGLE_THREAD_REFCOUNTING(CefDOMNodeImpl);
 };
 
 #endif  // CEF_LIBCEF_DOM_NODE_IMPL_H_
@@ -8,17 +8,24 @@
 #include "libcef/common/content_client.h"
 #include "libcef/renderer/content_renderer_client.h"
 
+#include "base/allocator/allocator_extension.h"
 #include "base/bind.h"
 #include "base/path_service.h"
+#include "content/public/renderer/render_thread.h"
 #include "googleurl/src/gurl.h"
 #include "googleurl/src/url_util.h"
 #include "media/base/media.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/WebCache.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/WebCrossOriginPreflightResultCache.h"
+#include "third_party/WebKit/Source/WebKit/chromium/public/WebFontCache.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebRuntimeFeatures.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/WebSecurityPolicy.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebString.h"
 #include "third_party/WebKit/Source/WebKit/chromium/public/platform/WebURL.h"
+#include "v8/include/v8.h"
 
-CefRenderProcessObserver::CefRenderProcessObserver() {
+CefRenderProcessObserver::CefRenderProcessObserver()
+    : webkit_initialized_(false) {
   // Note that under Linux, the media library will normally already have
   // been initialized by the Zygote before this instance became a Renderer.
   FilePath media_path;
@@ -38,12 +45,16 @@ bool CefRenderProcessObserver::OnControlMessageReceived(
                         OnModifyCrossOriginWhitelistEntry)
     IPC_MESSAGE_HANDLER(CefProcessMsg_ClearCrossOriginWhitelist,
                         OnClearCrossOriginWhitelist)
+    IPC_MESSAGE_HANDLER(CefProcessMsg_MemoryPressure, OnMemoryPressure)
+    IPC_MESSAGE_HANDLER(CefProcessMsg_GetResourceUsage, OnGetResourceUsage)
     IPC_MESSAGE_UNHANDLED(handled = false)
   IPC_END_MESSAGE_MAP()
   return handled;
 }
 
 void CefRenderProcessObserver::WebKitInitialized() {
+  webkit_initialized_ = true;
+
   WebKit::WebRuntimeFeatures::enableMediaPlayer(
       media::IsMediaLibraryInitialized());
 
@@ -88,3 +99,67 @@ void CefRenderProcessObserver::OnModifyCrossOriginWhitelistEntry(
 void CefRenderProcessObserver::OnClearCrossOriginWhitelist() {
   WebKit::WebSecurityPolicy::resetOriginAccessWhitelists();
 }
+
+void CefRenderProcessObserver::OnMemoryPressure(int request_id, int level) {
+  const int64 size_before = GetReleasableMemorySize();
+
+  // WebKit and V8 hold no memory before they are initialized. Don't initialize
+  // them just to release memory.
+  if (webkit_initialized_) {
+    // Evict unused resources and decoded image data from the memory cache.
+    WebKit::WebCache::clear();
+
+    if (level == MEMORY_PRESSURE_LEVEL_CRITICAL) {
+      WebKit::WebFontCache::clear();
+      WebKit::WebCrossOriginPreflightResultCache::clear();
+      v8::V8::LowMemoryNotification();
+    } else {
+      v8::V8::IdleNotification();
+    }
+  }
+
+  if (level == MEMORY_PRESSURE_LEVEL_CRITICAL) {
+    // Return free pages held by the allocator to the system.
+    base::allocator::ReleaseFreeMemory();
+  }
+
+  // Other threads may allocate memory in the meantime.
+  int64 bytes_freed = size_before - GetReleasableMemorySize();
+  if (bytes_freed < 0)
+    bytes_freed = 0;
+
+  content::RenderThread::Get()->Send(
+      new CefProcessHostMsg_MemoryReleased(request_id, bytes_freed));
+}
+
+void CefRenderProcessObserver::OnGetResourceUsage(int request_id) {
+  // CPU time and private memory are measured by the browser process. The
+  // sandbox may prevent this process from measuring itself.
+  CefProcessHostMsg_ResourceUsage_Params params;
+  params.v8_heap_used_bytes = 0;
+  params.v8_heap_total_bytes = 0;
+
+  if (webkit_initialized_) {
+    v8::HeapStatistics heap_stats;
+    v8::V8::GetHeapStatistics(&heap_stats);
+    params.v8_heap_used_bytes = heap_stats.used_heap_size();
+    params.v8_heap_total_bytes = heap_stats.total_heap_size();
+  }
+
+  content::RenderThread::Get()->Send(
+      new CefProcessHostMsg_ResourceUsage(request_id, params));
+}
+
+int64 CefRenderProcessObserver::GetReleasableMemorySize() {
+  if (!webkit_initialized_)
+    return 0;
+
+  WebKit::WebCache::UsageStats cache_stats;
+  WebKit::WebCache::getUsageStats(&cache_stats);
+
+  v8::HeapStatistics heap_stats;
+  v8::V8::GetHeapStatistics(&heap_stats);
+
+  return static_cast<int64>(cache_stats.liveSize) + cache_stats.deadSize +
+         heap_stats.used_heap_size();
+}
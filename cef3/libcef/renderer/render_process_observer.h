@@ -7,6 +7,7 @@
 #define CEF_LIBCEF_RENDERER_RENDER_PROCESS_OBSERVER_H_
 
 #include <string>
+#include "base/basictypes.h"
 #include "base/memory/ref_counted.h"
 #include "content/public/renderer/render_process_observer.h"
 
@@ -28,6 +29,14 @@ class CefRenderProcessObserver : public content::RenderProcessObserver {
                                          const std::string& target_domain,
                                          bool allow_target_subdomains);
   void OnClearCrossOriginWhitelist();
+  void OnMemoryPressure(int request_id, int level);
+  void OnGetResourceUsage(int request_id);
+
+  // Returns the size of the memory that OnMemoryPressure() may release.
+  int64 GetReleasableMemorySize();
+
+  // True after WebKit and V8 have been initialized.
+  bool webkit_initialized_;
 
   DISALLOW_COPY_AND_ASSIGN(CefRenderProcessObserver);
 };
@@ -71,6 +71,10 @@ class CefBaseCppToC : public CefBase {
     : class_(cls) {
     DCHECK(cls);
 
+    // Hold a single reference to the underlying class for the lifetime of this
+    // wrapper.
+    class_->AddRef();
+
     struct_.class_ = this;
 
     // zero the underlying structure and set base members
@@ -80,7 +84,9 @@ class CefBaseCppToC : public CefBase {
     struct_.struct_.release = struct_release;
     struct_.struct_.get_refct = struct_get_refct;
   }
-  virtual ~CefBaseCppToC() {}
+  virtual ~CefBaseCppToC() {
+    class_->Release();
+  }
 
   CefBase* GetClass() { return class_; }
 
@@ -89,14 +95,13 @@ class CefBaseCppToC : public CefBase {
   // call UnderlyingRelease() on the wrapping CefCToCpp object.
   cef_base_t* GetStruct() { return &struct_.struct_; }
 
-  // CefBase methods increment/decrement reference counts on both this object
-  // and the underlying wrapper class.
+  // CefBase methods increment/decrement the reference count on only this
+  // object. The reference to the underlying class is released when this object
+  // is destroyed.
   int AddRef() {
-    UnderlyingAddRef();
     return refct_.AddRef();
   }
   int Release() {
-    UnderlyingRelease();
     int retval = refct_.Release();
     if (retval == 0)
       delete this;
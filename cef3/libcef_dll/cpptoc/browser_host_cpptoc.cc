@@ -13,6 +13,8 @@
 #include "libcef_dll/cpptoc/browser_cpptoc.h"
 #include "libcef_dll/cpptoc/browser_host_cpptoc.h"
 #include "libcef_dll/ctocpp/client_ctocpp.h"
+#include "libcef_dll/ctocpp/memory_pressure_callback_ctocpp.h"
+#include "libcef_dll/ctocpp/resource_usage_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/run_file_dialog_callback_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
 
@@ -270,6 +272,235 @@ void CEF_CALLBACK browser_host_run_file_dialog(struct _cef_browser_host_t* self,
       CefRunFileDialogCallbackCToCpp::Wrap(callback));
 }
 
+void CEF_CALLBACK browser_host_was_hidden(struct _cef_browser_host_t* self,
+    int hidden) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->WasHidden(
+      hidden?true:false);
+}
+
+int CEF_CALLBACK browser_host_is_hidden(struct _cef_browser_host_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefBrowserHostCppToC::Get(self)->IsHidden();
+
+  // Return type: bool
+  return _retval;
+}
+
+void CEF_CALLBACK browser_host_notify_memory_pressure(
+    struct _cef_browser_host_t* self, enum cef_memory_pressure_level_t level,
+    cef_memory_pressure_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Unverified params: callback
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->NotifyMemoryPressure(
+      level,
+      CefMemoryPressureCallbackCToCpp::Wrap(callback));
+}
+
+void CEF_CALLBACK browser_host_get_resource_usage(
+    struct _cef_browser_host_t* self,
+    cef_resource_usage_callback_t* callback) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback);
+  if (!callback)
+    return;
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->GetResourceUsage(
+      CefResourceUsageCallbackCToCpp::Wrap(callback));
+}
+
+int CEF_CALLBACK browser_host_is_window_rendering_disabled(
+    struct _cef_browser_host_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefBrowserHostCppToC::Get(self)->IsWindowRenderingDisabled();
+
+  // Return type: bool
+  return _retval;
+}
+
+void CEF_CALLBACK browser_host_was_resized(struct _cef_browser_host_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->WasResized();
+}
+
+void CEF_CALLBACK browser_host_invalidate(struct _cef_browser_host_t* self,
+    const cef_rect_t* dirtyRect) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: dirtyRect; type: simple_byref_const
+  DCHECK(dirtyRect);
+  if (!dirtyRect)
+    return;
+
+  // Translate param: dirtyRect; type: simple_byref_const
+  CefRect dirtyRectVal = dirtyRect?*dirtyRect:CefRect();
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->Invalidate(
+      dirtyRectVal);
+}
+
+void CEF_CALLBACK browser_host_send_key_event(struct _cef_browser_host_t* self,
+    const struct _cef_key_event_t* event) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: event; type: struct_byref_const
+  DCHECK(event);
+  if (!event)
+    return;
+
+  // Translate param: event; type: struct_byref_const
+  CefKeyEvent eventObj;
+  if (event)
+    eventObj.Set(*event, false);
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendKeyEvent(
+      eventObj);
+}
+
+void CEF_CALLBACK browser_host_send_mouse_click_event(
+    struct _cef_browser_host_t* self, const struct _cef_mouse_event_t* event,
+    enum cef_mouse_button_type_t type, int mouseUp, int clickCount) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: event; type: struct_byref_const
+  DCHECK(event);
+  if (!event)
+    return;
+
+  // Translate param: event; type: struct_byref_const
+  CefMouseEvent eventObj;
+  if (event)
+    eventObj.Set(*event, false);
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendMouseClickEvent(
+      eventObj,
+      type,
+      mouseUp?true:false,
+      clickCount);
+}
+
+void CEF_CALLBACK browser_host_send_mouse_move_event(
+    struct _cef_browser_host_t* self, const struct _cef_mouse_event_t* event,
+    int mouseLeave) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: event; type: struct_byref_const
+  DCHECK(event);
+  if (!event)
+    return;
+
+  // Translate param: event; type: struct_byref_const
+  CefMouseEvent eventObj;
+  if (event)
+    eventObj.Set(*event, false);
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendMouseMoveEvent(
+      eventObj,
+      mouseLeave?true:false);
+}
+
+void CEF_CALLBACK browser_host_send_mouse_wheel_event(
+    struct _cef_browser_host_t* self, const struct _cef_mouse_event_t* event,
+    int deltaX, int deltaY) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: event; type: struct_byref_const
+  DCHECK(event);
+  if (!event)
+    return;
+
+  // Translate param: event; type: struct_byref_const
+  CefMouseEvent eventObj;
+  if (event)
+    eventObj.Set(*event, false);
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendMouseWheelEvent(
+      eventObj,
+      deltaX,
+      deltaY);
+}
+
+void CEF_CALLBACK browser_host_send_focus_event(
+    struct _cef_browser_host_t* self, int setFocus) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendFocusEvent(
+      setFocus?true:false);
+}
+
+void CEF_CALLBACK browser_host_send_capture_lost_event(
+    struct _cef_browser_host_t* self) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserHostCppToC::Get(self)->SendCaptureLostEvent();
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
@@ -288,6 +519,21 @@ CefBrowserHostCppToC::CefBrowserHostCppToC(CefBrowserHost* cls)
   struct_.struct_.get_zoom_level = browser_host_get_zoom_level;
   struct_.struct_.set_zoom_level = browser_host_set_zoom_level;
   struct_.struct_.run_file_dialog = browser_host_run_file_dialog;
+  struct_.struct_.was_hidden = browser_host_was_hidden;
+  struct_.struct_.is_hidden = browser_host_is_hidden;
+  struct_.struct_.notify_memory_pressure = browser_host_notify_memory_pressure;
+  struct_.struct_.get_resource_usage = browser_host_get_resource_usage;
+  struct_.struct_.is_window_rendering_disabled =
+      browser_host_is_window_rendering_disabled;
+  struct_.struct_.was_resized = browser_host_was_resized;
+  struct_.struct_.invalidate = browser_host_invalidate;
+  struct_.struct_.send_key_event = browser_host_send_key_event;
+  struct_.struct_.send_mouse_click_event = browser_host_send_mouse_click_event;
+  struct_.struct_.send_mouse_move_event = browser_host_send_mouse_move_event;
+  struct_.struct_.send_mouse_wheel_event = browser_host_send_mouse_wheel_event;
+  struct_.struct_.send_focus_event = browser_host_send_focus_event;
+  struct_.struct_.send_capture_lost_event =
+      browser_host_send_capture_lost_event;
 }
 
 #ifndef NDEBUG
@@ -63,6 +63,55 @@ void CEF_CALLBACK browser_process_handler_on_before_child_process_launch(
       CefCommandLineCToCpp::Wrap(command_line));
 }
 
+void CEF_CALLBACK browser_process_handler_on_schedule_message_pump_work(
+    struct _cef_browser_process_handler_t* self, int64 delay_ms) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserProcessHandlerCppToC::Get(self)->OnScheduleMessagePumpWork(
+      delay_ms);
+}
+
+void CEF_CALLBACK browser_process_handler_on_spare_render_process_claimed(
+    struct _cef_browser_process_handler_t* self, int64 wait_ms,
+    int64 idle_ms) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefBrowserProcessHandlerCppToC::Get(self)->OnSpareRenderProcessClaimed(
+      wait_ms,
+      idle_ms);
+}
+
+void CEF_CALLBACK browser_process_handler_on_startup_phase(
+    struct _cef_browser_process_handler_t* self, enum cef_process_id_t process,
+    const cef_string_t* name, int64 start_us, int64 duration_us) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: name; type: string_byref_const
+  DCHECK(name);
+  if (!name)
+    return;
+
+  // Execute
+  CefBrowserProcessHandlerCppToC::Get(self)->OnStartupPhase(
+      process,
+      CefString(name),
+      start_us,
+      duration_us);
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
@@ -75,6 +124,11 @@ CefBrowserProcessHandlerCppToC::CefBrowserProcessHandlerCppToC(
       browser_process_handler_on_context_initialized;
   struct_.struct_.on_before_child_process_launch =
       browser_process_handler_on_before_child_process_launch;
+  struct_.struct_.on_schedule_message_pump_work =
+      browser_process_handler_on_schedule_message_pump_work;
+  struct_.struct_.on_spare_render_process_claimed =
+      browser_process_handler_on_spare_render_process_claimed;
+  struct_.struct_.on_startup_phase = browser_process_handler_on_startup_phase;
 }
 
 #ifndef NDEBUG
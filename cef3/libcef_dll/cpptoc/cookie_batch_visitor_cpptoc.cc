@@ -0,0 +1,64 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/cookie_batch_visitor_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+int CEF_CALLBACK cookie_batch_visitor_visit_batch(
+    struct _cef_cookie_batch_visitor_t* self, size_t cookiesCount,
+    const struct _cef_cookie_t* cookies, int offset, int total) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: cookies; type: struct_vec_byref_const
+  DCHECK(cookiesCount == 0 || cookies);
+  if (cookiesCount > 0 && !cookies)
+    return 0;
+
+  // Translate param: cookies; type: struct_vec_byref_const
+  std::vector<CefCookie > cookiesList;
+  if (cookiesCount > 0) {
+    cookiesList.resize(cookiesCount);
+    for (size_t i = 0; i < cookiesCount; ++i) {
+      cookiesList[i].Set(cookies[i], false);
+    }
+  }
+
+  // Execute
+  bool _retval = CefCookieBatchVisitorCppToC::Get(self)->VisitBatch(
+      cookiesList,
+      offset,
+      total);
+
+  // Return type: bool
+  return _retval;
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefCookieBatchVisitorCppToC::CefCookieBatchVisitorCppToC(
+    CefCookieBatchVisitor* cls)
+    : CefCppToC<CefCookieBatchVisitorCppToC, CefCookieBatchVisitor,
+        cef_cookie_batch_visitor_t>(cls) {
+  struct_.struct_.visit_batch = cookie_batch_visitor_visit_batch;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefCookieBatchVisitorCppToC, CefCookieBatchVisitor,
+    cef_cookie_batch_visitor_t>::DebugObjCt = 0;
+#endif
+
@@ -11,6 +11,8 @@
 //
 
 #include "libcef_dll/cpptoc/cookie_manager_cpptoc.h"
+#include "libcef_dll/ctocpp/completion_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/cookie_batch_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_visitor_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
 
@@ -162,6 +164,93 @@ int CEF_CALLBACK cookie_manager_delete_cookies(
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_set_cookies(struct _cef_cookie_manager_t* self,
+    const cef_string_t* url, size_t cookiesCount,
+    const struct _cef_cookie_t* cookies) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: cookies; type: struct_vec_byref_const
+  DCHECK(cookiesCount == 0 || cookies);
+  if (cookiesCount > 0 && !cookies)
+    return 0;
+  // Unverified params: url
+
+  // Translate param: cookies; type: struct_vec_byref_const
+  std::vector<CefCookie > cookiesList;
+  if (cookiesCount > 0) {
+    cookiesList.resize(cookiesCount);
+    for (size_t i = 0; i < cookiesCount; ++i) {
+      cookiesList[i].Set(cookies[i], false);
+    }
+  }
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->SetCookies(
+      CefString(url),
+      cookiesList);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_delete_domain_cookies(
+    struct _cef_cookie_manager_t* self, cef_string_list_t domains) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: domains; type: string_vec_byref_const
+  DCHECK(domains);
+  if (!domains)
+    return 0;
+
+  // Translate param: domains; type: string_vec_byref_const
+  std::vector<CefString> domainsList;
+  transfer_string_list_contents(domains, domainsList);
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->DeleteDomainCookies(
+      domainsList);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_visit_domain_cookies(
+    struct _cef_cookie_manager_t* self, cef_string_list_t domains,
+    int batch_size, struct _cef_cookie_batch_visitor_t* visitor) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: domains; type: string_vec_byref_const
+  DCHECK(domains);
+  if (!domains)
+    return 0;
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor);
+  if (!visitor)
+    return 0;
+
+  // Translate param: domains; type: string_vec_byref_const
+  std::vector<CefString> domainsList;
+  transfer_string_list_contents(domains, domainsList);
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->VisitDomainCookies(
+      domainsList,
+      batch_size,
+      CefCookieBatchVisitorCToCpp::Wrap(visitor));
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK cookie_manager_set_storage_path(
     struct _cef_cookie_manager_t* self, const cef_string_t* path) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -179,6 +268,42 @@ int CEF_CALLBACK cookie_manager_set_storage_path(
   return _retval;
 }
 
+int CEF_CALLBACK cookie_manager_set_commit_policy(
+    struct _cef_cookie_manager_t* self, int commit_interval,
+    int commit_batch_size, int deferred_commit) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->SetCommitPolicy(
+      commit_interval,
+      commit_batch_size,
+      deferred_commit?true:false);
+
+  // Return type: bool
+  return _retval;
+}
+
+int CEF_CALLBACK cookie_manager_flush_store(struct _cef_cookie_manager_t* self,
+    cef_completion_handler_t* handler) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Unverified params: handler
+
+  // Execute
+  bool _retval = CefCookieManagerCppToC::Get(self)->FlushStore(
+      CefCompletionHandlerCToCpp::Wrap(handler));
+
+  // Return type: bool
+  return _retval;
+}
+
 
 // CONSTRUCTOR - Do not edit by hand.
 
@@ -190,7 +315,12 @@ CefCookieManagerCppToC::CefCookieManagerCppToC(CefCookieManager* cls)
   struct_.struct_.visit_url_cookies = cookie_manager_visit_url_cookies;
   struct_.struct_.set_cookie = cookie_manager_set_cookie;
   struct_.struct_.delete_cookies = cookie_manager_delete_cookies;
+  struct_.struct_.set_cookies = cookie_manager_set_cookies;
+  struct_.struct_.delete_domain_cookies = cookie_manager_delete_domain_cookies;
+  struct_.struct_.visit_domain_cookies = cookie_manager_visit_domain_cookies;
   struct_.struct_.set_storage_path = cookie_manager_set_storage_path;
+  struct_.struct_.set_commit_policy = cookie_manager_set_commit_policy;
+  struct_.struct_.flush_store = cookie_manager_flush_store;
 }
 
 #ifndef NDEBUG
@@ -9,18 +9,22 @@
 #include "include/cef_base.h"
 #include "include/capi/cef_base_capi.h"
 #include "libcef_dll/cef_logging.h"
+#include "libcef_dll/wrapper_cache.h"
 
 
 // Wrap a C++ class with a C structure.  This is used when the class
 // implementation exists on this side of the DLL boundary but will have methods
-// called from the other side of the DLL boundary.
-template <class ClassName, class BaseName, class StructName>
+// called from the other side of the DLL boundary. |RefCountType| may be
+// CefSingleThreadRefCount for classes whose objects are only referenced on a
+// single thread.
+template <class ClassName, class BaseName, class StructName,
+          class RefCountType = CefRefCount>
 class CefCppToC : public CefBase {
  public:
   // Structure representation with pointer to the C++ class.
   struct Struct {
     StructName struct_;
-    CefCppToC<ClassName, BaseName, StructName>* class_;
+    CefCppToC<ClassName, BaseName, StructName, RefCountType>* class_;
   };
 
   // Use this method to retrieve the underlying class instance from our
@@ -37,16 +41,27 @@ class CefCppToC : public CefBase {
   }
 
   // Use this method to create a wrapper structure for passing our class
-  // instance to the other side.
+  // instance to the other side. An existing wrapper for the instance will be
+  // reused if one exists.
   static StructName* Wrap(CefRefPtr<BaseName> c) {
     if (!c.get())
       return NULL;
 
-    // Wrap our object with the CefCppToC class.
-    ClassName* wrapper = new ClassName(c);
+    GetWrapperCache()->Lock();
+    ClassName* wrapper = static_cast<ClassName*>(GetWrapperCache()->Find(c.get()));
     // Add a reference to our wrapper object that will be released once our
-    // structure arrives on the other side.
-    wrapper->AddRef();
+    // structure arrives on the other side. This is done while the cache is
+    // locked so that the wrapper cannot be destroyed in the meantime. A wrapper
+    // whose last reference was already released is left to be deleted by the
+    // releasing thread.
+    if (!wrapper || !wrapper->AddRefIfAlive()) {
+      // Wrap our object with the CefCppToC class.
+      wrapper = new ClassName(c);
+      wrapper->AddRef();
+      GetWrapperCache()->Insert(c.get(), wrapper);
+    }
+    GetWrapperCache()->Unlock();
+
     // Return the structure pointer that can now be passed to the other side.
     return wrapper->GetStruct();
   }
@@ -72,6 +87,10 @@ class CefCppToC : public CefBase {
     : class_(cls) {
     DCHECK(cls);
 
+    // Hold a single reference to the underlying class for the lifetime of this
+    // wrapper.
+    class_->AddRef();
+
     struct_.class_ = this;
 
     // zero the underlying structure and set base members
@@ -86,6 +105,8 @@ class CefCppToC : public CefBase {
 #endif
   }
   virtual ~CefCppToC() {
+    class_->Release();
+
 #ifndef NDEBUG
     CefAtomicDecrement(&DebugObjCt);
 #endif
@@ -98,26 +119,54 @@ class CefCppToC : public CefBase {
   // call UnderlyingRelease() on the wrapping CefCToCpp object.
   StructName* GetStruct() { return &struct_.struct_; }
 
-  // CefBase methods increment/decrement reference counts on both this object
-  // and the underlying wrapper class.
+  // CefBase methods increment/decrement the reference count on only this
+  // object. The reference to the underlying class is released when this object
+  // is destroyed.
   int AddRef() {
-    UnderlyingAddRef();
     return refct_.AddRef();
   }
   int Release() {
-    UnderlyingRelease();
     int retval = refct_.Release();
-    if (retval == 0)
+    if (retval == 0) {
+      // Only the transition to zero needs the cache lock. Wrap() may have
+      // found this wrapper in the meantime but never keeps a reference to a
+      // wrapper whose count reached zero, so the count is re-checked here
+      // only to verify that.
+      GetWrapperCache()->Lock();
+      DCHECK_EQ(refct_.GetRefCt(), 0);
+      GetWrapperCache()->Erase(class_, this);
+      GetWrapperCache()->Unlock();
       delete this;
+    }
     return retval;
   }
   int GetRefCt() { return refct_.GetRefCt(); }
 
+  // Add a reference unless the last reference has already been released, in
+  // which case the wrapper is about to be deleted by the releasing thread.
+  // Returns true if a reference was added. Must be called with the cache lock
+  // held.
+  bool AddRefIfAlive() {
+    if (refct_.AddRef() > 1)
+      return true;
+    // Undo the increment without entering Release() so that the releasing
+    // thread remains responsible for deleting the wrapper.
+    refct_.Release();
+    return false;
+  }
+
   // Increment/decrement reference counts on only the underlying class.
   int UnderlyingAddRef() { return class_->AddRef(); }
   int UnderlyingRelease() { return class_->Release(); }
   int UnderlyingGetRefCt() { return class_->GetRefCt(); }
 
+  // Existing wrapper objects keyed by the underlying class instance. The cache
+  // is created on first use.
+  static CefWrapperCache* GetWrapperCache() {
+    static CefWrapperCache* volatile cache = NULL;
+    return CefWrapperCache::GetInstance(&cache);
+  }
+
 #ifndef NDEBUG
   // Simple tracking of allocated objects.
   static long DebugObjCt;  // NOLINT(runtime/int)
@@ -152,7 +201,7 @@ class CefCppToC : public CefBase {
   }
 
  protected:
-  CefRefCount refct_;
+  RefCountType refct_;
   Struct struct_;
   BaseName* class_;
 };
@@ -274,7 +274,8 @@ cef_string_userfree_t CEF_CALLBACK domdocument_get_complete_url(
 // CONSTRUCTOR - Do not edit by hand.
 
 CefDOMDocumentCppToC::CefDOMDocumentCppToC(CefDOMDocument* cls)
-    : CefCppToC<CefDOMDocumentCppToC, CefDOMDocument, cef_domdocument_t>(cls) {
+    : CefCppToC<CefDOMDocumentCppToC, CefDOMDocument, cef_domdocument_t,
+        CefSingleThreadRefCount>(cls) {
   struct_.struct_.get_type = domdocument_get_type;
   struct_.struct_.get_document = domdocument_get_document;
   struct_.struct_.get_body = domdocument_get_body;
@@ -298,6 +299,6 @@ CefDOMDocumentCppToC::CefDOMDocumentCppToC(CefDOMDocument* cls)
 
 #ifndef NDEBUG
 template<> long CefCppToC<CefDOMDocumentCppToC, CefDOMDocument,
-    cef_domdocument_t>::DebugObjCt = 0;
+    cef_domdocument_t, CefSingleThreadRefCount>::DebugObjCt = 0;
 #endif
 
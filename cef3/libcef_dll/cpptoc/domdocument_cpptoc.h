@@ -25,8 +25,8 @@
 // Wrap a C++ class with a C structure.
 // This class may be instantiated and accessed DLL-side only.
 class CefDOMDocumentCppToC
-    : public CefCppToC<CefDOMDocumentCppToC, CefDOMDocument,
-        cef_domdocument_t> {
+    : public CefCppToC<CefDOMDocumentCppToC, CefDOMDocument, cef_domdocument_t,
+        CefSingleThreadRefCount> {
  public:
   explicit CefDOMDocumentCppToC(CefDOMDocument* cls);
   virtual ~CefDOMDocumentCppToC() {}
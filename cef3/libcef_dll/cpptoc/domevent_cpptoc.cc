@@ -141,7 +141,8 @@ cef_domnode_t* CEF_CALLBACK domevent_get_current_target(
 // CONSTRUCTOR - Do not edit by hand.
 
 CefDOMEventCppToC::CefDOMEventCppToC(CefDOMEvent* cls)
-    : CefCppToC<CefDOMEventCppToC, CefDOMEvent, cef_domevent_t>(cls) {
+    : CefCppToC<CefDOMEventCppToC, CefDOMEvent, cef_domevent_t,
+        CefSingleThreadRefCount>(cls) {
   struct_.struct_.get_type = domevent_get_type;
   struct_.struct_.get_category = domevent_get_category;
   struct_.struct_.get_phase = domevent_get_phase;
@@ -153,7 +154,7 @@ CefDOMEventCppToC::CefDOMEventCppToC(CefDOMEvent* cls)
 }
 
 #ifndef NDEBUG
-template<> long CefCppToC<CefDOMEventCppToC, CefDOMEvent,
-    cef_domevent_t>::DebugObjCt = 0;
+template<> long CefCppToC<CefDOMEventCppToC, CefDOMEvent, cef_domevent_t,
+    CefSingleThreadRefCount>::DebugObjCt = 0;
 #endif
 
@@ -25,7 +25,8 @@
 // Wrap a C++ class with a C structure.
 // This class may be instantiated and accessed DLL-side only.
 class CefDOMEventCppToC
-    : public CefCppToC<CefDOMEventCppToC, CefDOMEvent, cef_domevent_t> {
+    : public CefCppToC<CefDOMEventCppToC, CefDOMEvent, cef_domevent_t,
+        CefSingleThreadRefCount> {
  public:
   explicit CefDOMEventCppToC(CefDOMEvent* cls);
   virtual ~CefDOMEventCppToC() {}
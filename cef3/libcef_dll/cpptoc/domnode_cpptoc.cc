@@ -89,19 +89,24 @@ int CEF_CALLBACK domnode_is_form_control_element(struct _cef_domnode_t* self) {
   return _retval;
 }
 
-cef_string_userfree_t CEF_CALLBACK domnode_get_form_control_element_type(
-    struct _cef_domnode_t* self) {
+void CEF_CALLBACK domnode_get_form_control_element_type(
+    struct _cef_domnode_t* self, cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefDOMNodeCppToC::Get(self)->GetFormControlElementType();
+  CefString _retvalStr = CefDOMNodeCppToC::Get(self)->GetFormControlElementType(
+      );
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 int CEF_CALLBACK domnode_is_same(struct _cef_domnode_t* self,
@@ -124,34 +129,42 @@ int CEF_CALLBACK domnode_is_same(struct _cef_domnode_t* self,
   return _retval;
 }
 
-cef_string_userfree_t CEF_CALLBACK domnode_get_name(
-    struct _cef_domnode_t* self) {
+void CEF_CALLBACK domnode_get_name(struct _cef_domnode_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefDOMNodeCppToC::Get(self)->GetName();
+  CefString _retvalStr = CefDOMNodeCppToC::Get(self)->GetName();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
-cef_string_userfree_t CEF_CALLBACK domnode_get_value(
-    struct _cef_domnode_t* self) {
+void CEF_CALLBACK domnode_get_value(struct _cef_domnode_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefDOMNodeCppToC::Get(self)->GetValue();
+  CefString _retvalStr = CefDOMNodeCppToC::Get(self)->GetValue();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 int CEF_CALLBACK domnode_set_value(struct _cef_domnode_t* self,
@@ -319,19 +332,23 @@ void CEF_CALLBACK domnode_add_event_listener(struct _cef_domnode_t* self,
       useCapture?true:false);
 }
 
-cef_string_userfree_t CEF_CALLBACK domnode_get_element_tag_name(
-    struct _cef_domnode_t* self) {
+void CEF_CALLBACK domnode_get_element_tag_name(struct _cef_domnode_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefDOMNodeCppToC::Get(self)->GetElementTagName();
+  CefString _retvalStr = CefDOMNodeCppToC::Get(self)->GetElementTagName();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 int CEF_CALLBACK domnode_has_element_attributes(struct _cef_domnode_t* self) {
@@ -368,24 +385,28 @@ int CEF_CALLBACK domnode_has_element_attribute(struct _cef_domnode_t* self,
   return _retval;
 }
 
-cef_string_userfree_t CEF_CALLBACK domnode_get_element_attribute(
-    struct _cef_domnode_t* self, const cef_string_t* attrName) {
+void CEF_CALLBACK domnode_get_element_attribute(struct _cef_domnode_t* self,
+    const cef_string_t* attrName, cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
   // Verify param: attrName; type: string_byref_const
   DCHECK(attrName);
   if (!attrName)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefDOMNodeCppToC::Get(self)->GetElementAttribute(
+  CefString _retvalStr = CefDOMNodeCppToC::Get(self)->GetElementAttribute(
       CefString(attrName));
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK domnode_get_element_attributes(struct _cef_domnode_t* self,
@@ -438,26 +459,31 @@ int CEF_CALLBACK domnode_set_element_attribute(struct _cef_domnode_t* self,
   return _retval;
 }
 
-cef_string_userfree_t CEF_CALLBACK domnode_get_element_inner_text(
-    struct _cef_domnode_t* self) {
+void CEF_CALLBACK domnode_get_element_inner_text(struct _cef_domnode_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefDOMNodeCppToC::Get(self)->GetElementInnerText();
+  CefString _retvalStr = CefDOMNodeCppToC::Get(self)->GetElementInnerText();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 
 // CONSTRUCTOR - Do not edit by hand.
 
 CefDOMNodeCppToC::CefDOMNodeCppToC(CefDOMNode* cls)
-    : CefCppToC<CefDOMNodeCppToC, CefDOMNode, cef_domnode_t>(cls) {
+    : CefCppToC<CefDOMNodeCppToC, CefDOMNode, cef_domnode_t,
+        CefSingleThreadRefCount>(cls) {
   struct_.struct_.get_type = domnode_get_type;
   struct_.struct_.is_text = domnode_is_text;
   struct_.struct_.is_element = domnode_is_element;
@@ -488,7 +514,7 @@ CefDOMNodeCppToC::CefDOMNodeCppToC(CefDOMNode* cls)
 }
 
 #ifndef NDEBUG
-template<> long CefCppToC<CefDOMNodeCppToC, CefDOMNode,
-    cef_domnode_t>::DebugObjCt = 0;
+template<> long CefCppToC<CefDOMNodeCppToC, CefDOMNode, cef_domnode_t,
+    CefSingleThreadRefCount>::DebugObjCt = 0;
 #endif
 
@@ -25,7 +25,8 @@
 // Wrap a C++ class with a C structure.
 // This class may be instantiated and accessed DLL-side only.
 class CefDOMNodeCppToC
-    : public CefCppToC<CefDOMNodeCppToC, CefDOMNode, cef_domnode_t> {
+    : public CefCppToC<CefDOMNodeCppToC, CefDOMNode, cef_domnode_t,
+        CefSingleThreadRefCount> {
  public:
   explicit CefDOMNodeCppToC(CefDOMNode* cls);
   virtual ~CefDOMNodeCppToC() {}
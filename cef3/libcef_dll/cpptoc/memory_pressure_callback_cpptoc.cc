@@ -0,0 +1,47 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/memory_pressure_callback_cpptoc.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK memory_pressure_callback_on_memory_released(
+    struct _cef_memory_pressure_callback_t* self, int64 bytes_freed) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+
+  // Execute
+  CefMemoryPressureCallbackCppToC::Get(self)->OnMemoryReleased(
+      bytes_freed);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefMemoryPressureCallbackCppToC::CefMemoryPressureCallbackCppToC(
+    CefMemoryPressureCallback* cls)
+    : CefCppToC<CefMemoryPressureCallbackCppToC, CefMemoryPressureCallback,
+        cef_memory_pressure_callback_t>(cls) {
+  struct_.struct_.on_memory_released =
+      memory_pressure_callback_on_memory_released;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefMemoryPressureCallbackCppToC,
+    CefMemoryPressureCallback, cef_memory_pressure_callback_t>::DebugObjCt =
+    0;
+#endif
+
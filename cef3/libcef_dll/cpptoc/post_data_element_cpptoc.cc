@@ -11,6 +11,7 @@
 //
 
 #include "libcef_dll/cpptoc/post_data_element_cpptoc.h"
+#include "libcef_dll/transfer_util.h"
 
 
 // GLOBAL FUNCTIONS - Body may be edited by hand.
@@ -106,19 +107,23 @@ enum cef_postdataelement_type_t CEF_CALLBACK post_data_element_get_type(
   return _retval;
 }
 
-cef_string_userfree_t CEF_CALLBACK post_data_element_get_file(
-    struct _cef_post_data_element_t* self) {
+void CEF_CALLBACK post_data_element_get_file(
+    struct _cef_post_data_element_t* self, cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefPostDataElementCppToC::Get(self)->GetFile();
+  CefString _retvalStr = CefPostDataElementCppToC::Get(self)->GetFile();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 size_t CEF_CALLBACK post_data_element_get_bytes_count(
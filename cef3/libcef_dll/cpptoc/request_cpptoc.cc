@@ -44,19 +44,23 @@ int CEF_CALLBACK request_is_read_only(struct _cef_request_t* self) {
   return _retval;
 }
 
-cef_string_userfree_t CEF_CALLBACK request_get_url(
-    struct _cef_request_t* self) {
+void CEF_CALLBACK request_get_url(struct _cef_request_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefRequestCppToC::Get(self)->GetURL();
+  CefString _retvalStr = CefRequestCppToC::Get(self)->GetURL();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK request_set_url(struct _cef_request_t* self,
@@ -76,19 +80,23 @@ void CEF_CALLBACK request_set_url(struct _cef_request_t* self,
       CefString(url));
 }
 
-cef_string_userfree_t CEF_CALLBACK request_get_method(
-    struct _cef_request_t* self) {
+void CEF_CALLBACK request_get_method(struct _cef_request_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefRequestCppToC::Get(self)->GetMethod();
+  CefString _retvalStr = CefRequestCppToC::Get(self)->GetMethod();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK request_set_method(struct _cef_request_t* self,
@@ -141,45 +149,45 @@ void CEF_CALLBACK request_set_post_data(struct _cef_request_t* self,
 }
 
 void CEF_CALLBACK request_get_header_map(struct _cef_request_t* self,
-    cef_string_multimap_t headerMap) {
+    cef_string_block_visitor_t headerMapVisitor, void* headerMapContext) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
     return;
-  // Verify param: headerMap; type: string_map_multi_byref
-  DCHECK(headerMap);
-  if (!headerMap)
+  // Verify param: headerMap; type: string_map_multi_borrowed
+  DCHECK(headerMapVisitor);
+  if (!headerMapVisitor)
     return;
 
-  // Translate param: headerMap; type: string_map_multi_byref
+  // Translate param: headerMap; type: string_map_multi_borrowed
   std::multimap<CefString, CefString> headerMapMultimap;
-  transfer_string_multimap_contents(headerMap, headerMapMultimap);
 
   // Execute
   CefRequestCppToC::Get(self)->GetHeaderMap(
       headerMapMultimap);
 
-  // Restore param: headerMap; type: string_map_multi_byref
-  cef_string_multimap_clear(headerMap);
-  transfer_string_multimap_contents(headerMapMultimap, headerMap);
+  // Restore param: headerMap; type: string_map_multi_borrowed
+  CefStringBlock(headerMapMultimap).Visit(headerMapVisitor, headerMapContext);
 }
 
 void CEF_CALLBACK request_set_header_map(struct _cef_request_t* self,
-    cef_string_multimap_t headerMap) {
+    size_t headerMapCount, const cef_string_t* headerMapKeys,
+    const cef_string_t* headerMapValues) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
     return;
-  // Verify param: headerMap; type: string_map_multi_byref_const
-  DCHECK(headerMap);
-  if (!headerMap)
+  // Verify param: headerMap; type: string_map_multi_borrowed_const
+  DCHECK(headerMapCount == 0 || (headerMapKeys && headerMapValues));
+  if (headerMapCount > 0 && (!headerMapKeys || !headerMapValues))
     return;
 
-  // Translate param: headerMap; type: string_map_multi_byref_const
+  // Translate param: headerMap; type: string_map_multi_borrowed_const
   std::multimap<CefString, CefString> headerMapMultimap;
-  transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  transfer_string_block_contents(headerMapCount, headerMapKeys, headerMapValues,
+      headerMapMultimap);
 
   // Execute
   CefRequestCppToC::Get(self)->SetHeaderMap(
@@ -188,7 +196,8 @@ void CEF_CALLBACK request_set_header_map(struct _cef_request_t* self,
 
 void CEF_CALLBACK request_set(struct _cef_request_t* self,
     const cef_string_t* url, const cef_string_t* method,
-    struct _cef_post_data_t* postData, cef_string_multimap_t headerMap) {
+    struct _cef_post_data_t* postData, size_t headerMapCount,
+    const cef_string_t* headerMapKeys, const cef_string_t* headerMapValues) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
@@ -202,15 +211,16 @@ void CEF_CALLBACK request_set(struct _cef_request_t* self,
   DCHECK(method);
   if (!method)
     return;
-  // Verify param: headerMap; type: string_map_multi_byref_const
-  DCHECK(headerMap);
-  if (!headerMap)
+  // Verify param: headerMap; type: string_map_multi_borrowed_const
+  DCHECK(headerMapCount == 0 || (headerMapKeys && headerMapValues));
+  if (headerMapCount > 0 && (!headerMapKeys || !headerMapValues))
     return;
   // Unverified params: postData
 
-  // Translate param: headerMap; type: string_map_multi_byref_const
+  // Translate param: headerMap; type: string_map_multi_borrowed_const
   std::multimap<CefString, CefString> headerMapMultimap;
-  transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  transfer_string_block_contents(headerMapCount, headerMapKeys, headerMapValues,
+      headerMapMultimap);
 
   // Execute
   CefRequestCppToC::Get(self)->Set(
@@ -246,19 +256,23 @@ void CEF_CALLBACK request_set_flags(struct _cef_request_t* self, int flags) {
       flags);
 }
 
-cef_string_userfree_t CEF_CALLBACK request_get_first_party_for_cookies(
-    struct _cef_request_t* self) {
+void CEF_CALLBACK request_get_first_party_for_cookies(
+    struct _cef_request_t* self, cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefRequestCppToC::Get(self)->GetFirstPartyForCookies();
+  CefString _retvalStr = CefRequestCppToC::Get(self)->GetFirstPartyForCookies();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK request_set_first_party_for_cookies(
@@ -81,6 +81,35 @@ void CEF_CALLBACK resource_handler_get_response_headers(
     *response_length = response_lengthVal;
 }
 
+int CEF_CALLBACK resource_handler_skip_response(
+    struct _cef_resource_handler_t* self, int64 bytes_to_skip,
+    int64* bytes_skipped) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return 0;
+  // Verify param: bytes_skipped; type: simple_byref
+  DCHECK(bytes_skipped);
+  if (!bytes_skipped)
+    return 0;
+
+  // Translate param: bytes_skipped; type: simple_byref
+  int64 bytes_skippedVal = bytes_skipped?*bytes_skipped:0;
+
+  // Execute
+  bool _retval = CefResourceHandlerCppToC::Get(self)->SkipResponse(
+      bytes_to_skip,
+      bytes_skippedVal);
+
+  // Restore param: bytes_skipped; type: simple_byref
+  if (bytes_skipped)
+    *bytes_skipped = bytes_skippedVal;
+
+  // Return type: bool
+  return _retval;
+}
+
 int CEF_CALLBACK resource_handler_read_response(
     struct _cef_resource_handler_t* self, void* data_out, int bytes_to_read,
     int* bytes_read, cef_callback_t* callback) {
@@ -190,6 +219,7 @@ CefResourceHandlerCppToC::CefResourceHandlerCppToC(CefResourceHandler* cls)
         cef_resource_handler_t>(cls) {
   struct_.struct_.process_request = resource_handler_process_request;
   struct_.struct_.get_response_headers = resource_handler_get_response_headers;
+  struct_.struct_.skip_response = resource_handler_skip_response;
   struct_.struct_.read_response = resource_handler_read_response;
   struct_.struct_.can_get_cookie = resource_handler_can_get_cookie;
   struct_.struct_.can_set_cookie = resource_handler_can_set_cookie;
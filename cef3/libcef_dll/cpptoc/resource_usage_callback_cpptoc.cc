@@ -0,0 +1,62 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/resource_usage_callback_cpptoc.h"
+#include "libcef_dll/ctocpp/browser_host_ctocpp.h"
+
+
+// MEMBER FUNCTIONS - Body may be edited by hand.
+
+void CEF_CALLBACK resource_usage_callback_on_resource_usage(
+    struct _cef_resource_usage_callback_t* self,
+    struct _cef_browser_host_t* browser_host,
+    const struct _cef_resource_usage_t* usage) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  DCHECK(self);
+  if (!self)
+    return;
+  // Verify param: browser_host; type: refptr_diff
+  DCHECK(browser_host);
+  if (!browser_host)
+    return;
+  // Verify param: usage; type: struct_byref_const
+  DCHECK(usage);
+  if (!usage)
+    return;
+
+  // Translate param: usage; type: struct_byref_const
+  CefResourceUsage usageObj;
+  if (usage)
+    usageObj.Set(*usage, false);
+
+  // Execute
+  CefResourceUsageCallbackCppToC::Get(self)->OnResourceUsage(
+      CefBrowserHostCToCpp::Wrap(browser_host),
+      usageObj);
+}
+
+
+// CONSTRUCTOR - Do not edit by hand.
+
+CefResourceUsageCallbackCppToC::CefResourceUsageCallbackCppToC(
+    CefResourceUsageCallback* cls)
+    : CefCppToC<CefResourceUsageCallbackCppToC, CefResourceUsageCallback,
+        cef_resource_usage_callback_t>(cls) {
+  struct_.struct_.on_resource_usage = resource_usage_callback_on_resource_usage;
+}
+
+#ifndef NDEBUG
+template<> long CefCppToC<CefResourceUsageCallbackCppToC,
+    CefResourceUsageCallback, cef_resource_usage_callback_t>::DebugObjCt = 0;
+#endif
+
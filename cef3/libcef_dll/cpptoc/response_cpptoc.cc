@@ -70,19 +70,23 @@ void CEF_CALLBACK response_set_status(struct _cef_response_t* self,
       status);
 }
 
-cef_string_userfree_t CEF_CALLBACK response_get_status_text(
-    struct _cef_response_t* self) {
+void CEF_CALLBACK response_get_status_text(struct _cef_response_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefResponseCppToC::Get(self)->GetStatusText();
+  CefString _retvalStr = CefResponseCppToC::Get(self)->GetStatusText();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK response_set_status_text(struct _cef_response_t* self,
@@ -102,19 +106,23 @@ void CEF_CALLBACK response_set_status_text(struct _cef_response_t* self,
       CefString(statusText));
 }
 
-cef_string_userfree_t CEF_CALLBACK response_get_mime_type(
-    struct _cef_response_t* self) {
+void CEF_CALLBACK response_get_mime_type(struct _cef_response_t* self,
+    cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefResponseCppToC::Get(self)->GetMimeType();
+  CefString _retvalStr = CefResponseCppToC::Get(self)->GetMimeType();
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK response_set_mime_type(struct _cef_response_t* self,
@@ -134,66 +142,70 @@ void CEF_CALLBACK response_set_mime_type(struct _cef_response_t* self,
       CefString(mimeType));
 }
 
-cef_string_userfree_t CEF_CALLBACK response_get_header(
-    struct _cef_response_t* self, const cef_string_t* name) {
+void CEF_CALLBACK response_get_header(struct _cef_response_t* self,
+    const cef_string_t* name, cef_string_t* _retval) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
-    return NULL;
+    return;
   // Verify param: name; type: string_byref_const
   DCHECK(name);
   if (!name)
-    return NULL;
+    return;
+  // Verify param: _retval; type: string_buffer
+  DCHECK(_retval);
+  if (!_retval)
+    return;
 
   // Execute
-  CefString _retval = CefResponseCppToC::Get(self)->GetHeader(
+  CefString _retvalStr = CefResponseCppToC::Get(self)->GetHeader(
       CefString(name));
 
-  // Return type: string
-  return _retval.DetachToUserFree();
+  // Return type: string_buffer
+  transfer_string_contents(_retvalStr, _retval);
 }
 
 void CEF_CALLBACK response_get_header_map(struct _cef_response_t* self,
-    cef_string_multimap_t headerMap) {
+    cef_string_block_visitor_t headerMapVisitor, void* headerMapContext) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
     return;
-  // Verify param: headerMap; type: string_map_multi_byref
-  DCHECK(headerMap);
-  if (!headerMap)
+  // Verify param: headerMap; type: string_map_multi_borrowed
+  DCHECK(headerMapVisitor);
+  if (!headerMapVisitor)
     return;
 
-  // Translate param: headerMap; type: string_map_multi_byref
+  // Translate param: headerMap; type: string_map_multi_borrowed
   std::multimap<CefString, CefString> headerMapMultimap;
-  transfer_string_multimap_contents(headerMap, headerMapMultimap);
 
   // Execute
   CefResponseCppToC::Get(self)->GetHeaderMap(
       headerMapMultimap);
 
-  // Restore param: headerMap; type: string_map_multi_byref
-  cef_string_multimap_clear(headerMap);
-  transfer_string_multimap_contents(headerMapMultimap, headerMap);
+  // Restore param: headerMap; type: string_map_multi_borrowed
+  CefStringBlock(headerMapMultimap).Visit(headerMapVisitor, headerMapContext);
 }
 
 void CEF_CALLBACK response_set_header_map(struct _cef_response_t* self,
-    cef_string_multimap_t headerMap) {
+    size_t headerMapCount, const cef_string_t* headerMapKeys,
+    const cef_string_t* headerMapValues) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   DCHECK(self);
   if (!self)
     return;
-  // Verify param: headerMap; type: string_map_multi_byref_const
-  DCHECK(headerMap);
-  if (!headerMap)
+  // Verify param: headerMap; type: string_map_multi_borrowed_const
+  DCHECK(headerMapCount == 0 || (headerMapKeys && headerMapValues));
+  if (headerMapCount > 0 && (!headerMapKeys || !headerMapValues))
     return;
 
-  // Translate param: headerMap; type: string_map_multi_byref_const
+  // Translate param: headerMap; type: string_map_multi_borrowed_const
   std::multimap<CefString, CefString> headerMapMultimap;
-  transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  transfer_string_block_contents(headerMapCount, headerMapKeys, headerMapValues,
+      headerMapMultimap);
 
   // Execute
   CefResponseCppToC::Get(self)->SetHeaderMap(
@@ -20,15 +20,12 @@ class CefBaseCToCpp : public CefBase {
     if (!s)
       return NULL;
 
-    // Wrap their structure with the CefCToCpp object.
+    // Wrap their structure with the CefCToCpp object. The reference that was
+    // added to the CefCppToC wrapper object on the other side before their
+    // structure was passed to us is held by the new wrapper.
     CefBaseCToCpp* wrapper = new CefBaseCToCpp(s);
-    // Put the wrapper object in a smart pointer.
-    CefRefPtr<CefBase> wrapperPtr(wrapper);
-    // Release the reference that was added to the CefCppToC wrapper object on
-    // the other side before their structure was passed to us.
-    wrapper->UnderlyingRelease();
-    // Return the smart pointer.
-    return wrapperPtr;
+    // Return the wrapper object in a smart pointer.
+    return CefRefPtr<CefBase>(wrapper);
   }
 
   // Use this method to retrieve the underlying structure from a wrapper class
@@ -50,21 +47,24 @@ class CefBaseCToCpp : public CefBase {
     : struct_(str) {
     DCHECK(str);
   }
-  virtual ~CefBaseCToCpp() {}
+  virtual ~CefBaseCToCpp() {
+    // Release the reference to the underlying structure that was held for the
+    // lifetime of this wrapper.
+    UnderlyingRelease();
+  }
 
   // If returning the structure across the DLL boundary you should call
   // UnderlyingAddRef() on this wrapping CefCToCpp object.  On the other side of
   // the DLL  boundary, call Release() on the CefCppToC object.
   cef_base_t* GetStruct() { return struct_; }
 
-  // CefBase methods increment/decrement reference counts on both this object
-  // and the underlying wrapped structure.
+  // CefBase methods increment/decrement the reference count on only this
+  // object. The reference to the underlying wrapped structure is released when
+  // this object is destroyed.
   int AddRef() {
-    UnderlyingAddRef();
     return refct_.AddRef();
   }
   int Release() {
-    UnderlyingRelease();
     int retval = refct_.Release();
     if (retval == 0)
       delete this;
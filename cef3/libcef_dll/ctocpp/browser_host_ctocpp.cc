@@ -11,6 +11,8 @@
 //
 
 #include "libcef_dll/cpptoc/client_cpptoc.h"
+#include "libcef_dll/cpptoc/memory_pressure_callback_cpptoc.h"
+#include "libcef_dll/cpptoc/resource_usage_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/run_file_dialog_callback_cpptoc.h"
 #include "libcef_dll/ctocpp/browser_ctocpp.h"
 #include "libcef_dll/ctocpp/browser_host_ctocpp.h"
@@ -223,6 +225,170 @@ void CefBrowserHostCToCpp::RunFileDialog(FileDialogMode mode,
     cef_string_list_free(accept_typesList);
 }
 
+void CefBrowserHostCToCpp::WasHidden(bool hidden) {
+  if (CEF_MEMBER_MISSING(struct_, was_hidden))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->was_hidden(struct_,
+      hidden);
+}
+
+bool CefBrowserHostCToCpp::IsHidden() {
+  if (CEF_MEMBER_MISSING(struct_, is_hidden))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->is_hidden(struct_);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+void CefBrowserHostCToCpp::NotifyMemoryPressure(MemoryPressureLevel level,
+    CefRefPtr<CefMemoryPressureCallback> callback) {
+  if (CEF_MEMBER_MISSING(struct_, notify_memory_pressure))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: callback
+
+  // Execute
+  struct_->notify_memory_pressure(struct_,
+      level,
+      CefMemoryPressureCallbackCppToC::Wrap(callback));
+}
+
+void CefBrowserHostCToCpp::GetResourceUsage(
+    CefRefPtr<CefResourceUsageCallback> callback) {
+  if (CEF_MEMBER_MISSING(struct_, get_resource_usage))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: callback; type: refptr_diff
+  DCHECK(callback.get());
+  if (!callback.get())
+    return;
+
+  // Execute
+  struct_->get_resource_usage(struct_,
+      CefResourceUsageCallbackCppToC::Wrap(callback));
+}
+
+bool CefBrowserHostCToCpp::IsWindowRenderingDisabled() {
+  if (CEF_MEMBER_MISSING(struct_, is_window_rendering_disabled))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->is_window_rendering_disabled(struct_);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+void CefBrowserHostCToCpp::WasResized() {
+  if (CEF_MEMBER_MISSING(struct_, was_resized))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->was_resized(struct_);
+}
+
+void CefBrowserHostCToCpp::Invalidate(const CefRect& dirtyRect) {
+  if (CEF_MEMBER_MISSING(struct_, invalidate))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->invalidate(struct_,
+      &dirtyRect);
+}
+
+void CefBrowserHostCToCpp::SendKeyEvent(const CefKeyEvent& event) {
+  if (CEF_MEMBER_MISSING(struct_, send_key_event))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->send_key_event(struct_,
+      &event);
+}
+
+void CefBrowserHostCToCpp::SendMouseClickEvent(const CefMouseEvent& event,
+    MouseButtonType type, bool mouseUp, int clickCount) {
+  if (CEF_MEMBER_MISSING(struct_, send_mouse_click_event))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->send_mouse_click_event(struct_,
+      &event,
+      type,
+      mouseUp,
+      clickCount);
+}
+
+void CefBrowserHostCToCpp::SendMouseMoveEvent(const CefMouseEvent& event,
+    bool mouseLeave) {
+  if (CEF_MEMBER_MISSING(struct_, send_mouse_move_event))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->send_mouse_move_event(struct_,
+      &event,
+      mouseLeave);
+}
+
+void CefBrowserHostCToCpp::SendMouseWheelEvent(const CefMouseEvent& event,
+    int deltaX, int deltaY) {
+  if (CEF_MEMBER_MISSING(struct_, send_mouse_wheel_event))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->send_mouse_wheel_event(struct_,
+      &event,
+      deltaX,
+      deltaY);
+}
+
+void CefBrowserHostCToCpp::SendFocusEvent(bool setFocus) {
+  if (CEF_MEMBER_MISSING(struct_, send_focus_event))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->send_focus_event(struct_,
+      setFocus);
+}
+
+void CefBrowserHostCToCpp::SendCaptureLostEvent() {
+  if (CEF_MEMBER_MISSING(struct_, send_capture_lost_event))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->send_capture_lost_event(struct_);
+}
+
 
 #ifndef NDEBUG
 template<> long CefCToCpp<CefBrowserHostCToCpp, CefBrowserHost,
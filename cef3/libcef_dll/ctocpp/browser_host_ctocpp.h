@@ -51,6 +51,24 @@ class CefBrowserHostCToCpp
       const CefString& default_file_name,
       const std::vector<CefString>& accept_types,
       CefRefPtr<CefRunFileDialogCallback> callback) OVERRIDE;
+  virtual void WasHidden(bool hidden) OVERRIDE;
+  virtual bool IsHidden() OVERRIDE;
+  virtual void NotifyMemoryPressure(MemoryPressureLevel level,
+      CefRefPtr<CefMemoryPressureCallback> callback) OVERRIDE;
+  virtual void GetResourceUsage(
+      CefRefPtr<CefResourceUsageCallback> callback) OVERRIDE;
+  virtual bool IsWindowRenderingDisabled() OVERRIDE;
+  virtual void WasResized() OVERRIDE;
+  virtual void Invalidate(const CefRect& dirtyRect) OVERRIDE;
+  virtual void SendKeyEvent(const CefKeyEvent& event) OVERRIDE;
+  virtual void SendMouseClickEvent(const CefMouseEvent& event,
+      MouseButtonType type, bool mouseUp, int clickCount) OVERRIDE;
+  virtual void SendMouseMoveEvent(const CefMouseEvent& event,
+      bool mouseLeave) OVERRIDE;
+  virtual void SendMouseWheelEvent(const CefMouseEvent& event, int deltaX,
+      int deltaY) OVERRIDE;
+  virtual void SendFocusEvent(bool setFocus) OVERRIDE;
+  virtual void SendCaptureLostEvent() OVERRIDE;
 };
 
 #endif  // USING_CEF_SHARED
@@ -57,6 +57,50 @@ void CefBrowserProcessHandlerCToCpp::OnBeforeChildProcessLaunch(
       CefCommandLineCppToC::Wrap(command_line));
 }
 
+void CefBrowserProcessHandlerCToCpp::OnScheduleMessagePumpWork(int64 delay_ms) {
+  if (CEF_MEMBER_MISSING(struct_, on_schedule_message_pump_work))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->on_schedule_message_pump_work(struct_,
+      delay_ms);
+}
+
+void CefBrowserProcessHandlerCToCpp::OnSpareRenderProcessClaimed(int64 wait_ms,
+    int64 idle_ms) {
+  if (CEF_MEMBER_MISSING(struct_, on_spare_render_process_claimed))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->on_spare_render_process_claimed(struct_,
+      wait_ms,
+      idle_ms);
+}
+
+void CefBrowserProcessHandlerCToCpp::OnStartupPhase(CefProcessId process,
+    const CefString& name, int64 start_us, int64 duration_us) {
+  if (CEF_MEMBER_MISSING(struct_, on_startup_phase))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: name; type: string_byref_const
+  DCHECK(!name.empty());
+  if (name.empty())
+    return;
+
+  // Execute
+  struct_->on_startup_phase(struct_,
+      process,
+      name.GetStruct(),
+      start_us,
+      duration_us);
+}
+
 
 #ifndef NDEBUG
 template<> long CefCToCpp<CefBrowserProcessHandlerCToCpp,
@@ -38,6 +38,11 @@ class CefBrowserProcessHandlerCToCpp
   virtual void OnContextInitialized() OVERRIDE;
   virtual void OnBeforeChildProcessLaunch(
       CefRefPtr<CefCommandLine> command_line) OVERRIDE;
+  virtual void OnScheduleMessagePumpWork(int64 delay_ms) OVERRIDE;
+  virtual void OnSpareRenderProcessClaimed(int64 wait_ms,
+      int64 idle_ms) OVERRIDE;
+  virtual void OnStartupPhase(CefProcessId process, const CefString& name,
+      int64 start_us, int64 duration_us) OVERRIDE;
 };
 
 #endif  // BUILDING_CEF_SHARED
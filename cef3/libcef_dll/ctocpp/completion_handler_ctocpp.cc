@@ -0,0 +1,33 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/completion_handler_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefCompletionHandlerCToCpp::OnComplete() {
+  if (CEF_MEMBER_MISSING(struct_, on_complete))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->on_complete(struct_);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefCompletionHandlerCToCpp, CefCompletionHandler,
+    cef_completion_handler_t>::DebugObjCt = 0;
+#endif
+
@@ -0,0 +1,58 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/cookie_batch_visitor_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+bool CefCookieBatchVisitorCToCpp::VisitBatch(
+    const std::vector<CefCookie>& cookies, int offset, int total) {
+  if (CEF_MEMBER_MISSING(struct_, visit_batch))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Translate param: cookies; type: struct_vec_byref_const
+  const size_t cookiesCount = cookies.size();
+  cef_cookie_t* cookiesList = NULL;
+  if (cookiesCount > 0) {
+    cookiesList = new cef_cookie_t[cookiesCount];
+    DCHECK(cookiesList);
+    if (cookiesList) {
+      for (size_t i = 0; i < cookiesCount; ++i) {
+        cookiesList[i] = cookies[i];
+      }
+    }
+  }
+
+  // Execute
+  int _retval = struct_->visit_batch(struct_,
+      cookiesCount,
+      cookiesList,
+      offset,
+      total);
+
+  // Restore param:cookies; type: struct_vec_byref_const
+  if (cookiesList)
+    delete [] cookiesList;
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefCookieBatchVisitorCToCpp, CefCookieBatchVisitor,
+    cef_cookie_batch_visitor_t>::DebugObjCt = 0;
+#endif
+
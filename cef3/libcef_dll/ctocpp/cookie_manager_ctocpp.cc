@@ -10,6 +10,8 @@
 // for more information.
 //
 
+#include "libcef_dll/cpptoc/completion_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/cookie_batch_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_visitor_cpptoc.h"
 #include "libcef_dll/ctocpp/cookie_manager_ctocpp.h"
 #include "libcef_dll/transfer_util.h"
@@ -151,6 +153,100 @@ bool CefCookieManagerCToCpp::DeleteCookies(const CefString& url,
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::SetCookies(const CefString& url,
+    const std::vector<CefCookie>& cookies) {
+  if (CEF_MEMBER_MISSING(struct_, set_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: url
+
+  // Translate param: cookies; type: struct_vec_byref_const
+  const size_t cookiesCount = cookies.size();
+  cef_cookie_t* cookiesList = NULL;
+  if (cookiesCount > 0) {
+    cookiesList = new cef_cookie_t[cookiesCount];
+    DCHECK(cookiesList);
+    if (cookiesList) {
+      for (size_t i = 0; i < cookiesCount; ++i) {
+        cookiesList[i] = cookies[i];
+      }
+    }
+  }
+
+  // Execute
+  int _retval = struct_->set_cookies(struct_,
+      url.GetStruct(),
+      cookiesCount,
+      cookiesList);
+
+  // Restore param:cookies; type: struct_vec_byref_const
+  if (cookiesList)
+    delete [] cookiesList;
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::DeleteDomainCookies(
+    const std::vector<CefString>& domains) {
+  if (CEF_MEMBER_MISSING(struct_, delete_domain_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Translate param: domains; type: string_vec_byref_const
+  cef_string_list_t domainsList = cef_string_list_alloc();
+  DCHECK(domainsList);
+  if (domainsList)
+    transfer_string_list_contents(domains, domainsList);
+
+  // Execute
+  int _retval = struct_->delete_domain_cookies(struct_,
+      domainsList);
+
+  // Restore param:domains; type: string_vec_byref_const
+  if (domainsList)
+    cef_string_list_free(domainsList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::VisitDomainCookies(
+    const std::vector<CefString>& domains, int batch_size,
+    CefRefPtr<CefCookieBatchVisitor> visitor) {
+  if (CEF_MEMBER_MISSING(struct_, visit_domain_cookies))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: visitor; type: refptr_diff
+  DCHECK(visitor.get());
+  if (!visitor.get())
+    return false;
+
+  // Translate param: domains; type: string_vec_byref_const
+  cef_string_list_t domainsList = cef_string_list_alloc();
+  DCHECK(domainsList);
+  if (domainsList)
+    transfer_string_list_contents(domains, domainsList);
+
+  // Execute
+  int _retval = struct_->visit_domain_cookies(struct_,
+      domainsList,
+      batch_size,
+      CefCookieBatchVisitorCppToC::Wrap(visitor));
+
+  // Restore param:domains; type: string_vec_byref_const
+  if (domainsList)
+    cef_string_list_free(domainsList);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefCookieManagerCToCpp::SetStoragePath(const CefString& path) {
   if (CEF_MEMBER_MISSING(struct_, set_storage_path))
     return false;
@@ -167,6 +263,40 @@ bool CefCookieManagerCToCpp::SetStoragePath(const CefString& path) {
   return _retval?true:false;
 }
 
+bool CefCookieManagerCToCpp::SetCommitPolicy(int commit_interval,
+    int commit_batch_size, bool deferred_commit) {
+  if (CEF_MEMBER_MISSING(struct_, set_commit_policy))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->set_commit_policy(struct_,
+      commit_interval,
+      commit_batch_size,
+      deferred_commit);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+bool CefCookieManagerCToCpp::FlushStore(
+    CefRefPtr<CefCompletionHandler> handler) {
+  if (CEF_MEMBER_MISSING(struct_, flush_store))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Unverified params: handler
+
+  // Execute
+  int _retval = struct_->flush_store(struct_,
+      CefCompletionHandlerCppToC::Wrap(handler));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 
 #ifndef NDEBUG
 template<> long CefCToCpp<CefCookieManagerCToCpp, CefCookieManager,
@@ -44,7 +44,16 @@ class CefCookieManagerCToCpp
       const CefCookie& cookie) OVERRIDE;
   virtual bool DeleteCookies(const CefString& url,
       const CefString& cookie_name) OVERRIDE;
+  virtual bool SetCookies(const CefString& url,
+      const std::vector<CefCookie>& cookies) OVERRIDE;
+  virtual bool DeleteDomainCookies(
+      const std::vector<CefString>& domains) OVERRIDE;
+  virtual bool VisitDomainCookies(const std::vector<CefString>& domains,
+      int batch_size, CefRefPtr<CefCookieBatchVisitor> visitor) OVERRIDE;
   virtual bool SetStoragePath(const CefString& path) OVERRIDE;
+  virtual bool SetCommitPolicy(int commit_interval, int commit_batch_size,
+      bool deferred_commit) OVERRIDE;
+  virtual bool FlushStore(CefRefPtr<CefCompletionHandler> handler) OVERRIDE;
 };
 
 #endif  // USING_CEF_SHARED
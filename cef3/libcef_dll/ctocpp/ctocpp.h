@@ -9,27 +9,50 @@
 #include "include/cef_base.h"
 #include "include/capi/cef_base_capi.h"
 #include "libcef_dll/cef_logging.h"
+#include "libcef_dll/wrapper_cache.h"
 
 
 // Wrap a C structure with a C++ class.  This is used when the implementation
 // exists on the other side of the DLL boundary but will have methods called on
-// this side of the DLL boundary.
-template <class ClassName, class BaseName, class StructName>
+// this side of the DLL boundary. |RefCountType| may be CefSingleThreadRefCount
+// for classes whose objects are only referenced on a single thread.
+template <class ClassName, class BaseName, class StructName,
+          class RefCountType = CefRefCount>
 class CefCToCpp : public BaseName {
  public:
   // Use this method to create a wrapper class instance for a structure
-  // received from the other side.
+  // received from the other side. An existing wrapper for the structure will
+  // be reused if one exists.
   static CefRefPtr<BaseName> Wrap(StructName* s) {
     if (!s)
       return NULL;
 
-    // Wrap their structure with the CefCToCpp object.
-    ClassName* wrapper = new ClassName(s);
-    // Put the wrapper object in a smart pointer.
+    GetWrapperCache()->Lock();
+    ClassName* wrapper = static_cast<ClassName*>(GetWrapperCache()->Find(s));
+    // Add a reference to the wrapper object. This is done while the cache is
+    // locked so that the wrapper cannot be destroyed in the meantime. A wrapper
+    // whose last reference was already released is left to be deleted by the
+    // releasing thread.
+    const bool existing = (wrapper && wrapper->AddRefIfAlive());
+    if (!existing) {
+      // Wrap their structure with the CefCToCpp object. The reference that was
+      // added to the CefCppToC wrapper object on the other side before their
+      // structure was passed to us is held by the new wrapper.
+      wrapper = new ClassName(s);
+      wrapper->AddRef();
+      GetWrapperCache()->Insert(s, wrapper);
+    }
+    GetWrapperCache()->Unlock();
+
+    // Put the wrapper object in a smart pointer and release the reference that
+    // was added above. The count cannot reach zero here.
     CefRefPtr<BaseName> wrapperPtr(wrapper);
-    // Release the reference that was added to the CefCppToC wrapper object on
-    // the other side before their structure was passed to us.
-    wrapper->UnderlyingRelease();
+    wrapper->Release();
+
+    // The existing wrapper already holds a reference so release the reference
+    // that was added on the other side.
+    if (existing)
+      wrapper->UnderlyingRelease();
     // Return the smart pointer.
     return wrapperPtr;
   }
@@ -58,6 +81,10 @@ class CefCToCpp : public BaseName {
 #endif
   }
   virtual ~CefCToCpp() {
+    // Release the reference to the underlying structure that was held for the
+    // lifetime of this wrapper.
+    UnderlyingRelease();
+
 #ifndef NDEBUG
     CefAtomicDecrement(&DebugObjCt);
 #endif
@@ -68,21 +95,42 @@ class CefCToCpp : public BaseName {
   // the DLL  boundary, call Release() on the CefCppToC object.
   StructName* GetStruct() { return struct_; }
 
-  // CefBase methods increment/decrement reference counts on both this object
-  // and the underlying wrapped structure.
+  // CefBase methods increment/decrement the reference count on only this
+  // object. The reference to the underlying wrapped structure is released when
+  // this object is destroyed.
   int AddRef() {
-    UnderlyingAddRef();
     return refct_.AddRef();
   }
   int Release() {
-    UnderlyingRelease();
     int retval = refct_.Release();
-    if (retval == 0)
+    if (retval == 0) {
+      // Only the transition to zero needs the cache lock. Wrap() may have
+      // found this wrapper in the meantime but never keeps a reference to a
+      // wrapper whose count reached zero, so the count is re-checked here
+      // only to verify that.
+      GetWrapperCache()->Lock();
+      DCHECK_EQ(refct_.GetRefCt(), 0);
+      GetWrapperCache()->Erase(struct_, this);
+      GetWrapperCache()->Unlock();
       delete this;
+    }
     return retval;
   }
   int GetRefCt() { return refct_.GetRefCt(); }
 
+  // Add a reference unless the last reference has already been released, in
+  // which case the wrapper is about to be deleted by the releasing thread.
+  // Returns true if a reference was added. Must be called with the cache lock
+  // held.
+  bool AddRefIfAlive() {
+    if (refct_.AddRef() > 1)
+      return true;
+    // Undo the increment without entering Release() so that the releasing
+    // thread remains responsible for deleting the wrapper.
+    refct_.Release();
+    return false;
+  }
+
   // Increment/decrement reference counts on only the underlying class.
   int UnderlyingAddRef() {
     if (!struct_->base.add_ref)
@@ -100,13 +148,20 @@ class CefCToCpp : public BaseName {
     return struct_->base.get_refct(&struct_->base);
   }
 
+  // Existing wrapper objects keyed by the wrapped structure. The cache is
+  // created on first use.
+  static CefWrapperCache* GetWrapperCache() {
+    static CefWrapperCache* volatile cache = NULL;
+    return CefWrapperCache::GetInstance(&cache);
+  }
+
 #ifndef NDEBUG
   // Simple tracking of allocated objects.
   static long DebugObjCt;  // NOLINT(runtime/int)
 #endif
 
  protected:
-  CefRefCount refct_;
+  RefCountType refct_;
   StructName* struct_;
 };
 
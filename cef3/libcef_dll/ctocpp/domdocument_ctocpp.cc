@@ -250,6 +250,6 @@ CefString CefDOMDocumentCToCpp::GetCompleteURL(const CefString& partialURL) {
 
 #ifndef NDEBUG
 template<> long CefCToCpp<CefDOMDocumentCToCpp, CefDOMDocument,
-    cef_domdocument_t>::DebugObjCt = 0;
+    cef_domdocument_t, CefSingleThreadRefCount>::DebugObjCt = 0;
 #endif
 
@@ -25,12 +25,12 @@
 // Wrap a C structure with a C++ class.
 // This class may be instantiated and accessed wrapper-side only.
 class CefDOMDocumentCToCpp
-    : public CefCToCpp<CefDOMDocumentCToCpp, CefDOMDocument,
-        cef_domdocument_t> {
+    : public CefCToCpp<CefDOMDocumentCToCpp, CefDOMDocument, cef_domdocument_t,
+        CefSingleThreadRefCount> {
  public:
   explicit CefDOMDocumentCToCpp(cef_domdocument_t* str)
-      : CefCToCpp<CefDOMDocumentCToCpp, CefDOMDocument, cef_domdocument_t>(
-          str) {}
+      : CefCToCpp<CefDOMDocumentCToCpp, CefDOMDocument, cef_domdocument_t,
+          CefSingleThreadRefCount>(str) {}
   virtual ~CefDOMDocumentCToCpp() {}
 
   // CefDOMDocument methods
@@ -25,10 +25,12 @@
 // Wrap a C structure with a C++ class.
 // This class may be instantiated and accessed wrapper-side only.
 class CefDOMEventCToCpp
-    : public CefCToCpp<CefDOMEventCToCpp, CefDOMEvent, cef_domevent_t> {
+    : public CefCToCpp<CefDOMEventCToCpp, CefDOMEvent, cef_domevent_t,
+        CefSingleThreadRefCount> {
  public:
   explicit CefDOMEventCToCpp(cef_domevent_t* str)
-      : CefCToCpp<CefDOMEventCToCpp, CefDOMEvent, cef_domevent_t>(str) {}
+      : CefCToCpp<CefDOMEventCToCpp, CefDOMEvent, cef_domevent_t,
+          CefSingleThreadRefCount>(str) {}
   virtual ~CefDOMEventCToCpp() {}
 
   // CefDOMEvent methods
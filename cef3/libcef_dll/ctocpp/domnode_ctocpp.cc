@@ -90,13 +90,12 @@ CefString CefDOMNodeCToCpp::GetFormControlElementType() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_form_control_element_type(
-      struct_);
+  CefString _retval;
+  struct_->get_form_control_element_type(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 bool CefDOMNodeCToCpp::IsSame(CefRefPtr<CefDOMNode> that) {
@@ -125,12 +124,12 @@ CefString CefDOMNodeCToCpp::GetName() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_name(struct_);
+  CefString _retval;
+  struct_->get_name(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 CefString CefDOMNodeCToCpp::GetValue() {
@@ -140,12 +139,12 @@ CefString CefDOMNodeCToCpp::GetValue() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_value(struct_);
+  CefString _retval;
+  struct_->get_value(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 bool CefDOMNodeCToCpp::SetValue(const CefString& value) {
@@ -303,12 +302,12 @@ CefString CefDOMNodeCToCpp::GetElementTagName() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_element_tag_name(struct_);
+  CefString _retval;
+  struct_->get_element_tag_name(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 bool CefDOMNodeCToCpp::HasElementAttributes() {
@@ -355,13 +354,13 @@ CefString CefDOMNodeCToCpp::GetElementAttribute(const CefString& attrName) {
     return CefString();
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_element_attribute(struct_,
-      attrName.GetStruct());
+  CefString _retval;
+  struct_->get_element_attribute(struct_,
+      attrName.GetStruct(),
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefDOMNodeCToCpp::GetElementAttributes(AttributeMap& attrMap) {
@@ -420,17 +419,17 @@ CefString CefDOMNodeCToCpp::GetElementInnerText() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_element_inner_text(struct_);
+  CefString _retval;
+  struct_->get_element_inner_text(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 
 #ifndef NDEBUG
-template<> long CefCToCpp<CefDOMNodeCToCpp, CefDOMNode,
-    cef_domnode_t>::DebugObjCt = 0;
+template<> long CefCToCpp<CefDOMNodeCToCpp, CefDOMNode, cef_domnode_t,
+    CefSingleThreadRefCount>::DebugObjCt = 0;
 #endif
 
@@ -25,10 +25,12 @@
 // Wrap a C structure with a C++ class.
 // This class may be instantiated and accessed wrapper-side only.
 class CefDOMNodeCToCpp
-    : public CefCToCpp<CefDOMNodeCToCpp, CefDOMNode, cef_domnode_t> {
+    : public CefCToCpp<CefDOMNodeCToCpp, CefDOMNode, cef_domnode_t,
+        CefSingleThreadRefCount> {
  public:
   explicit CefDOMNodeCToCpp(cef_domnode_t* str)
-      : CefCToCpp<CefDOMNodeCToCpp, CefDOMNode, cef_domnode_t>(str) {}
+      : CefCToCpp<CefDOMNodeCToCpp, CefDOMNode, cef_domnode_t,
+          CefSingleThreadRefCount>(str) {}
   virtual ~CefDOMNodeCToCpp() {}
 
   // CefDOMNode methods
@@ -0,0 +1,35 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/ctocpp/memory_pressure_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefMemoryPressureCallbackCToCpp::OnMemoryReleased(int64 bytes_freed) {
+  if (CEF_MEMBER_MISSING(struct_, on_memory_released))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  struct_->on_memory_released(struct_,
+      bytes_freed);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefMemoryPressureCallbackCToCpp,
+    CefMemoryPressureCallback, cef_memory_pressure_callback_t>::DebugObjCt =
+    0;
+#endif
+
@@ -104,12 +104,12 @@ CefString CefPostDataElementCToCpp::GetFile() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_file(struct_);
+  CefString _retval;
+  struct_->get_file(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 size_t CefPostDataElementCToCpp::GetBytesCount() {
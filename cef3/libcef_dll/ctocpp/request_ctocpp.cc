@@ -50,12 +50,12 @@ CefString CefRequestCToCpp::GetURL() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_url(struct_);
+  CefString _retval;
+  struct_->get_url(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefRequestCToCpp::SetURL(const CefString& url) {
@@ -81,12 +81,12 @@ CefString CefRequestCToCpp::GetMethod() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_method(struct_);
+  CefString _retval;
+  struct_->get_method(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefRequestCToCpp::SetMethod(const CefString& method) {
@@ -140,22 +140,13 @@ void CefRequestCToCpp::GetHeaderMap(HeaderMap& headerMap) {
 
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
-  // Translate param: headerMap; type: string_map_multi_byref
-  cef_string_multimap_t headerMapMultimap = cef_string_multimap_alloc();
-  DCHECK(headerMapMultimap);
-  if (headerMapMultimap)
-    transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  // Translate param: headerMap; type: string_map_multi_borrowed
+  headerMap.clear();
 
   // Execute
   struct_->get_header_map(struct_,
-      headerMapMultimap);
-
-  // Restore param:headerMap; type: string_map_multi_byref
-  if (headerMapMultimap) {
-    headerMap.clear();
-    transfer_string_multimap_contents(headerMapMultimap, headerMap);
-    cef_string_multimap_free(headerMapMultimap);
-  }
+      transfer_string_multimap_block,
+      &headerMap);
 }
 
 void CefRequestCToCpp::SetHeaderMap(const HeaderMap& headerMap) {
@@ -164,19 +155,14 @@ void CefRequestCToCpp::SetHeaderMap(const HeaderMap& headerMap) {
 
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
-  // Translate param: headerMap; type: string_map_multi_byref_const
-  cef_string_multimap_t headerMapMultimap = cef_string_multimap_alloc();
-  DCHECK(headerMapMultimap);
-  if (headerMapMultimap)
-    transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  // Translate param: headerMap; type: string_map_multi_borrowed_const
+  CefStringBlock headerMapBlock(headerMap);
 
   // Execute
   struct_->set_header_map(struct_,
-      headerMapMultimap);
-
-  // Restore param:headerMap; type: string_map_multi_byref_const
-  if (headerMapMultimap)
-    cef_string_multimap_free(headerMapMultimap);
+      headerMapBlock.count(),
+      headerMapBlock.keys(),
+      headerMapBlock.values());
 }
 
 void CefRequestCToCpp::Set(const CefString& url, const CefString& method,
@@ -196,22 +182,17 @@ void CefRequestCToCpp::Set(const CefString& url, const CefString& method,
     return;
   // Unverified params: postData
 
-  // Translate param: headerMap; type: string_map_multi_byref_const
-  cef_string_multimap_t headerMapMultimap = cef_string_multimap_alloc();
-  DCHECK(headerMapMultimap);
-  if (headerMapMultimap)
-    transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  // Translate param: headerMap; type: string_map_multi_borrowed_const
+  CefStringBlock headerMapBlock(headerMap);
 
   // Execute
   struct_->set(struct_,
       url.GetStruct(),
       method.GetStruct(),
       CefPostDataCToCpp::Unwrap(postData),
-      headerMapMultimap);
-
-  // Restore param:headerMap; type: string_map_multi_byref_const
-  if (headerMapMultimap)
-    cef_string_multimap_free(headerMapMultimap);
+      headerMapBlock.count(),
+      headerMapBlock.keys(),
+      headerMapBlock.values());
 }
 
 int CefRequestCToCpp::GetFlags() {
@@ -245,12 +226,12 @@ CefString CefRequestCToCpp::GetFirstPartyForCookies() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_first_party_for_cookies(struct_);
+  CefString _retval;
+  struct_->get_first_party_for_cookies(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefRequestCToCpp::SetFirstPartyForCookies(const CefString& url) {
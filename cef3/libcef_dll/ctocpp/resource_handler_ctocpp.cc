@@ -63,6 +63,22 @@ void CefResourceHandlerCToCpp::GetResponseHeaders(
       redirectUrl.GetWritableStruct());
 }
 
+bool CefResourceHandlerCToCpp::SkipResponse(int64 bytes_to_skip,
+    int64& bytes_skipped) {
+  if (CEF_MEMBER_MISSING(struct_, skip_response))
+    return false;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = struct_->skip_response(struct_,
+      bytes_to_skip,
+      &bytes_skipped);
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 bool CefResourceHandlerCToCpp::ReadResponse(void* data_out, int bytes_to_read,
     int& bytes_read, CefRefPtr<CefCallback> callback) {
   if (CEF_MEMBER_MISSING(struct_, read_response))
@@ -0,0 +1,42 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+//
+// ---------------------------------------------------------------------------
+//
+// This file was generated by the CEF translator tool. If making changes by
+// hand only do so within the body of existing method and function
+// implementations. See the translator.README.txt file in the tools directory
+// for more information.
+//
+
+#include "libcef_dll/cpptoc/browser_host_cpptoc.h"
+#include "libcef_dll/ctocpp/resource_usage_callback_ctocpp.h"
+
+
+// VIRTUAL METHODS - Body may be edited by hand.
+
+void CefResourceUsageCallbackCToCpp::OnResourceUsage(
+    CefRefPtr<CefBrowserHost> browser_host, const CefResourceUsage& usage) {
+  if (CEF_MEMBER_MISSING(struct_, on_resource_usage))
+    return;
+
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: browser_host; type: refptr_diff
+  DCHECK(browser_host.get());
+  if (!browser_host.get())
+    return;
+
+  // Execute
+  struct_->on_resource_usage(struct_,
+      CefBrowserHostCppToC::Wrap(browser_host),
+      &usage);
+}
+
+
+#ifndef NDEBUG
+template<> long CefCToCpp<CefResourceUsageCallbackCToCpp,
+    CefResourceUsageCallback, cef_resource_usage_callback_t>::DebugObjCt = 0;
+#endif
+
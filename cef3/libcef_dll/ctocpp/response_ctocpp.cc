@@ -73,12 +73,12 @@ CefString CefResponseCToCpp::GetStatusText() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_status_text(struct_);
+  CefString _retval;
+  struct_->get_status_text(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefResponseCToCpp::SetStatusText(const CefString& statusText) {
@@ -104,12 +104,12 @@ CefString CefResponseCToCpp::GetMimeType() {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_mime_type(struct_);
+  CefString _retval;
+  struct_->get_mime_type(struct_,
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefResponseCToCpp::SetMimeType(const CefString& mimeType) {
@@ -140,13 +140,13 @@ CefString CefResponseCToCpp::GetHeader(const CefString& name) {
     return CefString();
 
   // Execute
-  cef_string_userfree_t _retval = struct_->get_header(struct_,
-      name.GetStruct());
+  CefString _retval;
+  struct_->get_header(struct_,
+      name.GetStruct(),
+      _retval.GetWritableStruct());
 
-  // Return type: string
-  CefString _retvalStr;
-  _retvalStr.AttachToUserFree(_retval);
-  return _retvalStr;
+  // Return type: string_buffer
+  return _retval;
 }
 
 void CefResponseCToCpp::GetHeaderMap(HeaderMap& headerMap) {
@@ -155,22 +155,13 @@ void CefResponseCToCpp::GetHeaderMap(HeaderMap& headerMap) {
 
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
-  // Translate param: headerMap; type: string_map_multi_byref
-  cef_string_multimap_t headerMapMultimap = cef_string_multimap_alloc();
-  DCHECK(headerMapMultimap);
-  if (headerMapMultimap)
-    transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  // Translate param: headerMap; type: string_map_multi_borrowed
+  headerMap.clear();
 
   // Execute
   struct_->get_header_map(struct_,
-      headerMapMultimap);
-
-  // Restore param:headerMap; type: string_map_multi_byref
-  if (headerMapMultimap) {
-    headerMap.clear();
-    transfer_string_multimap_contents(headerMapMultimap, headerMap);
-    cef_string_multimap_free(headerMapMultimap);
-  }
+      transfer_string_multimap_block,
+      &headerMap);
 }
 
 void CefResponseCToCpp::SetHeaderMap(const HeaderMap& headerMap) {
@@ -179,19 +170,14 @@ void CefResponseCToCpp::SetHeaderMap(const HeaderMap& headerMap) {
 
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
-  // Translate param: headerMap; type: string_map_multi_byref_const
-  cef_string_multimap_t headerMapMultimap = cef_string_multimap_alloc();
-  DCHECK(headerMapMultimap);
-  if (headerMapMultimap)
-    transfer_string_multimap_contents(headerMap, headerMapMultimap);
+  // Translate param: headerMap; type: string_map_multi_borrowed_const
+  CefStringBlock headerMapBlock(headerMap);
 
   // Execute
   struct_->set_header_map(struct_,
-      headerMapMultimap);
-
-  // Restore param:headerMap; type: string_map_multi_byref_const
-  if (headerMapMultimap)
-    cef_string_multimap_free(headerMapMultimap);
+      headerMapBlock.count(),
+      headerMapBlock.keys(),
+      headerMapBlock.values());
 }
 
 
@@ -69,7 +69,9 @@
 #include "libcef_dll/cpptoc/zip_reader_cpptoc.h"
 #include "libcef_dll/ctocpp/app_ctocpp.h"
 #include "libcef_dll/ctocpp/browser_process_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/completion_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/context_menu_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/cookie_batch_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/cookie_visitor_ctocpp.h"
 #include "libcef_dll/ctocpp/domevent_listener_ctocpp.h"
 #include "libcef_dll/ctocpp/domvisitor_ctocpp.h"
@@ -83,12 +85,15 @@
 #include "libcef_dll/ctocpp/keyboard_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/life_span_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/load_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/memory_pressure_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/proxy_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/read_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/render_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/render_process_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/request_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/resource_bundle_handler_ctocpp.h"
 #include "libcef_dll/ctocpp/resource_handler_ctocpp.h"
+#include "libcef_dll/ctocpp/resource_usage_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/run_file_dialog_callback_ctocpp.h"
 #include "libcef_dll/ctocpp/scheme_handler_factory_ctocpp.h"
 #include "libcef_dll/ctocpp/string_visitor_ctocpp.h"
@@ -176,8 +181,10 @@ CEF_EXPORT void cef_shutdown() {
   DCHECK_EQ(CefBrowserHostCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefBrowserProcessHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefCallbackCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefCompletionHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefContextMenuHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefContextMenuParamsCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefCookieBatchVisitorCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefCookieManagerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefCookieVisitorCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefDOMDocumentCppToC::DebugObjCt, 0);
@@ -203,15 +210,18 @@ CEF_EXPORT void cef_shutdown() {
   DCHECK_EQ(CefLifeSpanHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefListValueCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefLoadHandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefMemoryPressureCallbackCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefMenuModelCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefProcessMessageCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefProxyHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefQuotaCallbackCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefReadHandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefRenderHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefRenderProcessHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefRequestHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefResourceBundleHandlerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefResourceHandlerCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefResourceUsageCallbackCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefRunFileDialogCallbackCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeHandlerFactoryCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeRegistrarCppToC::DebugObjCt, 0);
@@ -405,6 +415,25 @@ CEF_EXPORT int cef_clear_scheme_handler_factories() {
   return _retval;
 }
 
+CEF_EXPORT int64 cef_get_scheme_handler_factory_hit_count(
+    const cef_string_t* scheme_name, const cef_string_t* domain_name) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: scheme_name; type: string_byref_const
+  DCHECK(scheme_name);
+  if (!scheme_name)
+    return -1;
+  // Unverified params: domain_name
+
+  // Execute
+  int64 _retval = CefGetSchemeHandlerFactoryHitCount(
+      CefString(scheme_name),
+      CefString(domain_name));
+
+  // Return type: simple
+  return _retval;
+}
+
 CEF_EXPORT int cef_currently_on(cef_thread_id_t threadId) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -434,6 +463,32 @@ CEF_EXPORT int cef_post_task(cef_thread_id_t threadId,
   return _retval;
 }
 
+CEF_EXPORT int cef_post_task_batch(cef_thread_id_t threadId, size_t tasksCount,
+    struct _cef_task_t* const* tasks) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: tasks; type: refptr_vec_diff_byref_const
+  DCHECK(tasksCount == 0 || tasks);
+  if (tasksCount > 0 && !tasks)
+    return 0;
+
+  // Translate param: tasks; type: refptr_vec_diff_byref_const
+  std::vector<CefRefPtr<CefTask> > tasksList;
+  if (tasksCount > 0) {
+    for (size_t i = 0; i < tasksCount; ++i) {
+      tasksList.push_back(CefTaskCToCpp::Wrap(tasks[i]));
+    }
+  }
+
+  // Execute
+  bool _retval = CefPostTaskBatch(
+      threadId,
+      tasksList);
+
+  // Return type: bool
+  return _retval;
+}
+
 CEF_EXPORT int cef_post_delayed_task(cef_thread_id_t threadId,
     struct _cef_task_t* task, int64 delay_ms) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -453,6 +508,45 @@ CEF_EXPORT int cef_post_delayed_task(cef_thread_id_t threadId,
   return _retval;
 }
 
+CEF_EXPORT int cef_post_worker_task(cef_worker_priority_t priority,
+    struct _cef_task_t* task) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: task; type: refptr_diff
+  DCHECK(task);
+  if (!task)
+    return 0;
+
+  // Execute
+  bool _retval = CefPostWorkerTask(
+      priority,
+      CefTaskCToCpp::Wrap(task));
+
+  // Return type: bool
+  return _retval;
+}
+
+CEF_EXPORT int cef_get_worker_queue_depth(cef_worker_priority_t priority) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = CefGetWorkerQueueDepth(
+      priority);
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_EXPORT int cef_get_worker_thread_count() {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = CefGetWorkerThreadCount();
+
+  // Return type: simple
+  return _retval;
+}
+
 CEF_EXPORT int cef_begin_tracing(struct _cef_trace_client_t* client,
     const cef_string_t* categories) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
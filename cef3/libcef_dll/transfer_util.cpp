@@ -4,6 +4,37 @@
 
 #include "transfer_util.h"
 
+namespace {
+
+// Returns a borrowed value that references the contents of |str|.
+cef_string_t get_borrowed_string(const CefString& str) {
+  cef_string_t value = {NULL, 0, NULL};
+  const cef_string_t* src = str.GetStruct();
+  if (src) {
+    value.str = src->str;
+    value.length = src->length;
+  }
+  return value;
+}
+
+}  // namespace
+
+void transfer_string_contents(CefString& fromStr, cef_string_t* toStr)
+{
+  cef_string_clear(toStr);
+  if (fromStr.empty())
+    return;
+
+  cef_string_t* fromStruct = fromStr.GetWritableStruct();
+  if (fromStr.IsOwner() && fromStruct->dtor) {
+    // Take ownership of the existing string data.
+    *toStr = *fromStruct;
+    memset(fromStruct, 0, sizeof(cef_string_t));
+  } else {
+    cef_string_share(fromStruct, toStr);
+  }
+}
+
 void transfer_string_list_contents(cef_string_list_t fromList,
                                    StringList& toList)
 {
@@ -70,3 +101,94 @@ void transfer_string_multimap_contents(const StringMultimap& fromMap,
         it->second.GetStruct());
   }
 }
+
+void transfer_string_block_contents(size_t count,
+                                    const cef_string_t* keys,
+                                    const cef_string_t* values,
+                                    StringList& toList)
+{
+  if (count == 0 || !keys)
+    return;
+
+  toList.reserve(toList.size() + count);
+  for(size_t i = 0; i < count; ++i)
+    toList.push_back(CefString(&keys[i]));
+}
+
+void transfer_string_block_contents(size_t count,
+                                    const cef_string_t* keys,
+                                    const cef_string_t* values,
+                                    StringMap& toMap)
+{
+  if (count == 0 || !keys || !values)
+    return;
+
+  for(size_t i = 0; i < count; ++i)
+    toMap.insert(std::make_pair(CefString(&keys[i]), CefString(&values[i])));
+}
+
+void transfer_string_block_contents(size_t count,
+                                    const cef_string_t* keys,
+                                    const cef_string_t* values,
+                                    StringMultimap& toMap)
+{
+  if (count == 0 || !keys || !values)
+    return;
+
+  for(size_t i = 0; i < count; ++i)
+    toMap.insert(std::make_pair(CefString(&keys[i]), CefString(&values[i])));
+}
+
+void CEF_CALLBACK transfer_string_list_block(void* context, size_t count,
+                                             const cef_string_t* keys,
+                                             const cef_string_t* values)
+{
+  transfer_string_block_contents(count, keys, values,
+                                 *static_cast<StringList*>(context));
+}
+
+void CEF_CALLBACK transfer_string_map_block(void* context, size_t count,
+                                            const cef_string_t* keys,
+                                            const cef_string_t* values)
+{
+  transfer_string_block_contents(count, keys, values,
+                                 *static_cast<StringMap*>(context));
+}
+
+void CEF_CALLBACK transfer_string_multimap_block(void* context, size_t count,
+                                                 const cef_string_t* keys,
+                                                 const cef_string_t* values)
+{
+  transfer_string_block_contents(count, keys, values,
+                                 *static_cast<StringMultimap*>(context));
+}
+
+CefStringBlock::CefStringBlock(const StringList& fromList)
+{
+  size_t size = fromList.size();
+  keys_.reserve(size);
+  for(size_t i = 0; i < size; ++i)
+    keys_.push_back(get_borrowed_string(fromList[i]));
+}
+
+CefStringBlock::CefStringBlock(const StringMap& fromMap)
+{
+  InitFromMap(fromMap);
+}
+
+CefStringBlock::CefStringBlock(const StringMultimap& fromMap)
+{
+  InitFromMap(fromMap);
+}
+
+template <class MapType>
+void CefStringBlock::InitFromMap(const MapType& fromMap)
+{
+  keys_.reserve(fromMap.size());
+  values_.reserve(fromMap.size());
+  typename MapType::const_iterator it = fromMap.begin();
+  for(; it != fromMap.end(); ++it) {
+    keys_.push_back(get_borrowed_string(it->first));
+    values_.push_back(get_borrowed_string(it->second));
+  }
+}
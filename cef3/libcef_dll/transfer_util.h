@@ -13,6 +13,10 @@
 #include "include/internal/cef_string_map.h"
 #include "include/internal/cef_string_multimap.h"
 
+// Move contents from a string object to a caller-provided string structure.
+// The string data is transferred without copying when |fromStr| owns it.
+void transfer_string_contents(CefString& fromStr, cef_string_t* toStr);
+
 // Copy contents from one list type to another.
 typedef std::vector<CefString> StringList;
 void transfer_string_list_contents(cef_string_list_t fromList,
@@ -34,4 +38,62 @@ void transfer_string_multimap_contents(cef_string_multimap_t fromMap,
 void transfer_string_multimap_contents(const StringMultimap& fromMap,
                                        cef_string_multimap_t toMap);
 
+// Copy contents from a block of borrowed strings to a collection type. |values|
+// is ignored for lists.
+void transfer_string_block_contents(size_t count,
+                                    const cef_string_t* keys,
+                                    const cef_string_t* values,
+                                    StringList& toList);
+void transfer_string_block_contents(size_t count,
+                                    const cef_string_t* keys,
+                                    const cef_string_t* values,
+                                    StringMap& toMap);
+void transfer_string_block_contents(size_t count,
+                                    const cef_string_t* keys,
+                                    const cef_string_t* values,
+                                    StringMultimap& toMap);
+
+// Block visitor functions that append the block contents to the collection
+// passed as |context|.
+void CEF_CALLBACK transfer_string_list_block(void* context, size_t count,
+                                             const cef_string_t* keys,
+                                             const cef_string_t* values);
+void CEF_CALLBACK transfer_string_map_block(void* context, size_t count,
+                                            const cef_string_t* keys,
+                                            const cef_string_t* values);
+void CEF_CALLBACK transfer_string_multimap_block(void* context, size_t count,
+                                                 const cef_string_t* keys,
+                                                 const cef_string_t* values);
+
+// Borrowed view of the strings in a collection as one contiguous block. The
+// strings are not copied and the view is only valid while the collection is
+// unchanged.
+class CefStringBlock {
+ public:
+  explicit CefStringBlock(const StringList& fromList);
+  explicit CefStringBlock(const StringMap& fromMap);
+  explicit CefStringBlock(const StringMultimap& fromMap);
+
+  size_t count() const { return keys_.size(); }
+  const cef_string_t* keys() const {
+    return keys_.empty() ? NULL : &keys_[0];
+  }
+  // Returns NULL for lists.
+  const cef_string_t* values() const {
+    return values_.empty() ? NULL : &values_[0];
+  }
+
+  // Deliver the block to |visitor|.
+  void Visit(cef_string_block_visitor_t visitor, void* context) const {
+    visitor(context, count(), keys(), values());
+  }
+
+ private:
+  template <class MapType>
+  void InitFromMap(const MapType& fromMap);
+
+  std::vector<cef_string_t> keys_;
+  std::vector<cef_string_t> values_;
+};
+
 #endif  // CEF_LIBCEF_DLL_TRANSFER_UTIL_H_
@@ -0,0 +1,627 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include "include/wrapper/cef_asset_resource_handler.h"
+
+#include <string.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "include/cef_callback.h"
+#include "include/cef_request.h"
+#include "include/cef_response.h"
+#include "libcef_dll/cef_logging.h"
+
+namespace {
+
+const char kGzipExtension[] = ".gz";
+
+struct MimeTypeMapping {
+  const char* extension;
+  const char* mime_type;
+};
+
+const MimeTypeMapping kMimeTypes[] = {
+  { "css", "text/css" },
+  { "gif", "image/gif" },
+  { "htm", "text/html" },
+  { "html", "text/html" },
+  { "ico", "image/x-icon" },
+  { "jpeg", "image/jpeg" },
+  { "jpg", "image/jpeg" },
+  { "js", "application/javascript" },
+  { "json", "application/json" },
+  { "mp4", "video/mp4" },
+  { "pdf", "application/pdf" },
+  { "png", "image/png" },
+  { "svg", "image/svg+xml" },
+  { "ttf", "application/x-font-ttf" },
+  { "txt", "text/plain" },
+  { "webm", "video/webm" },
+  { "webp", "image/webp" },
+  { "woff", "application/font-woff" },
+  { "xml", "text/xml" },
+};
+
+const char kDefaultMimeType[] = "application/octet-stream";
+
+std::string ToLower(const std::string& str) {
+  std::string str_lower = str;
+  for (size_t i = 0; i < str_lower.size(); ++i) {
+    if (str_lower[i] >= 'A' && str_lower[i] <= 'Z')
+      str_lower[i] += 'a' - 'A';
+  }
+  return str_lower;
+}
+
+std::string Trim(const std::string& str) {
+  const char kWhitespace[] = " \t";
+  size_t start = str.find_first_not_of(kWhitespace);
+  if (start == std::string::npos)
+    return std::string();
+  size_t end = str.find_last_not_of(kWhitespace);
+  return str.substr(start, end - start + 1);
+}
+
+bool EndsWith(const std::string& str, const std::string& suffix) {
+  return (str.size() >= suffix.size() &&
+          str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0);
+}
+
+std::string GetMimeType(const std::string& path) {
+  size_t pos = path.rfind('.');
+  if (pos == std::string::npos)
+    return kDefaultMimeType;
+
+  const std::string& extension = ToLower(path.substr(pos + 1));
+  for (size_t i = 0; i < sizeof(kMimeTypes) / sizeof(kMimeTypes[0]); ++i) {
+    if (extension == kMimeTypes[i].extension)
+      return kMimeTypes[i].mime_type;
+  }
+  return kDefaultMimeType;
+}
+
+// Returns the value of the request header |name| using a case-insensitive
+// comparison or an empty string if the header does not exist.
+std::string GetHeaderValue(const CefRequest::HeaderMap& header_map,
+                           const std::string& name) {
+  CefRequest::HeaderMap::const_iterator it = header_map.begin();
+  for (; it != header_map.end(); ++it) {
+    if (ToLower(it->first) == name)
+      return it->second;
+  }
+  return std::string();
+}
+
+// Split |str| on commas and trim whitespace from each value.
+void SplitList(const std::string& str, std::vector<std::string>* values) {
+  size_t start = 0;
+  while (start <= str.size()) {
+    size_t end = str.find(',', start);
+    if (end == std::string::npos)
+      end = str.size();
+    const std::string& value = Trim(str.substr(start, end - start));
+    if (!value.empty())
+      values->push_back(value);
+    start = end + 1;
+  }
+}
+
+// Returns true if the Accept-Encoding header value allows gzip encoding.
+bool AcceptsGzip(const std::string& accept_encoding) {
+  std::vector<std::string> values;
+  SplitList(ToLower(accept_encoding), &values);
+
+  bool accepts = false;
+  for (size_t i = 0; i < values.size(); ++i) {
+    std::string coding = values[i];
+    std::string params;
+    size_t pos = coding.find(';');
+    if (pos != std::string::npos) {
+      params = coding.substr(pos + 1);
+      coding = Trim(coding.substr(0, pos));
+    }
+
+    if (coding != "gzip" && coding != "*")
+      continue;
+
+    // A quality value of 0 means the coding is not acceptable.
+    params.erase(std::remove(params.begin(), params.end(), ' '), params.end());
+    bool refused = (params.find("q=0") == 0 &&
+                    params.find_first_not_of("q=0.", 0) == std::string::npos);
+    if (coding == "gzip")
+      return !refused;
+    accepts = !refused;
+  }
+  return accepts;
+}
+
+// Returns true if the If-None-Match header value matches |etag|.
+bool MatchesETag(const std::string& if_none_match, const std::string& etag) {
+  std::vector<std::string> values;
+  SplitList(if_none_match, &values);
+
+  for (size_t i = 0; i < values.size(); ++i) {
+    std::string value = values[i];
+    if (value == "*")
+      return true;
+    // Weak comparison is used for If-None-Match.
+    if (value.find("W/") == 0)
+      value = value.substr(2);
+    if (value == etag)
+      return true;
+  }
+  return false;
+}
+
+bool ParseInt64(const std::string& str, int64* value) {
+  if (str.empty() || str.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+  int64 result = 0;
+  for (size_t i = 0; i < str.size(); ++i) {
+    int64 next = result * 10 + (str[i] - '0');
+    if (next < result)
+      return false;  // Overflow.
+    result = next;
+  }
+  *value = result;
+  return true;
+}
+
+enum RangeResult {
+  RANGE_NONE,
+  RANGE_VALID,
+  RANGE_UNSATISFIABLE,
+};
+
+// Parse a Range header value for content of |size| bytes. Only a single byte
+// range is supported.
+RangeResult ParseRange(const std::string& range, int64 size,
+                       int64* first, int64* last) {
+  std::string value = ToLower(Trim(range));
+  const std::string kBytesPrefix = "bytes=";
+  if (value.find(kBytesPrefix) != 0)
+    return RANGE_NONE;
+  value = Trim(value.substr(kBytesPrefix.size()));
+  if (value.find(',') != std::string::npos)
+    return RANGE_NONE;
+
+  size_t pos = value.find('-');
+  if (pos == std::string::npos)
+    return RANGE_NONE;
+
+  const std::string& first_str = Trim(value.substr(0, pos));
+  const std::string& last_str = Trim(value.substr(pos + 1));
+
+  int64 first_pos = -1, last_pos = -1;
+  if (!first_str.empty() && !ParseInt64(first_str, &first_pos))
+    return RANGE_NONE;
+  if (!last_str.empty() && !ParseInt64(last_str, &last_pos))
+    return RANGE_NONE;
+
+  if (first_pos < 0) {
+    // Suffix range specifying the last N bytes.
+    if (last_pos <= 0)
+      return (last_pos == 0) ? RANGE_UNSATISFIABLE : RANGE_NONE;
+    *first = std::max(size - last_pos, static_cast<int64>(0));
+    *last = size - 1;
+  } else {
+    if (last_pos >= 0 && last_pos < first_pos)
+      return RANGE_NONE;
+    if (first_pos >= size)
+      return RANGE_UNSATISFIABLE;
+    *first = first_pos;
+    *last = (last_pos < 0 || last_pos >= size) ? size - 1 : last_pos;
+  }
+
+  if (*first > *last)
+    return RANGE_UNSATISFIABLE;
+
+  return RANGE_VALID;
+}
+
+// Returns |time| formatted as an HTTP date.
+std::string FormatHttpDate(time_t time) {
+  static const char* kDays[] =
+      { "Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat" };
+  static const char* kMonths[] =
+      { "Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct",
+        "Nov", "Dec" };
+
+  CefTime exploded(time);
+  if (exploded.day_of_week < 0 || exploded.day_of_week > 6 ||
+      exploded.month < 1 || exploded.month > 12) {
+    return std::string();
+  }
+
+  std::stringstream ss;
+  ss << kDays[exploded.day_of_week] << ", " << std::setfill('0') <<
+        std::setw(2) << exploded.day_of_month << " " <<
+        kMonths[exploded.month - 1] << " " << std::setw(4) << exploded.year <<
+        " " << std::setw(2) << exploded.hour << ":" << std::setw(2) <<
+        exploded.minute << ":" << std::setw(2) << exploded.second << " GMT";
+  return ss.str();
+}
+
+// Returns a strong ETag value for |data| using a 64-bit FNV-1a hash.
+std::string ComputeETag(const unsigned char* data, size_t size) {
+  uint64 hash = 14695981039346656037ULL;
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= data[i];
+    hash *= 1099511628211ULL;
+  }
+
+  std::stringstream ss;
+  ss << "\"" << std::hex << std::setfill('0') << std::setw(16) << hash <<
+        "\"";
+  return ss.str();
+}
+
+// Holds a copy of asset data.
+class CefAssetData : public CefBase {
+ public:
+  CefAssetData(const void* data, size_t size)
+      : data_(static_cast<const unsigned char*>(data),
+              static_cast<const unsigned char*>(data) + size) {}
+
+  const unsigned char* GetData() const {
+    return data_.empty() ? NULL : &data_[0];
+  }
+
+ private:
+  std::vector<unsigned char> data_;
+
+  IMPLEMENT_REFCOUNTING(CefAssetData);
+};
+
+}  // namespace
+
+// Immutable asset contents. The data is owned by |data_owner_| which keeps it
+// alive for as long as any handler references the asset.
+class CefAssetTable::Asset : public CefBase {
+ public:
+  struct Representation {
+    Representation() : data(NULL), size(0) {}
+
+    const unsigned char* data;
+    size_t size;
+    CefRefPtr<CefBase> owner;
+  };
+
+  Asset(const std::string& mime_type,
+        const Representation& identity,
+        const Representation& gzip,
+        time_t last_modified)
+      : mime_type_(mime_type),
+        identity_(identity),
+        gzip_(gzip),
+        etag_(ComputeETag(identity.data, identity.size)),
+        gzip_etag_(gzip.data ? ComputeETag(gzip.data, gzip.size) :
+                               std::string()),
+        last_modified_(FormatHttpDate(last_modified)) {
+  }
+
+  const std::string& mime_type() const { return mime_type_; }
+  const Representation& identity() const { return identity_; }
+  const Representation& gzip() const { return gzip_; }
+  bool has_gzip() const { return gzip_.data != NULL; }
+  // Strong validators must differ for each content-coding so each
+  // representation has its own ETag computed from the encoded bytes.
+  const std::string& etag() const { return etag_; }
+  const std::string& gzip_etag() const { return gzip_etag_; }
+  const std::string& last_modified() const { return last_modified_; }
+
+ private:
+  const std::string mime_type_;
+  const Representation identity_;
+  const Representation gzip_;
+  const std::string etag_;
+  const std::string gzip_etag_;
+  const std::string last_modified_;
+
+  IMPLEMENT_REFCOUNTING(Asset);
+};
+
+namespace {
+
+class CefAssetResourceHandler : public CefResourceHandler {
+ public:
+  explicit CefAssetResourceHandler(CefRefPtr<CefAssetTable::Asset> asset)
+      : asset_(asset),
+        status_code_(200),
+        data_(NULL),
+        offset_(0),
+        length_(0),
+        use_gzip_(false),
+        range_first_(0),
+        range_last_(0) {
+  }
+
+  virtual bool ProcessRequest(CefRefPtr<CefRequest> request,
+                              CefRefPtr<CefCallback> callback) OVERRIDE {
+    CefRequest::HeaderMap header_map;
+    request->GetHeaderMap(header_map);
+
+    const CefAssetTable::Asset::Representation* representation =
+        &asset_->identity();
+
+    // The representation that will be returned for a complete response.
+    const bool accepts_gzip = asset_->has_gzip() &&
+        AcceptsGzip(GetHeaderValue(header_map, "accept-encoding"));
+    etag_ = accepts_gzip ? asset_->gzip_etag() : asset_->etag();
+
+    // Check validators first. If-None-Match takes precedence over
+    // If-Modified-Since.
+    const std::string& if_none_match =
+        GetHeaderValue(header_map, "if-none-match");
+    const std::string& if_modified_since =
+        GetHeaderValue(header_map, "if-modified-since");
+    bool not_modified = false;
+    if (!if_none_match.empty()) {
+      not_modified = MatchesETag(if_none_match, etag_);
+    } else if (!if_modified_since.empty()) {
+      not_modified = (Trim(if_modified_since) == asset_->last_modified());
+    }
+
+    if (not_modified) {
+      status_code_ = 304;
+    } else {
+      const std::string& range = GetHeaderValue(header_map, "range");
+      RangeResult range_result = RANGE_NONE;
+      if (!range.empty() && IfRangeMatches(header_map)) {
+        range_result = ParseRange(range, representation->size, &range_first_,
+                                  &range_last_);
+      }
+
+      if (range_result == RANGE_VALID) {
+        // Ranges are always served from the uncompressed representation.
+        status_code_ = 206;
+        offset_ = static_cast<size_t>(range_first_);
+        length_ = static_cast<size_t>(range_last_ - range_first_ + 1);
+        etag_ = asset_->etag();
+      } else if (range_result == RANGE_UNSATISFIABLE) {
+        status_code_ = 416;
+        etag_ = asset_->etag();
+      } else {
+        if (accepts_gzip) {
+          representation = &asset_->gzip();
+          use_gzip_ = true;
+        }
+        length_ = representation->size;
+      }
+    }
+
+    data_ = representation->data;
+
+    callback->Continue();
+    return true;
+  }
+
+  virtual void GetResponseHeaders(CefRefPtr<CefResponse> response,
+                                  int64& response_length,
+                                  CefString& redirectUrl) OVERRIDE {
+    CefResponse::HeaderMap header_map;
+    header_map.insert(std::make_pair("ETag", etag_));
+    if (!asset_->last_modified().empty()) {
+      header_map.insert(
+          std::make_pair("Last-Modified", asset_->last_modified()));
+    }
+    header_map.insert(std::make_pair("Accept-Ranges", "bytes"));
+    if (asset_->has_gzip())
+      header_map.insert(std::make_pair("Vary", "Accept-Encoding"));
+
+    const char* status_text = "OK";
+    std::stringstream ss;
+    switch (status_code_) {
+      case 206:
+        status_text = "Partial Content";
+        ss << "bytes " << range_first_ << "-" << range_last_ << "/" <<
+              asset_->identity().size;
+        header_map.insert(std::make_pair("Content-Range", ss.str()));
+        break;
+      case 304:
+        status_text = "Not Modified";
+        break;
+      case 416:
+        status_text = "Requested Range Not Satisfiable";
+        ss << "bytes */" << asset_->identity().size;
+        header_map.insert(std::make_pair("Content-Range", ss.str()));
+        break;
+      default:
+        if (use_gzip_)
+          header_map.insert(std::make_pair("Content-Encoding", "gzip"));
+        break;
+    }
+
+    response->SetStatus(status_code_);
+    response->SetStatusText(status_text);
+    response->SetMimeType(asset_->mime_type());
+    response->SetHeaderMap(header_map);
+
+    response_length = static_cast<int64>(length_);
+  }
+
+  virtual bool ReadResponse(void* data_out,
+                            int bytes_to_read,
+                            int& bytes_read,
+                            CefRefPtr<CefCallback> callback) OVERRIDE {
+    bytes_read = 0;
+    if (length_ == 0)
+      return false;
+
+    size_t transfer_size =
+        std::min(length_, static_cast<size_t>(bytes_to_read));
+    memcpy(data_out, data_ + offset_, transfer_size);
+    offset_ += transfer_size;
+    length_ -= transfer_size;
+
+    bytes_read = static_cast<int>(transfer_size);
+    return true;
+  }
+
+  virtual void Cancel() OVERRIDE {
+  }
+
+ private:
+  // Returns true if the Range header should be honored based on the If-Range
+  // header value. Ranges are served from the uncompressed representation so
+  // only its ETag matches.
+  bool IfRangeMatches(const CefRequest::HeaderMap& header_map) const {
+    const std::string& if_range =
+        Trim(GetHeaderValue(header_map, "if-range"));
+    return (if_range.empty() || if_range == asset_->etag() ||
+            if_range == asset_->last_modified());
+  }
+
+  CefRefPtr<CefAssetTable::Asset> asset_;
+  int status_code_;
+  std::string etag_;
+  const unsigned char* data_;
+  size_t offset_;
+  size_t length_;
+  bool use_gzip_;
+  int64 range_first_;
+  int64 range_last_;
+
+  IMPLEMENT_REFCOUNTING(CefAssetResourceHandler);
+};
+
+}  // namespace
+
+// CefAssetTable implementation
+
+CefAssetTable::CefAssetTable() {
+}
+
+CefAssetTable::~CefAssetTable() {
+}
+
+void CefAssetTable::AddAsset(const CefString& path,
+                             const CefString& mime_type,
+                             const void* data,
+                             size_t data_size,
+                             const void* gzip_data,
+                             size_t gzip_data_size,
+                             time_t last_modified) {
+  DCHECK(!path.empty());
+  DCHECK(!mime_type.empty());
+
+  Asset::Representation identity;
+  CefRefPtr<CefAssetData> identity_data = new CefAssetData(data, data_size);
+  identity.data = identity_data->GetData();
+  identity.size = data_size;
+  identity.owner = identity_data.get();
+
+  Asset::Representation gzip;
+  if (gzip_data && gzip_data_size > 0) {
+    CefRefPtr<CefAssetData> gzip_copy =
+        new CefAssetData(gzip_data, gzip_data_size);
+    gzip.data = gzip_copy->GetData();
+    gzip.size = gzip_data_size;
+    gzip.owner = gzip_copy.get();
+  }
+
+  if (last_modified == 0)
+    last_modified = time(NULL);
+
+  CefRefPtr<Asset> asset =
+      new Asset(mime_type, identity, gzip, last_modified);
+
+  AutoLock lock_scope(this);
+  assets_[path] = asset;
+}
+
+size_t CefAssetTable::AddArchive(CefRefPtr<CefZipArchive> archive,
+                                 const CefString& path_prefix,
+                                 time_t last_modified) {
+  DCHECK(archive.get());
+
+  CefZipArchive::FileMap files;
+  archive->GetFiles(files);
+
+  if (last_modified == 0)
+    last_modified = time(NULL);
+
+  const std::string& prefix = path_prefix;
+  const std::string gzip_extension = kGzipExtension;
+
+  AssetMap new_assets;
+  CefZipArchive::FileMap::const_iterator it = files.begin();
+  for (; it != files.end(); ++it) {
+    const std::string& name = it->first;
+    if (EndsWith(name, gzip_extension) &&
+        files.find(name.substr(0, name.size() - gzip_extension.size())) !=
+            files.end()) {
+      // Compressed representation of another file.
+      continue;
+    }
+
+    CefRefPtr<CefZipArchive::File> file = it->second;
+
+    Asset::Representation identity;
+    identity.data = file->GetData();
+    identity.size = file->GetDataSize();
+    identity.owner = file.get();
+
+    Asset::Representation gzip;
+    CefZipArchive::FileMap::const_iterator gzip_it =
+        files.find(name + gzip_extension);
+    if (gzip_it != files.end()) {
+      gzip.data = gzip_it->second->GetData();
+      gzip.size = gzip_it->second->GetDataSize();
+      gzip.owner = gzip_it->second.get();
+    }
+
+    new_assets[prefix + name] =
+        new Asset(GetMimeType(name), identity, gzip, last_modified);
+  }
+
+  AutoLock lock_scope(this);
+  for (AssetMap::const_iterator it = new_assets.begin();
+       it != new_assets.end(); ++it) {
+    assets_[it->first] = it->second;
+  }
+  return new_assets.size();
+}
+
+bool CefAssetTable::HasAsset(const CefString& path) {
+  AutoLock lock_scope(this);
+  return (assets_.find(path) != assets_.end());
+}
+
+bool CefAssetTable::RemoveAsset(const CefString& path) {
+  AutoLock lock_scope(this);
+  AssetMap::iterator it = assets_.find(path);
+  if (it == assets_.end())
+    return false;
+  assets_.erase(it);
+  return true;
+}
+
+void CefAssetTable::Clear() {
+  AutoLock lock_scope(this);
+  assets_.clear();
+}
+
+size_t CefAssetTable::GetAssetCount() {
+  AutoLock lock_scope(this);
+  return assets_.size();
+}
+
+CefRefPtr<CefResourceHandler> CefAssetTable::CreateHandler(
+    const CefString& path) {
+  CefRefPtr<Asset> asset;
+  {
+    AutoLock lock_scope(this);
+    AssetMap::const_iterator it = assets_.find(path);
+    if (it == assets_.end())
+      return NULL;
+    asset = it->second;
+  }
+  return new CefAssetResourceHandler(asset);
+}
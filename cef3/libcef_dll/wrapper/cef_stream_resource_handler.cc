@@ -3,6 +3,7 @@
 // can be found in the LICENSE file.
 
 #include "include/wrapper/cef_stream_resource_handler.h"
+#include <stdio.h>
 #include "include/cef_callback.h"
 #include "include/cef_request.h"
 #include "include/cef_stream.h"
@@ -48,6 +49,22 @@ void CefStreamResourceHandler::GetResponseHeaders(
     response->SetHeaderMap(header_map_);
 
   response_length = -1;
+
+  // Determine the remaining stream length if the stream is seekable.
+  int64 position = stream_->Tell();
+  if (position >= 0 && stream_->Seek(0, SEEK_END) == 0) {
+    int64 end = stream_->Tell();
+    if (stream_->Seek(position, SEEK_SET) == 0 && end >= position)
+      response_length = end - position;
+  }
+}
+
+bool CefStreamResourceHandler::SkipResponse(int64 bytes_to_skip,
+                                            int64& bytes_skipped) {
+  if (stream_->Seek(bytes_to_skip, SEEK_CUR) != 0)
+    return false;
+  bytes_skipped = bytes_to_skip;
+  return true;
 }
 
 bool CefStreamResourceHandler::ReadResponse(void* data_out,
@@ -35,7 +35,9 @@
 #include "include/cef_version.h"
 #include "libcef_dll/cpptoc/app_cpptoc.h"
 #include "libcef_dll/cpptoc/browser_process_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/completion_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/context_menu_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/cookie_batch_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/cookie_visitor_cpptoc.h"
 #include "libcef_dll/cpptoc/domevent_listener_cpptoc.h"
 #include "libcef_dll/cpptoc/domvisitor_cpptoc.h"
@@ -49,12 +51,15 @@
 #include "libcef_dll/cpptoc/keyboard_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/life_span_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/load_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/memory_pressure_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/proxy_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/read_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/render_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/render_process_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/request_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/resource_bundle_handler_cpptoc.h"
 #include "libcef_dll/cpptoc/resource_handler_cpptoc.h"
+#include "libcef_dll/cpptoc/resource_usage_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/run_file_dialog_callback_cpptoc.h"
 #include "libcef_dll/cpptoc/scheme_handler_factory_cpptoc.h"
 #include "libcef_dll/cpptoc/string_visitor_cpptoc.h"
@@ -168,8 +173,10 @@ CEF_GLOBAL void CefShutdown() {
   DCHECK_EQ(CefBrowserHostCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefBrowserProcessHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefCallbackCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefCompletionHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefContextMenuHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefContextMenuParamsCToCpp::DebugObjCt, 0);
+  DCHECK_EQ(CefCookieBatchVisitorCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefCookieManagerCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefCookieVisitorCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefDOMDocumentCToCpp::DebugObjCt, 0);
@@ -195,15 +202,18 @@ CEF_GLOBAL void CefShutdown() {
   DCHECK_EQ(CefLifeSpanHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefListValueCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefLoadHandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefMemoryPressureCallbackCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefMenuModelCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefProcessMessageCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefProxyHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefQuotaCallbackCToCpp::DebugObjCt, 0);
   DCHECK_EQ(CefReadHandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefRenderHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefRenderProcessHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefRequestHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefResourceBundleHandlerCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefResourceHandlerCppToC::DebugObjCt, 0);
+  DCHECK_EQ(CefResourceUsageCallbackCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefRunFileDialogCallbackCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeHandlerFactoryCppToC::DebugObjCt, 0);
   DCHECK_EQ(CefSchemeRegistrarCToCpp::DebugObjCt, 0);
@@ -389,6 +399,25 @@ CEF_GLOBAL bool CefClearSchemeHandlerFactories() {
   return _retval?true:false;
 }
 
+CEF_GLOBAL int64 CefGetSchemeHandlerFactoryHitCount(
+    const CefString& scheme_name, const CefString& domain_name) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: scheme_name; type: string_byref_const
+  DCHECK(!scheme_name.empty());
+  if (scheme_name.empty())
+    return -1;
+  // Unverified params: domain_name
+
+  // Execute
+  int64 _retval = cef_get_scheme_handler_factory_hit_count(
+      scheme_name.GetStruct(),
+      domain_name.GetStruct());
+
+  // Return type: simple
+  return _retval;
+}
+
 CEF_GLOBAL bool CefCurrentlyOn(CefThreadId threadId) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
 
@@ -417,6 +446,37 @@ CEF_GLOBAL bool CefPostTask(CefThreadId threadId, CefRefPtr<CefTask> task) {
   return _retval?true:false;
 }
 
+CEF_GLOBAL bool CefPostTaskBatch(CefThreadId threadId,
+    const CefTaskList& tasks) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Translate param: tasks; type: refptr_vec_diff_byref_const
+  const size_t tasksCount = tasks.size();
+  cef_task_t** tasksList = NULL;
+  if (tasksCount > 0) {
+    tasksList = new cef_task_t*[tasksCount];
+    DCHECK(tasksList);
+    if (tasksList) {
+      for (size_t i = 0; i < tasksCount; ++i) {
+        tasksList[i] = CefTaskCppToC::Wrap(tasks[i]);
+      }
+    }
+  }
+
+  // Execute
+  int _retval = cef_post_task_batch(
+      threadId,
+      tasksCount,
+      tasksList);
+
+  // Restore param:tasks; type: refptr_vec_diff_byref_const
+  if (tasksList)
+    delete [] tasksList;
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
 CEF_GLOBAL bool CefPostDelayedTask(CefThreadId threadId,
     CefRefPtr<CefTask> task, int64 delay_ms) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -436,6 +496,45 @@ CEF_GLOBAL bool CefPostDelayedTask(CefThreadId threadId,
   return _retval?true:false;
 }
 
+CEF_GLOBAL bool CefPostWorkerTask(CefWorkerPriority priority,
+    CefRefPtr<CefTask> task) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Verify param: task; type: refptr_diff
+  DCHECK(task.get());
+  if (!task.get())
+    return false;
+
+  // Execute
+  int _retval = cef_post_worker_task(
+      priority,
+      CefTaskCppToC::Wrap(task));
+
+  // Return type: bool
+  return _retval?true:false;
+}
+
+CEF_GLOBAL int CefGetWorkerQueueDepth(CefWorkerPriority priority) {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_get_worker_queue_depth(
+      priority);
+
+  // Return type: simple
+  return _retval;
+}
+
+CEF_GLOBAL int CefGetWorkerThreadCount() {
+  // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
+
+  // Execute
+  int _retval = cef_get_worker_thread_count();
+
+  // Return type: simple
+  return _retval;
+}
+
 CEF_GLOBAL bool CefBeginTracing(CefRefPtr<CefTraceClient> client,
     const CefString& categories) {
   // AUTO-GENERATED CONTENT - DELETE THIS COMMENT BEFORE MODIFYING
@@ -0,0 +1,81 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#ifndef CEF_LIBCEF_DLL_WRAPPER_CACHE_H_
+#define CEF_LIBCEF_DLL_WRAPPER_CACHE_H_
+#pragma once
+
+#include <map>
+
+#include "include/cef_base.h"
+
+// Thread-safe map of wrapped objects to the wrapper objects that currently
+// represent them on this side of the DLL boundary. Used by CefCppToC and
+// CefCToCpp so that an object crossing the boundary repeatedly reuses a single
+// wrapper instead of allocating a new wrapper for each crossing. One instance
+// exists for each wrapper type. Instances are created on first use by
+// GetInstance() and intentionally leaked so that wrappers released during
+// shutdown never access a destroyed cache.
+class CefWrapperCache {
+ public:
+  CefWrapperCache() {}
+
+  // Returns the cache stored in |*instance|, creating it if necessary.
+  // |instance| must point to zero-initialized static storage so that no static
+  // initializer is required. May be called on any thread. If multiple threads
+  // race to create the cache the losing threads delete their instance.
+  static CefWrapperCache* GetInstance(CefWrapperCache* volatile* instance) {
+    CefWrapperCache* cache = *instance;
+    if (!cache) {
+      CefWrapperCache* new_cache = new CefWrapperCache();
+#if defined(OS_WIN)
+      cache = static_cast<CefWrapperCache*>(InterlockedCompareExchangePointer(
+          reinterpret_cast<PVOID volatile*>(instance), new_cache, NULL));
+#else
+      cache = __sync_val_compare_and_swap(instance,
+                                          static_cast<CefWrapperCache*>(NULL),
+                                          new_cache);
+#endif
+      if (cache)
+        delete new_cache;
+      else
+        cache = new_cache;
+    }
+    return cache;
+  }
+
+  // Lock and unlock the cache. The lock is recursive.
+  void Lock() { lock_.Lock(); }
+  void Unlock() { lock_.Unlock(); }
+
+  // Returns the wrapper for |key| or NULL if none exists. Must be called with
+  // the lock held.
+  void* Find(const void* key) const {
+    WrapperMap::const_iterator it = map_.find(key);
+    if (it != map_.end())
+      return it->second;
+    return NULL;
+  }
+
+  // Associate |wrapper| with |key|. Must be called with the lock held.
+  void Insert(const void* key, void* wrapper) {
+    map_[key] = wrapper;
+  }
+
+  // Remove the association between |key| and |wrapper| if it exists. Must be
+  // called with the lock held.
+  void Erase(const void* key, const void* wrapper) {
+    WrapperMap::iterator it = map_.find(key);
+    if (it != map_.end() && it->second == wrapper)
+      map_.erase(it);
+  }
+
+ private:
+  typedef std::map<const void*, void*> WrapperMap;
+  WrapperMap map_;
+
+  CefCriticalSection lock_;
+};
+
+#endif  // CEF_LIBCEF_DLL_WRAPPER_CACHE_H_
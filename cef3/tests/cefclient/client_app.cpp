@@ -229,6 +229,30 @@ void ClientApp::OnBeforeChildProcessLaunch(
     (*it)->OnBeforeChildProcessLaunch(this, command_line);
 }
 
+void ClientApp::OnSpareRenderProcessClaimed(int64 wait_ms, int64 idle_ms) {
+  // Execute delegate callbacks.
+  BrowserDelegateSet::iterator it = browser_delegates_.begin();
+  for (; it != browser_delegates_.end(); ++it)
+    (*it)->OnSpareRenderProcessClaimed(this, wait_ms, idle_ms);
+}
+
+void ClientApp::OnStartupPhase(CefProcessId process,
+                               const CefString& name,
+                               int64 start_us,
+                               int64 duration_us) {
+  // Execute delegate callbacks.
+  BrowserDelegateSet::iterator it = browser_delegates_.begin();
+  for (; it != browser_delegates_.end(); ++it)
+    (*it)->OnStartupPhase(this, process, name, start_us, duration_us);
+}
+
+void ClientApp::OnScheduleMessagePumpWork(int64 delay_ms) {
+  // Execute delegate callbacks.
+  BrowserDelegateSet::iterator it = browser_delegates_.begin();
+  for (; it != browser_delegates_.end(); ++it)
+    (*it)->OnScheduleMessagePumpWork(this, delay_ms);
+}
+
 void ClientApp::GetProxyForUrl(const CefString& url,
                                CefProxyInfo& proxy_info) {
   proxy_info.proxyType = proxy_type_;
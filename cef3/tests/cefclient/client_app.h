@@ -34,6 +34,28 @@ class ClientApp : public CefApp,
         CefRefPtr<ClientApp> app,
         CefRefPtr<CefCommandLine> command_line) {
     }
+
+    // Called on the browser process UI thread when a new browser claims a
+    // spare render process.
+    virtual void OnSpareRenderProcessClaimed(CefRefPtr<ClientApp> app,
+                                             int64 wait_ms,
+                                             int64 idle_ms) {
+    }
+
+    // Called on the browser process UI thread when a startup phase completes
+    // in the browser process or in a render process.
+    virtual void OnStartupPhase(CefRefPtr<ClientApp> app,
+                                CefProcessId process,
+                                const CefString& name,
+                                int64 start_us,
+                                int64 duration_us) {
+    }
+
+    // Called on any thread when work is scheduled for the browser process
+    // main thread.
+    virtual void OnScheduleMessagePumpWork(CefRefPtr<ClientApp> app,
+                                           int64 delay_ms) {
+    }
   };
 
   typedef std::set<CefRefPtr<BrowserDelegate> > BrowserDelegateSet;
@@ -144,6 +166,13 @@ class ClientApp : public CefApp,
   virtual void OnContextInitialized() OVERRIDE;
   virtual void OnBeforeChildProcessLaunch(
       CefRefPtr<CefCommandLine> command_line) OVERRIDE;
+  virtual void OnSpareRenderProcessClaimed(int64 wait_ms,
+                                           int64 idle_ms) OVERRIDE;
+  virtual void OnStartupPhase(CefProcessId process,
+                              const CefString& name,
+                              int64 start_us,
+                              int64 duration_us) OVERRIDE;
+  virtual void OnScheduleMessagePumpWork(int64 delay_ms) OVERRIDE;
 
   // CefProxyHandler methods.
   virtual void GetProxyForUrl(const CefString& url,
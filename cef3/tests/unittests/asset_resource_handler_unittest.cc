@@ -0,0 +1,219 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <string>
+
+#include "include/cef_callback.h"
+#include "include/cef_request.h"
+#include "include/cef_response.h"
+#include "include/wrapper/cef_asset_resource_handler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kAssetPath[] = "/app/main.js";
+const char kAssetData[] = "var contents = 'main';";
+const char kAssetGzipData[] = "compressed";
+
+class TestCallback : public CefCallback {
+ public:
+  TestCallback() : continued_(false) {}
+
+  virtual void Continue() OVERRIDE { continued_ = true; }
+  virtual void Cancel() OVERRIDE {}
+
+  bool continued_;
+
+  IMPLEMENT_REFCOUNTING(TestCallback);
+};
+
+CefRefPtr<CefAssetTable> CreateTestTable() {
+  CefRefPtr<CefAssetTable> table(new CefAssetTable());
+  table->AddAsset(kAssetPath, "application/javascript", kAssetData,
+                  sizeof(kAssetData) - 1, kAssetGzipData,
+                  sizeof(kAssetGzipData) - 1, 0);
+  return table;
+}
+
+// Execute a request for |path| with the specified request headers. Returns the
+// response and populates |body| with the response data.
+CefRefPtr<CefResponse> RunRequest(CefRefPtr<CefAssetTable> table,
+                                  const CefString& path,
+                                  const CefRequest::HeaderMap& headers,
+                                  std::string* body) {
+  CefRefPtr<CefResourceHandler> handler = table->CreateHandler(path);
+  EXPECT_TRUE(handler.get());
+  if (!handler.get())
+    return NULL;
+
+  CefRefPtr<CefRequest> request(CefRequest::Create());
+  request->SetURL(std::string("test://asset") + path.ToString());
+  request->SetHeaderMap(headers);
+
+  CefRefPtr<TestCallback> callback(new TestCallback());
+  EXPECT_TRUE(handler->ProcessRequest(request, callback.get()));
+  EXPECT_TRUE(callback->continued_);
+
+  CefRefPtr<CefResponse> response(CefResponse::Create());
+  int64 response_length = -1;
+  CefString redirect_url;
+  handler->GetResponseHeaders(response, response_length, redirect_url);
+  EXPECT_TRUE(redirect_url.empty());
+
+  body->clear();
+  char buff[8];
+  int bytes_read = 0;
+  while (handler->ReadResponse(buff, sizeof(buff), bytes_read,
+                               callback.get())) {
+    EXPECT_GT(bytes_read, 0);
+    body->append(buff, bytes_read);
+  }
+
+  EXPECT_EQ(response_length, static_cast<int64>(body->size()));
+
+  return response;
+}
+
+}  // namespace
+
+// Test that an asset is returned with validators.
+TEST(AssetResourceHandlerTest, NormalResponse) {
+  CefRefPtr<CefAssetTable> table = CreateTestTable();
+  EXPECT_EQ(1U, table->GetAssetCount());
+  EXPECT_TRUE(table->HasAsset(kAssetPath));
+  EXPECT_FALSE(table->CreateHandler("/app/missing.js").get());
+
+  std::string body;
+  CefRefPtr<CefResponse> response =
+      RunRequest(table, kAssetPath, CefRequest::HeaderMap(), &body);
+  EXPECT_EQ(200, response->GetStatus());
+  EXPECT_EQ(kAssetData, body);
+  EXPECT_EQ("application/javascript", response->GetMimeType().ToString());
+  EXPECT_FALSE(response->GetHeader("ETag").empty());
+  EXPECT_FALSE(response->GetHeader("Last-Modified").empty());
+  EXPECT_TRUE(response->GetHeader("Content-Encoding").empty());
+
+  EXPECT_TRUE(table->RemoveAsset(kAssetPath));
+  EXPECT_FALSE(table->HasAsset(kAssetPath));
+}
+
+// Test that the gzip representation is returned when accepted.
+TEST(AssetResourceHandlerTest, GzipResponse) {
+  CefRefPtr<CefAssetTable> table = CreateTestTable();
+
+  CefRequest::HeaderMap headers;
+  headers.insert(std::make_pair("Accept-Encoding", "deflate, gzip"));
+
+  std::string body;
+  CefRefPtr<CefResponse> response =
+      RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(200, response->GetStatus());
+  EXPECT_EQ(kAssetGzipData, body);
+  EXPECT_EQ("gzip", response->GetHeader("Content-Encoding").ToString());
+  EXPECT_EQ("Accept-Encoding", response->GetHeader("Vary").ToString());
+
+  const CefString& gzip_etag = response->GetHeader("ETag");
+  EXPECT_FALSE(gzip_etag.empty());
+
+  // A quality value of 0 refuses the encoding.
+  headers.clear();
+  headers.insert(std::make_pair("accept-encoding", "gzip;q=0, *"));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(200, response->GetStatus());
+  EXPECT_EQ(kAssetData, body);
+  EXPECT_TRUE(response->GetHeader("Content-Encoding").empty());
+  EXPECT_EQ("Accept-Encoding", response->GetHeader("Vary").ToString());
+
+  // Each content-coding has a different strong validator.
+  const CefString& identity_etag = response->GetHeader("ETag");
+  EXPECT_FALSE(identity_etag.empty());
+  EXPECT_NE(gzip_etag, identity_etag);
+
+  // The gzip ETag only validates the gzip representation.
+  headers.clear();
+  headers.insert(std::make_pair("Accept-Encoding", "gzip"));
+  headers.insert(std::make_pair("If-None-Match", gzip_etag));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(304, response->GetStatus());
+  EXPECT_EQ(gzip_etag, response->GetHeader("ETag"));
+
+  headers.clear();
+  headers.insert(std::make_pair("If-None-Match", gzip_etag));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(200, response->GetStatus());
+  EXPECT_EQ(kAssetData, body);
+  EXPECT_EQ(identity_etag, response->GetHeader("ETag"));
+
+  // A range request validated with the gzip ETag returns the complete
+  // representation because ranges are served from the uncompressed data.
+  headers.clear();
+  headers.insert(std::make_pair("Range", "bytes=0-3"));
+  headers.insert(std::make_pair("If-Range", gzip_etag));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(200, response->GetStatus());
+  EXPECT_EQ(kAssetData, body);
+}
+
+// Test that conditional requests for an unchanged asset return 304.
+TEST(AssetResourceHandlerTest, NotModifiedResponse) {
+  CefRefPtr<CefAssetTable> table = CreateTestTable();
+
+  std::string body;
+  CefRefPtr<CefResponse> response =
+      RunRequest(table, kAssetPath, CefRequest::HeaderMap(), &body);
+  const CefString& etag = response->GetHeader("ETag");
+  const CefString& last_modified = response->GetHeader("Last-Modified");
+
+  CefRequest::HeaderMap headers;
+  headers.insert(std::make_pair("If-None-Match", etag));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(304, response->GetStatus());
+  EXPECT_TRUE(body.empty());
+
+  headers.clear();
+  headers.insert(std::make_pair("If-Modified-Since", last_modified));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(304, response->GetStatus());
+  EXPECT_TRUE(body.empty());
+
+  // A different ETag returns the complete asset.
+  headers.clear();
+  headers.insert(std::make_pair("If-None-Match", "\"0123456789abcdef\""));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(200, response->GetStatus());
+  EXPECT_EQ(kAssetData, body);
+}
+
+// Test that single byte range requests are supported.
+TEST(AssetResourceHandlerTest, RangeResponse) {
+  CefRefPtr<CefAssetTable> table = CreateTestTable();
+  const std::string data = kAssetData;
+
+  CefRequest::HeaderMap headers;
+  headers.insert(std::make_pair("Range", "bytes=4-11"));
+  headers.insert(std::make_pair("Accept-Encoding", "gzip"));
+
+  std::string body;
+  CefRefPtr<CefResponse> response =
+      RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(206, response->GetStatus());
+  EXPECT_EQ(data.substr(4, 8), body);
+  EXPECT_EQ("bytes 4-11/22", response->GetHeader("Content-Range").ToString());
+  EXPECT_TRUE(response->GetHeader("Content-Encoding").empty());
+
+  // Suffix range.
+  headers.clear();
+  headers.insert(std::make_pair("Range", "bytes=-5"));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(206, response->GetStatus());
+  EXPECT_EQ(data.substr(data.size() - 5), body);
+
+  // Unsatisfiable range.
+  headers.clear();
+  headers.insert(std::make_pair("Range", "bytes=100-"));
+  response = RunRequest(table, kAssetPath, headers, &body);
+  EXPECT_EQ(416, response->GetStatus());
+  EXPECT_EQ("bytes */22", response->GetHeader("Content-Range").ToString());
+  EXPECT_TRUE(body.empty());
+}
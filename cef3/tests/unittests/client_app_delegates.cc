@@ -9,6 +9,19 @@ void ClientApp::CreateBrowserDelegates(BrowserDelegateSet& delegates) {
   // Bring in the V8 tests.
   extern void CreateV8BrowserTests(BrowserDelegateSet& delegates);
   CreateV8BrowserTests(delegates);
+
+  // Bring in the resource bundle tests.
+  extern void CreateResourceBundleBrowserTests(BrowserDelegateSet& delegates);
+  CreateResourceBundleBrowserTests(delegates);
+
+  // Bring in the message loop tests.
+  extern void CreateMessageLoopBrowserTests(BrowserDelegateSet& delegates);
+  CreateMessageLoopBrowserTests(delegates);
+
+  // Bring in the render process pool tests.
+  extern void CreateRenderProcessPoolBrowserTests(
+      BrowserDelegateSet& delegates);
+  CreateRenderProcessPoolBrowserTests(delegates);
 }
 
 // static
@@ -18,6 +31,11 @@ void ClientApp::CreateRenderDelegates(RenderDelegateSet& delegates) {
       ClientApp::RenderDelegateSet& delegates);
   CreateProcessMessageRendererTests(delegates);
 
+  // Bring in the renderer process group tests.
+  extern void CreateRendererProcessGroupRendererTests(
+      ClientApp::RenderDelegateSet& delegates);
+  CreateRendererProcessGroupRendererTests(delegates);
+
   // Bring in the V8 tests.
   extern void CreateV8RendererTests(RenderDelegateSet& delegates);
   CreateV8RendererTests(delegates);
@@ -10,6 +10,7 @@
 #include "tests/unittests/test_suite.h"
 #include "base/scoped_temp_dir.h"
 #include "base/synchronization/waitable_event.h"
+#include "base/threading/platform_thread.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
 namespace {
@@ -44,12 +45,12 @@ class TestVisitor : public CefCookieVisitor {
       delete_cookies_(deleteCookies),
       event_(event) {
   }
-  virtual ~TestVisitor()   {
+  virtual ~TestVisitor() {
     event_->Signal();
   }
 
   virtual bool Visit(const CefCookie& cookie, int count, int total,
-                     bool& deleteCookie)   {
+                     bool& deleteCookie) {
     cookies_->push_back(cookie);
     if (delete_cookies_)
       deleteCookie = true;
@@ -63,6 +64,50 @@ class TestVisitor : public CefCookieVisitor {
   IMPLEMENT_REFCOUNTING(TestVisitor);
 };
 
+class TestBatchVisitor : public CefCookieBatchVisitor {
+ public:
+  TestBatchVisitor(CookieVector* cookies, std::vector<int>* offsets,
+                   base::WaitableEvent* event)
+    : cookies_(cookies),
+      offsets_(offsets),
+      event_(event) {
+  }
+  virtual ~TestBatchVisitor() {
+    event_->Signal();
+  }
+
+  virtual bool VisitBatch(const std::vector<CefCookie>& cookies, int offset,
+                          int total) {
+    EXPECT_EQ(static_cast<int>(cookies_->size()), offset);
+    cookies_->insert(cookies_->end(), cookies.begin(), cookies.end());
+    offsets_->push_back(offset);
+    EXPECT_LE(static_cast<int>(cookies_->size()), total);
+    return true;
+  }
+
+  CookieVector* cookies_;
+  std::vector<int>* offsets_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestBatchVisitor);
+};
+
+class TestCompletionHandler : public CefCompletionHandler {
+ public:
+  explicit TestCompletionHandler(base::WaitableEvent* event)
+    : event_(event) {
+  }
+
+  virtual void OnComplete() {
+    EXPECT_TRUE(CefCurrentlyOn(TID_IO));
+    event_->Signal();
+  }
+
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(TestCompletionHandler);
+};
+
 // Set the cookies.
 void SetCookies(CefRefPtr<CefCookieManager> manager,
                 const CefString& url, CookieVector& cookies,
@@ -186,6 +231,64 @@ void DeleteAllCookies(CefRefPtr<CefCookieManager> manager,
   event.Wait();
 }
 
+// Create |count| persistent cookies starting with index |start|. Session
+// cookies are not used because they are removed from the on-disk database
+// when it is loaded.
+void CreatePersistentCookies(CefRefPtr<CefCookieManager> manager,
+                             int start, int count,
+                             base::WaitableEvent& event) {
+  std::stringstream ss;
+  CookieVector cookies;
+
+  for (int i = start; i < start + count; ++i) {
+    CefCookie cookie;
+    ss << "commit_cookie" << i;
+    CefString(&cookie.name).FromASCII(ss.str().c_str());
+    ss.str("");
+    CefString(&cookie.value).FromASCII("My Value");
+    cookie.has_expires = true;
+    cookie.expires.year = 2200;
+    cookie.expires.month = 4;
+    cookie.expires.day_of_week = 5;
+    cookie.expires.day_of_month = 11;
+    cookies.push_back(cookie);
+  }
+
+  SetCookies(manager, kTestUrl, cookies, event);
+
+  // Cookies are applied asynchronously while the store is loading. Visiting
+  // the cookies waits until all previous changes have been applied.
+  CookieVector visited;
+  VisitAllCookies(manager, visited, false, event);
+  EXPECT_EQ((CookieVector::size_type)(start + count), visited.size());
+}
+
+// Returns the number of cookies that have been written to the on-disk cookie
+// database in |path|. A separate manager is used to read the database so that
+// changes still pending in other managers are not counted.
+int GetCookieCountOnDisk(const CefString& path, base::WaitableEvent& event) {
+  CefRefPtr<CefCookieManager> manager = CefCookieManager::CreateManager(path);
+  EXPECT_TRUE(manager.get());
+
+  CookieVector cookies;
+  VisitAllCookies(manager, cookies, false, event);
+  return static_cast<int>(cookies.size());
+}
+
+// Create a cookie manager in |path| that uses the specified commit policy.
+CefRefPtr<CefCookieManager> CreateManagerWithPolicy(const CefString& path,
+                                                    int commit_interval,
+                                                    int commit_batch_size,
+                                                    bool deferred_commit) {
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager.get());
+  EXPECT_TRUE(manager->SetCommitPolicy(commit_interval, commit_batch_size,
+                                       deferred_commit));
+  EXPECT_TRUE(manager->SetStoragePath(path));
+  return manager;
+}
+
 void TestDomainCookie(CefRefPtr<CefCookieManager> manager) {
   base::WaitableEvent event(false, false);
   CefCookie cookie;
@@ -374,6 +477,98 @@ void TestAllCookies(CefRefPtr<CefCookieManager> manager) {
   VerifyNoCookies(manager, event, false);
 }
 
+// Visit cookies in batches.
+void VisitDomainCookies(CefRefPtr<CefCookieManager> manager,
+                        const std::vector<CefString>& domains,
+                        int batch_size,
+                        CookieVector& cookies,
+                        std::vector<int>& offsets,
+                        base::WaitableEvent& event) {
+  EXPECT_TRUE(manager->VisitDomainCookies(domains, batch_size,
+      new TestBatchVisitor(&cookies, &offsets, &event)));
+  event.Wait();
+}
+
+void TestDomainBatches(CefRefPtr<CefCookieManager> manager) {
+  base::WaitableEvent event(false, false);
+  CookieVector cookies;
+  std::vector<int> offsets;
+
+  // Delete all system cookies just in case something is left over from a
+  // different test.
+  DeleteCookies(manager, CefString(), CefString(), event);
+
+  // Create 3 cookies for each of 2 separate domains in a single operation.
+  const char* kDomains[] = {"foo.com", "www.bar.com"};
+  for (size_t i = 0; i < arraysize(kDomains); ++i) {
+    for (int j = 0; j < 3; ++j) {
+      CefCookie cookie;
+      CefString(&cookie.name).FromString(
+          std::string("my_cookie") + static_cast<char>('0' + j));
+      CefString(&cookie.value).FromASCII("My Value");
+      CefString(&cookie.domain).FromASCII(kDomains[i]);
+      CefString(&cookie.path).FromASCII("/");
+      cookies.push_back(cookie);
+    }
+  }
+  EXPECT_TRUE(manager->SetCookies(CefString(), cookies));
+  cookies.clear();
+
+  // Wait for the cookies to be set on the IO thread.
+  WaitForIOThread();
+
+  // Visit all cookies in batches of 4.
+  VisitDomainCookies(manager, std::vector<CefString>(), 4, cookies, offsets,
+                     event);
+  EXPECT_EQ((CookieVector::size_type)6, cookies.size());
+  EXPECT_EQ((std::vector<int>::size_type)2, offsets.size());
+  EXPECT_EQ(0, offsets[0]);
+  EXPECT_EQ(4, offsets[1]);
+  cookies.clear();
+  offsets.clear();
+
+  // Visit the cookies for the first domain. The domain match is
+  // case-insensitive and ignores the leading '.'.
+  std::vector<CefString> domains;
+  domains.push_back(".FOO.com");
+  VisitDomainCookies(manager, domains, 0, cookies, offsets, event);
+  EXPECT_EQ((CookieVector::size_type)3, cookies.size());
+  EXPECT_EQ((std::vector<int>::size_type)1, offsets.size());
+  for (size_t i = 0; i < cookies.size(); ++i)
+    EXPECT_EQ(CefString(&cookies[i].domain), ".foo.com");
+  cookies.clear();
+  offsets.clear();
+
+  // A subdomain of the second domain does not match the cookies that were set
+  // on the second domain itself.
+  domains.clear();
+  domains.push_back("sub.www.bar.com");
+  VisitDomainCookies(manager, domains, 0, cookies, offsets, event);
+  EXPECT_EQ((CookieVector::size_type)0, cookies.size());
+  EXPECT_EQ((std::vector<int>::size_type)0, offsets.size());
+
+  // Delete the cookies for the second domain.
+  domains.clear();
+  domains.push_back("bar.com");
+  EXPECT_TRUE(manager->DeleteDomainCookies(domains));
+
+  // Wait for the cookies to be deleted on the IO thread.
+  WaitForIOThread();
+
+  // Verify that only the cookies for the first domain remain.
+  VisitDomainCookies(manager, std::vector<CefString>(), 10, cookies, offsets,
+                     event);
+  EXPECT_EQ((CookieVector::size_type)3, cookies.size());
+  for (size_t i = 0; i < cookies.size(); ++i)
+    EXPECT_EQ(CefString(&cookies[i].domain), ".foo.com");
+
+  // Delete all of the system cookies.
+  DeleteAllCookies(manager, event);
+
+  // Verify that all system cookies have been deleted.
+  VerifyNoCookies(manager, event, false);
+}
+
 void TestChangeDirectory(CefRefPtr<CefCookieManager> manager,
                          const CefString& original_dir) {
   base::WaitableEvent event(false, false);
@@ -550,6 +745,128 @@ TEST(CookieTest, AllCookiesOnDisk) {
   TestAllCookies(manager);
 }
 
+TEST(CookieTest, DomainBatchesGlobal) {
+  CefRefPtr<CefCookieManager> manager = CefCookieManager::GetGlobalManager();
+  EXPECT_TRUE(manager.get());
+
+  TestDomainBatches(manager);
+}
+
+TEST(CookieTest, DomainBatchesInMemory) {
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(CefString());
+  EXPECT_TRUE(manager.get());
+
+  TestDomainBatches(manager);
+}
+
+// Test that the backing store can be flushed.
+TEST(CookieTest, FlushStoreOnDisk) {
+  ScopedTempDir temp_dir;
+  base::WaitableEvent event(false, false);
+  CefCookie cookie;
+
+  // Create a new temporary directory.
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+
+  CefRefPtr<CefCookieManager> manager =
+      CefCookieManager::CreateManager(temp_dir.path().value());
+  EXPECT_TRUE(manager.get());
+
+  // Create a domain cookie.
+  CreateCookie(manager, cookie, true, event);
+
+  // Flush the cookie to disk.
+  EXPECT_TRUE(manager->FlushStore(new TestCompletionHandler(&event)));
+  event.Wait();
+
+  // Retrieve, verify and delete the domain cookie.
+  GetCookie(manager, cookie, true, event, true);
+}
+
+// Test that changes are committed to disk when the batch size is reached.
+TEST(CookieTest, CommitPolicyBatchSize) {
+  ScopedTempDir temp_dir;
+  base::WaitableEvent event(false, false);
+
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  const CefString& path = temp_dir.path().value();
+
+  // Use an interval that will not elapse during the test.
+  CefRefPtr<CefCookieManager> manager =
+      CreateManagerWithPolicy(path, 60 * 1000, 3, false);
+
+  // Fewer changes than the batch size are not committed.
+  CreatePersistentCookies(manager, 0, 2, event);
+  EXPECT_EQ(0, GetCookieCountOnDisk(path, event));
+
+  // Reaching the batch size commits all pending changes.
+  CreatePersistentCookies(manager, 2, 1, event);
+  EXPECT_EQ(3, GetCookieCountOnDisk(path, event));
+
+  // Flushing commits the remaining changes.
+  CreatePersistentCookies(manager, 3, 1, event);
+  EXPECT_EQ(3, GetCookieCountOnDisk(path, event));
+  EXPECT_TRUE(manager->FlushStore(new TestCompletionHandler(&event)));
+  event.Wait();
+  EXPECT_EQ(4, GetCookieCountOnDisk(path, event));
+}
+
+// Test that changes are committed to disk when the interval elapses.
+TEST(CookieTest, CommitPolicyInterval) {
+  ScopedTempDir temp_dir;
+  base::WaitableEvent event(false, false);
+
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  const CefString& path = temp_dir.path().value();
+
+  // Use a batch size that will not be reached during the test.
+  CefRefPtr<CefCookieManager> manager =
+      CreateManagerWithPolicy(path, 100, 1000, false);
+
+  CreatePersistentCookies(manager, 0, 2, event);
+
+  // The database's own commit interval is 30 seconds so the changes will only
+  // be on disk if the configured interval was applied.
+  base::PlatformThread::Sleep(base::TimeDelta::FromMilliseconds(1000));
+  EXPECT_EQ(2, GetCookieCountOnDisk(path, event));
+}
+
+// Test that deferred commits ignore the batch size and are written when the
+// store is flushed or the manager is released.
+TEST(CookieTest, CommitPolicyDeferred) {
+  ScopedTempDir temp_dir;
+  base::WaitableEvent event(false, false);
+
+  EXPECT_TRUE(temp_dir.CreateUniqueTempDir());
+  const CefString& path = temp_dir.path().value();
+
+  // The batch size is ignored and the default interval of 5 minutes will not
+  // elapse during the test.
+  CefRefPtr<CefCookieManager> manager =
+      CreateManagerWithPolicy(path, 0, 1, true);
+
+  CreatePersistentCookies(manager, 0, 3, event);
+  EXPECT_EQ(0, GetCookieCountOnDisk(path, event));
+
+  EXPECT_TRUE(manager->FlushStore(new TestCompletionHandler(&event)));
+  event.Wait();
+  EXPECT_EQ(3, GetCookieCountOnDisk(path, event));
+
+  // Releasing the manager commits the remaining changes.
+  CreatePersistentCookies(manager, 3, 2, event);
+  EXPECT_EQ(3, GetCookieCountOnDisk(path, event));
+  manager = NULL;
+  EXPECT_EQ(5, GetCookieCountOnDisk(path, event));
+}
+
+// Test that the commit policy of the global manager cannot be changed.
+TEST(CookieTest, CommitPolicyGlobal) {
+  CefRefPtr<CefCookieManager> manager = CefCookieManager::GetGlobalManager();
+  EXPECT_TRUE(manager.get());
+  EXPECT_FALSE(manager->SetCommitPolicy(100, 1, false));
+}
+
 TEST(CookieTest, ChangeDirectoryGlobal) {
   CefRefPtr<CefCookieManager> manager = CefCookieManager::GetGlobalManager();
   EXPECT_TRUE(manager.get());
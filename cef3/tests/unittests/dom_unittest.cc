@@ -2,6 +2,7 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include <vector>
 #include "include/cef_dom.h"
 #include "tests/cefclient/client_app.h"
 #include "tests/unittests/test_handler.h"
@@ -15,6 +16,7 @@ const char* kTestMessage = "DOMTest.Message";
 enum DOMTestType {
   DOM_TEST_STRUCTURE,
   DOM_TEST_MODIFY,
+  DOM_TEST_REFCOUNT,
 };
 
 class TestDOMVisitor : public CefDOMVisitor {
@@ -193,11 +195,47 @@ class TestDOMVisitor : public CefDOMVisitor {
     ASSERT_FALSE(h1Node->SetValue("Something Different"));
   }
 
+  // Test reference counting of DOM node wrappers. DOM classes use single
+  // thread reference counting on both sides of the DLL boundary.
+  void TestRefCount(CefRefPtr<CefDOMDocument> document) {
+    CefRefPtr<CefDOMNode> bodyNode = document->GetBody();
+    ASSERT_TRUE(bodyNode.get());
+    EXPECT_EQ(1, bodyNode->GetRefCt());
+
+    // Retrieving the same node repeatedly returns the existing wrapper. The
+    // reference added on the other side for each call is released.
+    const int kCount = 10;
+    std::vector<CefRefPtr<CefDOMNode> > nodes;
+    for (int i = 0; i < kCount; ++i) {
+      nodes.push_back(document->GetBody());
+      EXPECT_EQ(bodyNode.get(), nodes.back().get());
+      EXPECT_EQ(i + 2, bodyNode->GetRefCt());
+    }
+
+    // Reaching the same node by navigation also returns the existing wrapper.
+    CefRefPtr<CefDOMNode> h1Node = bodyNode->GetFirstChild();
+    ASSERT_TRUE(h1Node.get());
+    CefRefPtr<CefDOMNode> parentNode = h1Node->GetParent();
+    EXPECT_EQ(bodyNode.get(), parentNode.get());
+    EXPECT_TRUE(bodyNode->IsSame(parentNode));
+    parentNode = NULL;
+
+    nodes.clear();
+    EXPECT_EQ(1, bodyNode->GetRefCt());
+    EXPECT_EQ(1, h1Node->GetRefCt());
+
+    // The node keeps working after the other references are released.
+    EXPECT_EQ(bodyNode->GetName(), "BODY");
+    EXPECT_TRUE(h1Node->IsSame(bodyNode->GetFirstChild()));
+  }
+
   virtual void Visit(CefRefPtr<CefDOMDocument> document) OVERRIDE {
     if (test_type_ == DOM_TEST_STRUCTURE)
       TestStructure(document);
     else if (test_type_ == DOM_TEST_MODIFY)
       TestModify(document);
+    else if (test_type_ == DOM_TEST_REFCOUNT)
+      TestRefCount(document);
 
     DestroyTest();
   }
@@ -325,6 +363,16 @@ TEST(DOMTest, Modify) {
   EXPECT_TRUE(handler->got_success_);
 }
 
+// Test DOM node reference counting.
+TEST(DOMTest, RefCount) {
+  CefRefPtr<TestDOMHandler> handler =
+      new TestDOMHandler(DOM_TEST_REFCOUNT);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_message_);
+  EXPECT_TRUE(handler->got_success_);
+}
+
 // Entry point for creating DOM renderer test objects.
 // Called from client_app_delegates.cc.
 void CreateDOMRendererTests(ClientApp::RenderDelegateSet& delegates) {
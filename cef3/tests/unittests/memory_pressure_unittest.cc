@@ -0,0 +1,107 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <string>
+
+#include "include/cef_browser.h"
+#include "tests/unittests/test_handler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kMemoryPressureUrl[] = "http://tests/MemoryPressureTest";
+
+class MemoryPressureTestHandler;
+
+// Callback that forwards the result to the test handler.
+class MemoryReleasedCallback : public CefMemoryPressureCallback {
+ public:
+  explicit MemoryReleasedCallback(MemoryPressureTestHandler* handler)
+      : handler_(handler) {
+  }
+
+  virtual void OnMemoryReleased(int64 bytes_freed) OVERRIDE;
+
+ private:
+  CefRefPtr<MemoryPressureTestHandler> handler_;
+
+  IMPLEMENT_REFCOUNTING(MemoryReleasedCallback);
+};
+
+class MemoryPressureTestHandler : public TestHandler {
+ public:
+  explicit MemoryPressureTestHandler(cef_memory_pressure_level_t level)
+      : level_(level),
+        bytes_freed_(-1) {
+  }
+
+  virtual void RunTest() OVERRIDE {
+    // Allocate some objects that become garbage once the script completes.
+    std::string content =
+        "<html><head>\n"
+        "<script>\n"
+        "var garbage = [];\n"
+        "for (var i = 0; i < 10000; ++i)\n"
+        "  garbage.push({value: 'object ' + i});\n"
+        "garbage = null;\n"
+        "</script>\n"
+        "</head><body>TEST</body></html>";
+    AddResource(kMemoryPressureUrl, content, "text/html");
+    CreateBrowser(kMemoryPressureUrl);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    // A request without a callback should be ignored by the browser process.
+    browser->GetHost()->NotifyMemoryPressure(level_, NULL);
+
+    browser->GetHost()->NotifyMemoryPressure(level_,
+        new MemoryReleasedCallback(this));
+  }
+
+  void OnMemoryReleased(int64 bytes_freed) {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    EXPECT_FALSE(got_memory_released_);
+
+    got_memory_released_.yes();
+    bytes_freed_ = bytes_freed;
+
+    DestroyTest();
+  }
+
+  cef_memory_pressure_level_t level_;
+  TrackCallback got_memory_released_;
+  int64 bytes_freed_;
+};
+
+void MemoryReleasedCallback::OnMemoryReleased(int64 bytes_freed) {
+  handler_->OnMemoryReleased(bytes_freed);
+  handler_ = NULL;
+}
+
+}  // namespace
+
+// Test that a render process responds to moderate memory pressure.
+TEST(MemoryPressureTest, Moderate) {
+  CefRefPtr<MemoryPressureTestHandler> handler =
+      new MemoryPressureTestHandler(MEMORY_PRESSURE_LEVEL_MODERATE);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_memory_released_);
+  EXPECT_GE(handler->bytes_freed_, 0);
+}
+
+// Test that a render process responds to critical memory pressure.
+TEST(MemoryPressureTest, Critical) {
+  CefRefPtr<MemoryPressureTestHandler> handler =
+      new MemoryPressureTestHandler(MEMORY_PRESSURE_LEVEL_CRITICAL);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_memory_released_);
+  EXPECT_GE(handler->bytes_freed_, 0);
+}
@@ -0,0 +1,197 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <algorithm>
+#include <vector>
+
+#include "include/cef_app.h"
+#include "include/cef_runnable.h"
+#include "include/cef_task.h"
+#include "tests/cefclient/client_app.h"
+#include "base/synchronization/lock.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+// Protects the below state.
+base::Lock g_schedule_lock;
+
+// True while OnScheduleMessagePumpWork() notifications are being recorded.
+bool g_schedule_recording = false;
+
+// Delays passed to OnScheduleMessagePumpWork().
+std::vector<int64> g_schedule_delays;
+
+// Records work scheduled for the browser process main thread.
+class MessageLoopBrowserTest : public ClientApp::BrowserDelegate {
+ public:
+  MessageLoopBrowserTest() {}
+
+  // May be called on any thread.
+  virtual void OnScheduleMessagePumpWork(CefRefPtr<ClientApp> app,
+                                         int64 delay_ms) OVERRIDE {
+    base::AutoLock lock_scope(g_schedule_lock);
+    if (g_schedule_recording)
+      g_schedule_delays.push_back(delay_ms);
+  }
+
+ private:
+  IMPLEMENT_REFCOUNTING(MessageLoopBrowserTest);
+};
+
+// Drives the CEF message loop by calling CefDoMessageLoopWork() when work is
+// scheduled via CefBrowserProcessHandler::OnScheduleMessagePumpWork().
+class ExternalMessagePump : public ClientApp::BrowserDelegate {
+ public:
+  ExternalMessagePump()
+    : work_event_(false, false),
+      quit_(false) {
+  }
+
+  // May be called on any thread.
+  virtual void OnScheduleMessagePumpWork(CefRefPtr<ClientApp> app,
+                                         int64 delay_ms) OVERRIDE {
+    {
+      base::AutoLock lock_scope(lock_);
+      const base::TimeTicks work_time = base::TimeTicks::Now() +
+          base::TimeDelta::FromMilliseconds(delay_ms);
+      if (next_work_time_.is_null() || work_time < next_work_time_)
+        next_work_time_ = work_time;
+    }
+    work_event_.Signal();
+  }
+
+  // Run the message loop until Quit() is called. Must be called on the main
+  // application thread.
+  void Run() {
+    // Process any work that was scheduled before the pump started.
+    CefDoMessageLoopWork();
+
+    while (!quit_) {
+      base::TimeTicks next_work_time;
+      {
+        base::AutoLock lock_scope(lock_);
+        next_work_time = next_work_time_;
+      }
+
+      const base::TimeTicks now = base::TimeTicks::Now();
+      if (next_work_time.is_null()) {
+        work_event_.Wait();
+        continue;
+      } else if (next_work_time > now) {
+        work_event_.TimedWait(next_work_time - now);
+        continue;
+      }
+
+      {
+        base::AutoLock lock_scope(lock_);
+        next_work_time_ = base::TimeTicks();
+      }
+      CefDoMessageLoopWork();
+    }
+  }
+
+  // Must be called on the main application thread from a task executed by
+  // CefDoMessageLoopWork().
+  void Quit() {
+    quit_ = true;
+  }
+
+ private:
+  base::Lock lock_;
+  base::TimeTicks next_work_time_;
+  base::WaitableEvent work_event_;
+  bool quit_;
+
+  IMPLEMENT_REFCOUNTING(ExternalMessagePump);
+};
+
+CefRefPtr<ExternalMessagePump> g_external_message_pump;
+
+void StartRecording() {
+  base::AutoLock lock_scope(g_schedule_lock);
+  g_schedule_recording = true;
+  g_schedule_delays.clear();
+}
+
+std::vector<int64> StopRecording() {
+  base::AutoLock lock_scope(g_schedule_lock);
+  g_schedule_recording = false;
+  std::vector<int64> delays;
+  delays.swap(g_schedule_delays);
+  return delays;
+}
+
+void SignalEvent(base::WaitableEvent* event) {
+  EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+  event->Signal();
+}
+
+}  // namespace
+
+// Test that the application is asked to do message loop work when tasks are
+// posted to the UI thread. Run with --external-message-pump to drive the
+// message loop with CefDoMessageLoopWork() based only on these notifications.
+TEST(MessageLoopTest, ScheduleMessagePumpWork) {
+  base::WaitableEvent event(false, false);
+
+  // Immediate work is scheduled without delay.
+  StartRecording();
+  EXPECT_TRUE(CefPostTask(TID_UI,
+      NewCefRunnableFunction(SignalEvent, &event)));
+  event.Wait();
+
+  std::vector<int64> delays = StopRecording();
+  ASSERT_FALSE(delays.empty());
+  EXPECT_TRUE(std::find(delays.begin(), delays.end(), 0) != delays.end());
+
+  // Delayed work is scheduled no later than the task delay. Other delayed
+  // tasks on the UI thread may also be reported.
+  const int64 kDelayMs = 200;
+  const base::TimeTicks start_time = base::TimeTicks::Now();
+  StartRecording();
+  EXPECT_TRUE(CefPostDelayedTask(TID_UI,
+      NewCefRunnableFunction(SignalEvent, &event), kDelayMs));
+  event.Wait();
+  const int64 elapsed_ms =
+      (base::TimeTicks::Now() - start_time).InMilliseconds();
+
+  delays = StopRecording();
+  ASSERT_FALSE(delays.empty());
+
+  bool got_delayed_schedule = false;
+  std::vector<int64>::const_iterator it = delays.begin();
+  for (; it != delays.end(); ++it) {
+    // Delays for work that is already due are never negative.
+    EXPECT_GE(*it, 0);
+    if (*it > 0 && *it <= kDelayMs)
+      got_delayed_schedule = true;
+  }
+  EXPECT_TRUE(got_delayed_schedule);
+
+  // Allow for the timer resolution of the platform.
+  EXPECT_GE(elapsed_ms, kDelayMs - 20);
+}
+
+// Entry point for creating message loop browser test objects.
+// Called from client_app_delegates.cc.
+void CreateMessageLoopBrowserTests(ClientApp::BrowserDelegateSet& delegates) {
+  delegates.insert(new MessageLoopBrowserTest);
+
+  g_external_message_pump = new ExternalMessagePump;
+  delegates.insert(g_external_message_pump.get());
+}
+
+// Run the CEF message loop with the external message pump until
+// QuitExternalMessagePump() is called. Called from run_all_unittests.cc when
+// the --external-message-pump switch is specified.
+void RunExternalMessagePump() {
+  g_external_message_pump->Run();
+}
+
+void QuitExternalMessagePump() {
+  g_external_message_pump->Quit();
+}
@@ -0,0 +1,250 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <string>
+
+#include "include/cef_process_message.h"
+#include "include/cef_render_handler.h"
+#include "include/cef_runnable.h"
+#include "tests/unittests/test_handler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kOsrUrl[] = "http://tests/OSRTest.Render";
+const char kOsrClickMsg[] = "OSRTest.Click";
+
+const int kViewWidth = 200;
+const int kViewHeight = 100;
+
+// Size of the view after it is resized.
+const int kResizedViewWidth = 300;
+const int kResizedViewHeight = 150;
+
+// Offset of the view in screen coordinates.
+const int kScreenOffsetX = 1000;
+const int kScreenOffsetY = 500;
+
+// Position of the simulated mouse click.
+const int kClickX = 50;
+const int kClickY = 25;
+
+// Region passed to Invalidate().
+const int kInvalidateX = 10;
+const int kInvalidateY = 20;
+const int kInvalidateWidth = 30;
+const int kInvalidateHeight = 40;
+
+class OSRTestHandler : public TestHandler,
+                       public CefRenderHandler {
+ public:
+  enum State {
+    STATE_LOADING,
+    STATE_CLICKING,
+    STATE_RESIZING,
+    STATE_INVALIDATING,
+    STATE_DONE,
+  };
+
+  OSRTestHandler()
+      : state_(STATE_LOADING),
+        view_width_(kViewWidth),
+        view_height_(kViewHeight),
+        click_x_(0),
+        click_y_(0),
+        click_screen_x_(0),
+        click_screen_y_(0) {
+  }
+
+  virtual void RunTest() OVERRIDE {
+    // Report mouse clicks to the browser process.
+    std::string content =
+        "<html><head>\n"
+        "<style>body { margin: 0; background: #00ff00; }</style>\n"
+        "<script>\n"
+        "document.addEventListener('mousedown', function(e) {\n"
+        "  app.sendMessage('" + std::string(kOsrClickMsg) + "',\n"
+        "                  [e.clientX, e.clientY, e.screenX, e.screenY]);\n"
+        "}, false);\n"
+        "</script>\n"
+        "</head><body>TEST</body></html>";
+    AddResource(kOsrUrl, content, "text/html");
+
+    CefWindowInfo windowInfo;
+    windowInfo.SetAsOffScreen(NULL);
+    CefBrowserHost::CreateBrowser(windowInfo, this, kOsrUrl,
+                                  CefBrowserSettings());
+  }
+
+  virtual CefRefPtr<CefRenderHandler> GetRenderHandler() OVERRIDE {
+    return this;
+  }
+
+  virtual bool GetViewRect(CefRefPtr<CefBrowser> browser,
+                           CefRect& rect) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    rect = CefRect(0, 0, view_width_, view_height_);
+    return true;
+  }
+
+  virtual bool GetScreenPoint(CefRefPtr<CefBrowser> browser,
+                              int viewX,
+                              int viewY,
+                              int& screenX,
+                              int& screenY) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    screenX = viewX + kScreenOffsetX;
+    screenY = viewY + kScreenOffsetY;
+    return true;
+  }
+
+  virtual void OnPaint(CefRefPtr<CefBrowser> browser,
+                       const RectList& dirtyRects,
+                       const void* buffer,
+                       int width, int height) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    EXPECT_TRUE(buffer != NULL);
+    EXPECT_FALSE(dirtyRects.empty());
+
+    got_paint_.yes();
+
+    // Every dirty rect must lie within the view.
+    RectList::const_iterator it = dirtyRects.begin();
+    for (; it != dirtyRects.end(); ++it) {
+      EXPECT_GE(it->x, 0);
+      EXPECT_GE(it->y, 0);
+      EXPECT_GT(it->width, 0);
+      EXPECT_GT(it->height, 0);
+      EXPECT_LE(it->x + it->width, width);
+      EXPECT_LE(it->y + it->height, height);
+    }
+
+    // The bottom-right pixel is covered by the page background once the page
+    // has loaded. The buffer is in BGRA order.
+    const unsigned char* pixel = static_cast<const unsigned char*>(buffer) +
+        ((height - 1) * width + (width - 1)) * 4;
+    if (pixel[0] == 0x00 && pixel[1] == 0xff && pixel[2] == 0x00 &&
+        pixel[3] == 0xff) {
+      got_background_paint_.yes();
+    }
+
+    switch (state_) {
+      case STATE_RESIZING:
+        if (width == kResizedViewWidth && height == kResizedViewHeight) {
+          got_resized_paint_.yes();
+
+          // Invalidate() paints synchronously so call it from a separate task
+          // instead of from within OnPaint().
+          state_ = STATE_INVALIDATING;
+          CefPostTask(TID_UI,
+              NewCefRunnableMethod(this, &OSRTestHandler::InvalidateView));
+        }
+        break;
+      case STATE_INVALIDATING:
+        if (dirtyRects.size() == 1 &&
+            dirtyRects[0] == CefRect(kInvalidateX, kInvalidateY,
+                                     kInvalidateWidth, kInvalidateHeight)) {
+          EXPECT_EQ(kResizedViewWidth, width);
+          EXPECT_EQ(kResizedViewHeight, height);
+          got_invalidated_paint_.yes();
+
+          state_ = STATE_DONE;
+          DestroyTest();
+        }
+        break;
+      case STATE_LOADING:
+      case STATE_CLICKING:
+        // The initial paints are at the original size.
+        EXPECT_EQ(kViewWidth, width);
+        EXPECT_EQ(kViewHeight, height);
+        break;
+      case STATE_DONE:
+        break;
+    }
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    CefRefPtr<CefBrowserHost> host = browser->GetHost();
+    EXPECT_TRUE(host->IsWindowRenderingDisabled());
+
+    // Simulate a left mouse click inside the view.
+    state_ = STATE_CLICKING;
+    CefMouseEvent event;
+    event.x = kClickX;
+    event.y = kClickY;
+    event.modifiers = 0;
+    host->SendMouseClickEvent(event, MBT_LEFT, false, 1);
+    host->SendMouseClickEvent(event, MBT_LEFT, true, 1);
+  }
+
+  virtual bool OnProcessMessageReceived(
+      CefRefPtr<CefBrowser> browser,
+      CefProcessId source_process,
+      CefRefPtr<CefProcessMessage> message) OVERRIDE {
+    EXPECT_EQ(PID_RENDERER, source_process);
+    if (message->GetName() != kOsrClickMsg)
+      return false;
+
+    CefRefPtr<CefListValue> args = message->GetArgumentList();
+    click_x_ = args->GetInt(0);
+    click_y_ = args->GetInt(1);
+    click_screen_x_ = args->GetInt(2);
+    click_screen_y_ = args->GetInt(3);
+    got_click_.yes();
+
+    // Resize the view. The new size is retrieved from GetViewRect().
+    state_ = STATE_RESIZING;
+    view_width_ = kResizedViewWidth;
+    view_height_ = kResizedViewHeight;
+    browser->GetHost()->WasResized();
+    return true;
+  }
+
+  void InvalidateView() {
+    GetBrowser()->GetHost()->Invalidate(
+        CefRect(kInvalidateX, kInvalidateY, kInvalidateWidth,
+                kInvalidateHeight));
+  }
+
+  State state_;
+  int view_width_;
+  int view_height_;
+  int click_x_;
+  int click_y_;
+  int click_screen_x_;
+  int click_screen_y_;
+  TrackCallback got_paint_;
+  TrackCallback got_background_paint_;
+  TrackCallback got_click_;
+  TrackCallback got_resized_paint_;
+  TrackCallback got_invalidated_paint_;
+};
+
+}  // namespace
+
+// Test that a browser with window rendering disabled paints through the
+// CefRenderHandler, receives mouse events sent by the client and repaints
+// when resized or invalidated.
+TEST(OSRTest, Render) {
+  CefRefPtr<OSRTestHandler> handler = new OSRTestHandler();
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_paint_);
+  EXPECT_TRUE(handler->got_background_paint_);
+
+  EXPECT_TRUE(handler->got_click_);
+  EXPECT_EQ(kClickX, handler->click_x_);
+  EXPECT_EQ(kClickY, handler->click_y_);
+  EXPECT_EQ(kClickX + kScreenOffsetX, handler->click_screen_x_);
+  EXPECT_EQ(kClickY + kScreenOffsetY, handler->click_screen_y_);
+
+  EXPECT_TRUE(handler->got_resized_paint_);
+  EXPECT_TRUE(handler->got_invalidated_paint_);
+  EXPECT_EQ(OSRTestHandler::STATE_DONE, handler->state_);
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <vector>
+
+#include "tests/cefclient/client_app.h"
+#include "tests/unittests/test_handler.h"
+#include "base/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kTestUrl[] = "http://tests/render_process_pool.html";
+
+struct SpareProcessClaim {
+  int64 wait_ms;
+  int64 idle_ms;
+};
+
+class PoolTestHandler;
+
+// Handler for the test that is currently running, if any. Only accessed on the
+// UI thread.
+PoolTestHandler* g_current_handler = NULL;
+
+// Creates a browser and waits until it has both loaded and reported claiming a
+// spare render process. Either may happen first.
+class PoolTestHandler : public TestHandler {
+ public:
+  PoolTestHandler()
+      : elapsed_ms_(0) {
+  }
+
+  virtual void RunTest() OVERRIDE {
+    AddResource(kTestUrl, "<html><body>Test</body></html>", "text/html");
+
+    g_current_handler = this;
+    start_time_ = base::TimeTicks::Now();
+    CreateBrowser(kTestUrl);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    got_load_end_.yes();
+    ContinueIfReady();
+  }
+
+  // Called when a spare render process is claimed while this test is running.
+  void OnSpareRenderProcessClaimed(const SpareProcessClaim& claim) {
+    got_claim_.yes();
+    claims_.push_back(claim);
+    ContinueIfReady();
+  }
+
+  std::vector<SpareProcessClaim> claims_;
+  int64 elapsed_ms_;
+  TrackCallback got_load_end_;
+  TrackCallback got_claim_;
+
+ private:
+  void ContinueIfReady() {
+    if (g_current_handler != this || !got_load_end_ || !got_claim_)
+      return;
+
+    elapsed_ms_ = (base::TimeTicks::Now() - start_time_).InMilliseconds();
+    g_current_handler = NULL;
+    DestroyTest();
+  }
+
+  base::TimeTicks start_time_;
+};
+
+// Forwards spare render process claims to the current test handler.
+class RenderProcessPoolBrowserTest : public ClientApp::BrowserDelegate {
+ public:
+  RenderProcessPoolBrowserTest() {}
+
+  virtual void OnSpareRenderProcessClaimed(CefRefPtr<ClientApp> app,
+                                           int64 wait_ms,
+                                           int64 idle_ms) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+
+    SpareProcessClaim claim;
+    claim.wait_ms = wait_ms;
+    claim.idle_ms = idle_ms;
+    if (g_current_handler)
+      g_current_handler->OnSpareRenderProcessClaimed(claim);
+  }
+
+ private:
+  IMPLEMENT_REFCOUNTING(RenderProcessPoolBrowserTest);
+};
+
+// Verify the claim reported to |handler|.
+void VerifyClaim(PoolTestHandler* handler) {
+  EXPECT_TRUE(handler->got_load_end_);
+  EXPECT_TRUE(handler->got_claim_);
+  ASSERT_EQ(1U, handler->claims_.size());
+
+  // A process either waited to be claimed or the browser waited for the
+  // process to finish initializing, but not both.
+  const SpareProcessClaim& claim = handler->claims_[0];
+  EXPECT_GE(claim.wait_ms, 0);
+  EXPECT_GE(claim.idle_ms, 0);
+  EXPECT_TRUE(claim.wait_ms == 0 || claim.idle_ms == 0);
+
+  // The browser cannot wait longer than the test has been running.
+  EXPECT_LE(claim.wait_ms, handler->elapsed_ms_);
+}
+
+}  // namespace
+
+// Test that a new browser claims a spare render process and that the claim is
+// reported with sane timings. CefTestSuite::GetSettings() configures a pool of
+// one spare render process.
+TEST(RenderProcessPoolTest, ClaimSpareProcess) {
+  CefRefPtr<PoolTestHandler> handler = new PoolTestHandler();
+  handler->ExecuteTest();
+
+  VerifyClaim(handler);
+
+  // The values are written to the XML output for comparison between builds.
+  if (!handler->claims_.empty()) {
+    RecordProperty("spare_process_wait_ms",
+        static_cast<int>(handler->claims_[0].wait_ms));
+    RecordProperty("spare_process_idle_ms",
+        static_cast<int>(handler->claims_[0].idle_ms));
+  }
+}
+
+// Test that the pool is refilled after a claim. The pool holds a single process
+// so the second browser can only claim a spare process that was launched after
+// the first claim.
+TEST(RenderProcessPoolTest, RefillAfterClaim) {
+  CefRefPtr<PoolTestHandler> handler1 = new PoolTestHandler();
+  handler1->ExecuteTest();
+  VerifyClaim(handler1);
+
+  CefRefPtr<PoolTestHandler> handler2 = new PoolTestHandler();
+  handler2->ExecuteTest();
+  VerifyClaim(handler2);
+}
+
+// Entry point for creating render process pool browser test objects.
+// Called from client_app_delegates.cc.
+void CreateRenderProcessPoolBrowserTests(
+    ClientApp::BrowserDelegateSet& delegates) {
+  delegates.insert(new RenderProcessPoolBrowserTest);
+}
@@ -0,0 +1,172 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "include/cef_process_message.h"
+#include "tests/cefclient/client_app.h"
+#include "tests/unittests/test_handler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kGroupUrlA1[] = "http://tests/RendererProcessGroupTest/A1";
+const char kGroupUrlA2[] = "http://tests/RendererProcessGroupTest/A2";
+const char kGroupUrlB[] = "http://tests/RendererProcessGroupTest/B";
+const char kGroupQueryMsg[] = "RendererProcessGroupTest.Query";
+
+// Renderer side. Replies to each query with the number of distinct browsers
+// that have been queried in the current render process.
+class GroupRendererTest : public ClientApp::RenderDelegate {
+ public:
+  GroupRendererTest() {}
+
+  virtual bool OnProcessMessageReceived(
+      CefRefPtr<ClientApp> app,
+      CefRefPtr<CefBrowser> browser,
+      CefProcessId source_process,
+      CefRefPtr<CefProcessMessage> message) OVERRIDE {
+    if (message->GetName() != kGroupQueryMsg)
+      return false;
+
+    browser_ids_.insert(browser->GetIdentifier());
+
+    CefRefPtr<CefProcessMessage> reply =
+        CefProcessMessage::Create(kGroupQueryMsg);
+    reply->GetArgumentList()->SetInt(0, static_cast<int>(browser_ids_.size()));
+    EXPECT_TRUE(browser->SendProcessMessage(PID_BROWSER, reply));
+    return true;
+  }
+
+ private:
+  std::set<int> browser_ids_;
+
+  IMPLEMENT_REFCOUNTING(GroupRendererTest);
+};
+
+// Browser side. Creates two browsers in group "a" and one browser in group
+// "b" and then queries each browser's render process in creation order.
+class GroupTestHandler : public TestHandler {
+ public:
+  GroupTestHandler()
+      : load_count_(0),
+        query_count_(0) {
+  }
+
+  virtual void RunTest() OVERRIDE {
+    const char* urls[] = {kGroupUrlA1, kGroupUrlA2, kGroupUrlB};
+    const char* groups[] = {"a", "a", "b"};
+    for (size_t i = 0; i < arraysize(urls); ++i) {
+      AddResource(urls[i], "<html><body>Test</body></html>", "text/html");
+
+      CefBrowserSettings settings;
+      CefString(&settings.renderer_process_group) = groups[i];
+      CreateBrowser(urls[i], settings);
+    }
+  }
+
+  virtual void OnAfterCreated(CefRefPtr<CefBrowser> browser) OVERRIDE {
+    TestHandler::OnAfterCreated(browser);
+    browsers_.push_back(browser);
+  }
+
+  virtual void OnBeforeClose(CefRefPtr<CefBrowser> browser) OVERRIDE {
+    const bool is_main = (browser->GetIdentifier() == GetBrowserId());
+
+    BrowserList::iterator it = browsers_.begin();
+    for (; it != browsers_.end(); ++it) {
+      if ((*it)->GetIdentifier() == browser->GetIdentifier()) {
+        browsers_.erase(it);
+        break;
+      }
+    }
+
+    // Close the main browser after all other browsers have closed.
+    if (!is_main && browsers_.size() == 1)
+      TestHandler::DestroyTest();
+
+    TestHandler::OnBeforeClose(browser);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    // Start querying after all browsers have loaded.
+    if (++load_count_ == 3)
+      SendQuery();
+  }
+
+  virtual bool OnProcessMessageReceived(
+      CefRefPtr<CefBrowser> browser,
+      CefProcessId source_process,
+      CefRefPtr<CefProcessMessage> message) OVERRIDE {
+    EXPECT_EQ(PID_RENDERER, source_process);
+    EXPECT_STREQ(kGroupQueryMsg, message->GetName().ToString().c_str());
+
+    results_[browser->GetMainFrame()->GetURL()] =
+        message->GetArgumentList()->GetInt(0);
+
+    if (++query_count_ < browsers_.size())
+      SendQuery();
+    else
+      DestroyTest();
+    return true;
+  }
+
+  virtual void DestroyTest() OVERRIDE {
+    if (browsers_.size() <= 1) {
+      TestHandler::DestroyTest();
+      return;
+    }
+
+    BrowserList::const_iterator it = browsers_.begin();
+    for (; it != browsers_.end(); ++it) {
+      if ((*it)->GetIdentifier() != GetBrowserId())
+        (*it)->GetHost()->CloseBrowser();
+    }
+  }
+
+  void SendQuery() {
+    CefRefPtr<CefBrowser> browser = browsers_[query_count_];
+    EXPECT_TRUE(browser->SendProcessMessage(PID_RENDERER,
+        CefProcessMessage::Create(kGroupQueryMsg)));
+  }
+
+  typedef std::vector<CefRefPtr<CefBrowser> > BrowserList;
+  BrowserList browsers_;
+
+  int load_count_;
+  size_t query_count_;
+
+  // Map of main frame URL to the number of queried browsers that shared the
+  // browser's render process at the time of the query.
+  std::map<std::string, int> results_;
+};
+
+}  // namespace
+
+// Test that browsers in the same group share a render process and that
+// browsers in different groups don't.
+TEST(RendererProcessGroupTest, SharedWithinGroup) {
+  CefRefPtr<GroupTestHandler> handler = new GroupTestHandler();
+  handler->ExecuteTest();
+
+  ASSERT_EQ(3U, handler->results_.size());
+  EXPECT_EQ(1, handler->results_[kGroupUrlA1]);
+  EXPECT_EQ(2, handler->results_[kGroupUrlA2]);
+  EXPECT_EQ(1, handler->results_[kGroupUrlB]);
+}
+
+// Entry point for creating renderer process group renderer test objects.
+// Called from client_app_delegates.cc.
+void CreateRendererProcessGroupRendererTests(
+    ClientApp::RenderDelegateSet& delegates) {
+  delegates.insert(new GroupRendererTest);
+}
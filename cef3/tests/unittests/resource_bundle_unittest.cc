@@ -0,0 +1,221 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "tests/cefclient/client_app.h"
+#include "tests/unittests/test_handler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kTestUrl[] = "http://tests/resource_bundle.html";
+const char kDevToolsUrl[] = "chrome-devtools://devtools/devtools.html";
+
+// Name of the startup phase that loads pack files.
+const char kResourceBundlePhase[] = "InitializeResourceBundle";
+
+struct StartupPhase {
+  CefProcessId process;
+  std::string name;
+  int64 start_us;
+  int64 duration_us;
+};
+
+class LoadTestHandler;
+
+// Startup phases reported to the browser process. Only accessed on the UI
+// thread.
+std::vector<StartupPhase> g_startup_phases;
+
+// Handler for the test that is currently running, if any. Only accessed on the
+// UI thread.
+LoadTestHandler* g_current_handler = NULL;
+
+// Returns the phases with |name| that were reported by |process|.
+std::vector<StartupPhase> GetStartupPhases(CefProcessId process,
+                                           const std::string& name) {
+  std::vector<StartupPhase> phases;
+  std::vector<StartupPhase>::const_iterator it = g_startup_phases.begin();
+  for (; it != g_startup_phases.end(); ++it) {
+    if (it->process == process && it->name == name)
+      phases.push_back(*it);
+  }
+  return phases;
+}
+
+// Callback that forwards the result to the test handler.
+class LoadTestUsageCallback : public CefResourceUsageCallback {
+ public:
+  explicit LoadTestUsageCallback(LoadTestHandler* handler)
+      : handler_(handler) {
+  }
+
+  virtual void OnResourceUsage(CefRefPtr<CefBrowserHost> browser_host,
+                               const CefResourceUsage& usage) OVERRIDE;
+
+ private:
+  CefRefPtr<LoadTestHandler> handler_;
+
+  IMPLEMENT_REFCOUNTING(LoadTestUsageCallback);
+};
+
+// Loads |url| and waits until both the load has completed and a render process
+// has reported loading its pack files. Phases are reported asynchronously so
+// either may happen first. The memory used by the render process is then
+// measured before the test is destroyed.
+class LoadTestHandler : public TestHandler {
+ public:
+  explicit LoadTestHandler(const std::string& url)
+      : url_(url),
+        status_code_(0) {
+  }
+
+  virtual void RunTest() OVERRIDE {
+    if (url_ == kTestUrl)
+      AddResource(url_, "<html><body>Test</body></html>", "text/html");
+
+    g_current_handler = this;
+    CreateBrowser(url_);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    got_load_end_.yes();
+    status_code_ = httpStatusCode;
+
+    ContinueIfReady();
+  }
+
+  // Called when a startup phase is reported to the browser process.
+  void OnStartupPhase(const StartupPhase& phase) {
+    if (phase.process == PID_RENDERER && phase.name == kResourceBundlePhase)
+      ContinueIfReady();
+  }
+
+  void OnResourceUsage(const CefResourceUsage& usage) {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    got_resource_usage_.yes();
+    usage_ = usage;
+
+    g_current_handler = NULL;
+    DestroyTest();
+  }
+
+  std::string url_;
+  int status_code_;
+  std::vector<StartupPhase> renderer_phases_;
+  std::vector<StartupPhase> browser_phases_;
+  CefResourceUsage usage_;
+  TrackCallback got_load_end_;
+  TrackCallback got_renderer_phase_;
+  TrackCallback got_resource_usage_;
+
+ private:
+  void ContinueIfReady() {
+    if (!got_load_end_ || got_renderer_phase_)
+      return;
+
+    // The render process for this browser may have been started by an earlier
+    // test, in which case its phase has already been reported.
+    renderer_phases_ = GetStartupPhases(PID_RENDERER, kResourceBundlePhase);
+    if (renderer_phases_.empty())
+      return;
+
+    got_renderer_phase_.yes();
+    browser_phases_ = GetStartupPhases(PID_BROWSER, kResourceBundlePhase);
+
+    GetBrowser()->GetHost()->GetResourceUsage(
+        new LoadTestUsageCallback(this));
+  }
+};
+
+void LoadTestUsageCallback::OnResourceUsage(
+    CefRefPtr<CefBrowserHost> browser_host,
+    const CefResourceUsage& usage) {
+  handler_->OnResourceUsage(usage);
+}
+
+// Records startup phases reported to the browser process handler.
+class StartupPhaseBrowserTest : public ClientApp::BrowserDelegate {
+ public:
+  StartupPhaseBrowserTest() {}
+
+  virtual void OnStartupPhase(CefRefPtr<ClientApp> app,
+                              CefProcessId process,
+                              const CefString& name,
+                              int64 start_us,
+                              int64 duration_us) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+
+    StartupPhase phase;
+    phase.process = process;
+    phase.name = name;
+    phase.start_us = start_us;
+    phase.duration_us = duration_us;
+    g_startup_phases.push_back(phase);
+
+    if (g_current_handler)
+      g_current_handler->OnStartupPhase(phase);
+  }
+
+ private:
+  IMPLEMENT_REFCOUNTING(StartupPhaseBrowserTest);
+};
+
+}  // namespace
+
+// Test that DevTools resources are still served by the browser process now that
+// they are no longer loaded in other process types.
+TEST(ResourceBundleTest, DevToolsResourcesInBrowser) {
+  CefRefPtr<LoadTestHandler> handler = new LoadTestHandler(kDevToolsUrl);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_load_end_);
+  EXPECT_TRUE(handler->got_resource_usage_);
+  EXPECT_EQ(200, handler->status_code_);
+}
+
+// Test that the time spent loading pack files is measured in both the browser
+// and render processes, and record the memory used by the render process.
+TEST(ResourceBundleTest, StartupPhases) {
+  CefRefPtr<LoadTestHandler> handler = new LoadTestHandler(kTestUrl);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_load_end_);
+  EXPECT_TRUE(handler->got_renderer_phase_);
+  EXPECT_TRUE(handler->got_resource_usage_);
+
+  ASSERT_EQ(1U, handler->browser_phases_.size());
+  EXPECT_GE(handler->browser_phases_[0].start_us, 0);
+  EXPECT_GE(handler->browser_phases_[0].duration_us, 0);
+
+  ASSERT_FALSE(handler->renderer_phases_.empty());
+  std::vector<StartupPhase>::const_iterator it =
+      handler->renderer_phases_.begin();
+  for (; it != handler->renderer_phases_.end(); ++it)
+    EXPECT_GE(it->duration_us, 0);
+
+  // Pack files are memory mapped so they are not counted as private memory.
+  // The values are written to the XML output for comparison between builds.
+  EXPECT_GT(handler->usage_.private_memory_bytes, 0);
+  RecordProperty("renderer_private_memory_kb",
+      static_cast<int>(handler->usage_.private_memory_bytes / 1024));
+  RecordProperty("renderer_resource_bundle_us",
+      static_cast<int>(handler->renderer_phases_.back().duration_us));
+  RecordProperty("browser_resource_bundle_us",
+      static_cast<int>(handler->browser_phases_[0].duration_us));
+}
+
+// Entry point for creating resource bundle browser test objects.
+// Called from client_app_delegates.cc.
+void CreateResourceBundleBrowserTests(
+    ClientApp::BrowserDelegateSet& delegates) {
+  delegates.insert(new StartupPhaseBrowserTest);
+}
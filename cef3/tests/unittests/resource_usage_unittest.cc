@@ -0,0 +1,369 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <cstring>
+#include <string>
+
+#include "include/cef_browser.h"
+#include "include/cef_request.h"
+#include "tests/unittests/test_handler.h"
+#include "base/string_number_conversions.h"
+#include "base/string_util.h"
+#include "base/synchronization/lock.h"
+#include "base/threading/platform_thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if defined(OS_WIN)
+#include <winsock2.h>
+#pragma comment(lib, "ws2_32.lib")
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+#if defined(OS_WIN)
+typedef SOCKET SocketHandle;
+typedef int SocketLength;
+const SocketHandle kInvalidSocket = INVALID_SOCKET;
+void CloseSocket(SocketHandle socket) { closesocket(socket); }
+#else
+typedef int SocketHandle;
+typedef socklen_t SocketLength;
+const SocketHandle kInvalidSocket = -1;
+void CloseSocket(SocketHandle socket) { close(socket); }
+#endif
+
+// Minimal HTTP server on the loopback interface that answers every request
+// with the same HTML page. Requests to it are sent over the network stack
+// instead of being handled in-process by a CefResourceHandler.
+class TestHttpServer : public base::PlatformThread::Delegate {
+ public:
+  explicit TestHttpServer(const std::string& content)
+      : content_(content),
+        listen_socket_(kInvalidSocket),
+        port_(0),
+        stopping_(false),
+        bytes_received_(0) {
+  }
+
+  // Start listening on an ephemeral port. Returns false on failure.
+  bool Start() {
+#if defined(OS_WIN)
+    WSADATA wsa_data;
+    if (WSAStartup(MAKEWORD(2, 2), &wsa_data) != 0)
+      return false;
+#endif
+
+    listen_socket_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (listen_socket_ == kInvalidSocket)
+      return false;
+
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = 0;
+    SocketLength addr_len = sizeof(addr);
+    if (bind(listen_socket_, reinterpret_cast<sockaddr*>(&addr),
+             sizeof(addr)) != 0 ||
+        listen(listen_socket_, 5) != 0 ||
+        getsockname(listen_socket_, reinterpret_cast<sockaddr*>(&addr),
+                    &addr_len) != 0) {
+      CloseSocket(listen_socket_);
+      return false;
+    }
+    port_ = ntohs(addr.sin_port);
+
+    return base::PlatformThread::Create(0, this, &thread_);
+  }
+
+  // Stop accepting connections and wait for the server thread to exit.
+  void Stop() {
+    {
+      base::AutoLock lock_scope(lock_);
+      stopping_ = true;
+    }
+
+    // Wake the server thread from accept().
+    SocketHandle wake_socket = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port_);
+    connect(wake_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr));
+    CloseSocket(wake_socket);
+
+    base::PlatformThread::Join(thread_);
+    CloseSocket(listen_socket_);
+
+#if defined(OS_WIN)
+    WSACleanup();
+#endif
+  }
+
+  std::string GetURL(const std::string& path) const {
+    return "http://127.0.0.1:" + base::IntToString(port_) + path;
+  }
+
+  // Returns the total number of bytes received, including request lines.
+  int64 bytes_received() {
+    base::AutoLock lock_scope(lock_);
+    return bytes_received_;
+  }
+
+  // base::PlatformThread::Delegate methods.
+  virtual void ThreadMain() OVERRIDE {
+    while (true) {
+      SocketHandle socket = accept(listen_socket_, NULL, NULL);
+      {
+        base::AutoLock lock_scope(lock_);
+        if (stopping_) {
+          if (socket != kInvalidSocket)
+            CloseSocket(socket);
+          return;
+        }
+      }
+      if (socket == kInvalidSocket)
+        continue;
+
+      HandleConnection(socket);
+      CloseSocket(socket);
+    }
+  }
+
+ private:
+  // Read a single request and send the response.
+  void HandleConnection(SocketHandle socket) {
+    std::string request;
+    size_t header_end = std::string::npos;
+    size_t content_length = 0;
+    char buffer[4096];
+
+    while (header_end == std::string::npos ||
+           request.size() < header_end + content_length) {
+      int bytes_read = recv(socket, buffer, sizeof(buffer), 0);
+      if (bytes_read <= 0)
+        break;
+      request.append(buffer, bytes_read);
+
+      if (header_end == std::string::npos) {
+        const size_t pos = request.find("\r\n\r\n");
+        if (pos != std::string::npos) {
+          header_end = pos + 4;
+          content_length = GetContentLength(request.substr(0, header_end));
+        }
+      }
+    }
+
+    {
+      base::AutoLock lock_scope(lock_);
+      bytes_received_ += request.size();
+    }
+
+    const std::string& response =
+        "HTTP/1.1 200 OK\r\n"
+        "Content-Type: text/html\r\n"
+        "Content-Length: " + base::IntToString(content_.size()) + "\r\n"
+        "Cache-Control: no-store\r\n"
+        "Connection: close\r\n"
+        "\r\n" + content_;
+    send(socket, response.data(), static_cast<int>(response.size()), 0);
+  }
+
+  static size_t GetContentLength(const std::string& headers) {
+    const std::string& lower_headers = StringToLowerASCII(headers);
+    const char kContentLength[] = "\r\ncontent-length:";
+    size_t pos = lower_headers.find(kContentLength);
+    if (pos == std::string::npos)
+      return 0;
+    pos += sizeof(kContentLength) - 1;
+    const size_t end = lower_headers.find("\r\n", pos);
+    std::string value;
+    TrimWhitespaceASCII(lower_headers.substr(pos, end - pos), TRIM_ALL,
+                        &value);
+    int length = 0;
+    if (!base::StringToInt(value, &length) || length < 0)
+      return 0;
+    return static_cast<size_t>(length);
+  }
+
+  const std::string content_;
+  SocketHandle listen_socket_;
+  int port_;
+  base::PlatformThreadHandle thread_;
+
+  // Protects |stopping_| and |bytes_received_|.
+  base::Lock lock_;
+  bool stopping_;
+  int64 bytes_received_;
+
+  DISALLOW_COPY_AND_ASSIGN(TestHttpServer);
+};
+
+const char kResourceUsageUrl[] = "http://tests/ResourceUsageTest";
+
+class ResourceUsageTestHandler;
+
+// Callback that forwards the result to the test handler.
+class ResourceUsageCallback : public CefResourceUsageCallback {
+ public:
+  explicit ResourceUsageCallback(ResourceUsageTestHandler* handler)
+      : handler_(handler) {
+  }
+
+  virtual void OnResourceUsage(CefRefPtr<CefBrowserHost> browser_host,
+                               const CefResourceUsage& usage) OVERRIDE;
+
+ private:
+  CefRefPtr<ResourceUsageTestHandler> handler_;
+
+  IMPLEMENT_REFCOUNTING(ResourceUsageCallback);
+};
+
+// Size of the upload sent to the test HTTP server.
+const size_t kPostDataSize = 1000;
+
+class ResourceUsageTestHandler : public TestHandler {
+ public:
+  // If |server| is non-NULL the page is loaded from it with a POST request.
+  // Otherwise the page is provided in-process by a CefResourceHandler.
+  ResourceUsageTestHandler(const std::string& content, TestHttpServer* server)
+      : content_(content),
+        server_(server) {
+  }
+
+  virtual void RunTest() OVERRIDE {
+    if (server_) {
+      CreateBrowser("about:blank");
+    } else {
+      AddResource(kResourceUsageUrl, content_, "text/html");
+      CreateBrowser(kResourceUsageUrl);
+    }
+  }
+
+  virtual void OnAfterCreated(CefRefPtr<CefBrowser> browser) OVERRIDE {
+    TestHandler::OnAfterCreated(browser);
+
+    if (!server_)
+      return;
+
+    // Send the request headers and an upload over the network.
+    CefRefPtr<CefRequest> request = CefRequest::Create();
+    request->SetURL(server_->GetURL("/post"));
+    request->SetMethod("POST");
+
+    const std::string data(kPostDataSize, 'x');
+    CefRefPtr<CefPostDataElement> element = CefPostDataElement::Create();
+    element->SetToBytes(data.size(), data.data());
+    CefRefPtr<CefPostData> post_data = CefPostData::Create();
+    post_data->AddElement(element);
+    request->SetPostData(post_data);
+
+    browser->GetMainFrame()->LoadRequest(request);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+    if (server_ && frame->GetURL().ToString() != server_->GetURL("/post"))
+      return;
+
+    browser->GetHost()->GetResourceUsage(new ResourceUsageCallback(this));
+  }
+
+  void OnResourceUsage(CefRefPtr<CefBrowserHost> browser_host,
+                       const CefResourceUsage& usage) {
+    EXPECT_TRUE(CefCurrentlyOn(TID_UI));
+    EXPECT_FALSE(got_resource_usage_);
+    EXPECT_EQ(GetBrowser()->GetIdentifier(),
+              browser_host->GetBrowser()->GetIdentifier());
+
+    got_resource_usage_.yes();
+    usage_ = usage;
+
+    DestroyTest();
+  }
+
+  const std::string content_;
+  TestHttpServer* server_;
+  TrackCallback got_resource_usage_;
+  CefResourceUsage usage_;
+};
+
+void ResourceUsageCallback::OnResourceUsage(
+    CefRefPtr<CefBrowserHost> browser_host,
+    const CefResourceUsage& usage) {
+  handler_->OnResourceUsage(browser_host, usage);
+}
+
+// Run some script so that the V8 heap and CPU time are not empty.
+const char kResourceUsageContent[] =
+    "<html><head>\n"
+    "<script>\n"
+    "var objects = [];\n"
+    "for (var i = 0; i < 10000; ++i)\n"
+    "  objects.push({value: 'object ' + i});\n"
+    "</script>\n"
+    "</head><body>TEST</body></html>";
+
+// Verify the values that are measured for the render process.
+void VerifyProcessUsage(const CefResourceUsage& usage) {
+  EXPECT_GT(usage.cpu_time_us, 0);
+  EXPECT_GT(usage.v8_heap_used_bytes, 0);
+  EXPECT_GE(usage.v8_heap_total_bytes, usage.v8_heap_used_bytes);
+
+  // The live V8 heap objects are private to the render process.
+  EXPECT_GE(usage.private_memory_bytes, usage.v8_heap_used_bytes);
+}
+
+}  // namespace
+
+// Test that resource usage is reported for a browser that loaded a page from
+// an in-process handler. Nothing is sent or received over the network.
+TEST(ResourceUsageTest, GetResourceUsage) {
+  CefRefPtr<ResourceUsageTestHandler> handler =
+      new ResourceUsageTestHandler(kResourceUsageContent, NULL);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(handler->got_resource_usage_);
+
+  const CefResourceUsage& usage = handler->usage_;
+  VerifyProcessUsage(usage);
+  EXPECT_EQ(0, usage.network_bytes_received);
+  EXPECT_EQ(0, usage.network_bytes_sent);
+}
+
+// Test that network bytes are counted for a page that is uploaded to and
+// loaded from an HTTP server.
+TEST(ResourceUsageTest, GetResourceUsageNetwork) {
+  TestHttpServer server(kResourceUsageContent);
+  ASSERT_TRUE(server.Start());
+
+  CefRefPtr<ResourceUsageTestHandler> handler =
+      new ResourceUsageTestHandler(kResourceUsageContent, &server);
+  handler->ExecuteTest();
+
+  server.Stop();
+
+  EXPECT_TRUE(handler->got_resource_usage_);
+
+  const CefResourceUsage& usage = handler->usage_;
+  VerifyProcessUsage(usage);
+
+  // The response body was received over the network.
+  EXPECT_GE(usage.network_bytes_received,
+            static_cast<int64>(strlen(kResourceUsageContent)));
+
+  // The request headers and the upload were sent. The request line is not
+  // counted so the total is less than what the server received.
+  EXPECT_GT(usage.network_bytes_sent, static_cast<int64>(kPostDataSize));
+  EXPECT_LT(usage.network_bytes_sent, server.bytes_received());
+}
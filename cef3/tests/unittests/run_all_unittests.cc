@@ -13,8 +13,20 @@
 // Include after base/bind.h to avoid name collisions with cef_tuple.h.
 #include "include/cef_runnable.h"
 
+// Implemented in message_loop_unittest.cc.
+void RunExternalMessagePump();
+void QuitExternalMessagePump();
+
 namespace {
 
+// Quit the CEF message loop.
+void QuitMessageLoop() {
+  if (CefTestSuite::UseExternalMessagePump())
+    QuitExternalMessagePump();
+  else
+    CefQuitMessageLoop();
+}
+
 // Thread used to run the test suite.
 class CefTestThread : public base::Thread {
  public:
@@ -28,7 +40,7 @@ class CefTestThread : public base::Thread {
     retval_ = test_suite_->Run();
 
     // Quit the CEF message loop.
-    CefPostTask(TID_UI, NewCefRunnableFunction(CefQuitMessageLoop));
+    CefPostTask(TID_UI, NewCefRunnableFunction(QuitMessageLoop));
   }
 
   int retval() { return retval_; }
@@ -97,7 +109,10 @@ int main(int argc, char* argv[]) {
     CefPostTask(TID_UI, NewCefRunnableFunction(RunTests, thread.get()));
 
     // Run the CEF message loop.
-    CefRunMessageLoop();
+    if (CefTestSuite::UseExternalMessagePump())
+      RunExternalMessagePump();
+    else
+      CefRunMessageLoop();
 
     // The test suite has completed.
     retval = thread->retval();
@@ -331,6 +331,21 @@ void RegisterTestScheme(const std::string& scheme, const std::string& domain) {
   WaitForIOThread();
 }
 
+void GetHitCountOnIOThread(const std::string& scheme,
+                           const std::string& domain,
+                           int64* count) {
+  *count = CefGetSchemeHandlerFactoryHitCount(scheme, domain);
+}
+
+int64 GetTestSchemeHitCount(const std::string& scheme,
+                            const std::string& domain) {
+  int64 count = 0;
+  CefPostTask(TID_IO,
+      NewCefRunnableFunction(&GetHitCountOnIOThread, scheme, domain, &count));
+  WaitForIOThread();
+  return count;
+}
+
 void ClearTestSchemes() {
   EXPECT_TRUE(CefClearSchemeHandlerFactories());
   WaitForIOThread();
@@ -605,6 +620,52 @@ TEST(SchemeHandlerTest, CustomStandardDomainNotHandled) {
   ClearTestSchemes();
 }
 
+// Test that a custom standard scheme registered for a wildcard domain matches
+// subdomains.
+TEST(SchemeHandlerTest, CustomStandardWildcardDomain) {
+  RegisterTestScheme("customstd", "*.test");
+  g_TestResults.url = "customstd://sub.domain.test/run.html";
+  g_TestResults.html =
+      "<html><head></head><body><h1>Success!</h1></body></html>";
+  g_TestResults.status_code = 200;
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_TRUE(g_TestResults.got_request);
+  EXPECT_TRUE(g_TestResults.got_read);
+  EXPECT_TRUE(g_TestResults.got_output);
+
+  EXPECT_GT(GetTestSchemeHitCount("customstd", "*.test"), 0);
+  EXPECT_EQ(-1, GetTestSchemeHitCount("customstd", "test"));
+
+  // Registering the factory again resets the hit count.
+  EXPECT_TRUE(CefRegisterSchemeHandlerFactory("customstd", "*.test",
+      new ClientSchemeHandlerFactory(&g_TestResults)));
+  WaitForIOThread();
+  EXPECT_EQ(0, GetTestSchemeHitCount("customstd", "*.test"));
+
+  ClearTestSchemes();
+
+  EXPECT_EQ(-1, GetTestSchemeHitCount("customstd", "*.test"));
+}
+
+// Test that a custom standard scheme registered for a wildcard domain does not
+// match the domain itself.
+TEST(SchemeHandlerTest, CustomStandardWildcardDomainNotHandled) {
+  RegisterTestScheme("customstd", "*.test");
+  g_TestResults.url = "customstd://test/run.html";
+
+  CefRefPtr<TestSchemeHandler> handler = new TestSchemeHandler(&g_TestResults);
+  handler->ExecuteTest();
+
+  EXPECT_FALSE(g_TestResults.got_request);
+  EXPECT_FALSE(g_TestResults.got_read);
+  EXPECT_FALSE(g_TestResults.got_output);
+
+  ClearTestSchemes();
+}
+
 // Test that a custom standard scheme can return no response.
 TEST(SchemeHandlerTest, CustomStandardNoResponse) {
   RegisterTestScheme("customstd", "test");
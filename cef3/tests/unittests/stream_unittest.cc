@@ -2,6 +2,7 @@
 // reserved. Use of this source code is governed by a BSD-style license that
 // can be found in the LICENSE file.
 
+#include <vector>
 #include "include/cef_stream.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -154,6 +155,7 @@ TEST(StreamTest, WriteFile) {
 }
 
 bool g_ReadHandlerTesterDeleted = false;
+int g_ReadHandlerTesterDeleteCt = 0;
 
 class ReadHandlerTester : public CefReadHandler {
  public:
@@ -170,6 +172,7 @@ class ReadHandlerTester : public CefReadHandler {
   }
   virtual ~ReadHandlerTester() {
     g_ReadHandlerTesterDeleted = true;
+    g_ReadHandlerTesterDeleteCt++;
   }
 
   virtual size_t Read(void* ptr, size_t size, size_t n) {
@@ -258,6 +261,49 @@ TEST(StreamTest, ReadHandler) {
   ASSERT_TRUE(g_ReadHandlerTesterDeleted);
 }
 
+// Test that passing the same handler across the DLL boundary repeatedly shares
+// a single wrapper that holds one reference to the handler.
+TEST(StreamTest, ReadHandlerRefCount) {
+  const int kStreamCount = 10;
+  g_ReadHandlerTesterDeleteCt = 0;
+
+  CefRefPtr<ReadHandlerTester> handler = new ReadHandlerTester();
+  EXPECT_EQ(1, handler->GetRefCt());
+
+  std::vector<CefRefPtr<CefStreamReader> > streams;
+  for (int i = 0; i < kStreamCount; ++i) {
+    CefRefPtr<CefStreamReader> stream(
+        CefStreamReader::CreateForHandler(handler.get()));
+    ASSERT_TRUE(stream.get() != NULL);
+    streams.push_back(stream);
+
+    // Only the handler wrapper references the handler on the other side.
+    EXPECT_EQ(2, handler->GetRefCt());
+  }
+
+  // Every stream calls through to the same handler.
+  for (int i = 0; i < kStreamCount; ++i)
+    EXPECT_EQ(10, streams[i]->Tell());
+  EXPECT_EQ(2, handler->GetRefCt());
+
+  // Releasing the streams destroys the wrapper and its reference.
+  streams.clear();
+  EXPECT_EQ(1, handler->GetRefCt());
+  EXPECT_EQ(0, g_ReadHandlerTesterDeleteCt);
+
+  // Passing the handler again creates a new wrapper.
+  CefRefPtr<CefStreamReader> stream(
+      CefStreamReader::CreateForHandler(handler.get()));
+  ASSERT_TRUE(stream.get() != NULL);
+  EXPECT_EQ(2, handler->GetRefCt());
+  stream = NULL;
+  EXPECT_EQ(1, handler->GetRefCt());
+
+  // The handler is deleted exactly once.
+  handler = NULL;
+  EXPECT_EQ(1, g_ReadHandlerTesterDeleteCt);
+}
+
 bool g_WriteHandlerTesterDeleted = false;
 
 class WriteHandlerTester : public CefWriteHandler {
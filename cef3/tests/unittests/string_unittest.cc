@@ -3,13 +3,27 @@
 // can be found in the LICENSE file.
 
 #include <map>
+#include <string>
 #include <vector>
 #include "include/internal/cef_string.h"
 #include "include/internal/cef_string_list.h"
 #include "include/internal/cef_string_map.h"
 #include "include/internal/cef_string_multimap.h"
+#include "base/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
+namespace {
+
+// Returns an ASCII string of |length| characters.
+std::string GetASCIIString(size_t length) {
+  std::string str;
+  for (size_t i = 0; i < length; ++i)
+    str.push_back(static_cast<char>('a' + (i % 26)));
+  return str;
+}
+
+}  // namespace
+
 // Test UTF8 strings.
 TEST(StringTest, UTF8) {
   CefStringUTF8 str1("Test String");
@@ -338,3 +352,202 @@ TEST(StringTest, Multimap) {
 
   cef_string_multimap_free(mapPtr);
 }
+
+// Test that string maps keep insertion order and unique keys.
+TEST(StringTest, MapOrder) {
+  cef_string_map_t mapPtr = cef_string_map_alloc();
+
+  CefString key1("Key B"), key2("Key A"), key3("key b");
+  CefString val1("String 1"), val2("String 2");
+  cef_string_map_append(mapPtr, key1.GetStruct(), val1.GetStruct());
+  cef_string_map_append(mapPtr, key2.GetStruct(), val1.GetStruct());
+  // Duplicate keys are ignored.
+  cef_string_map_append(mapPtr, key1.GetStruct(), val2.GetStruct());
+  // Keys are case-sensitive by default.
+  cef_string_map_append(mapPtr, key3.GetStruct(), val2.GetStruct());
+  ASSERT_EQ(cef_string_map_size(mapPtr), 3);
+
+  CefString str;
+  ASSERT_TRUE(cef_string_map_key(mapPtr, 0, str.GetWritableStruct()));
+  ASSERT_EQ(str, "Key B");
+  ASSERT_TRUE(cef_string_map_key(mapPtr, 1, str.GetWritableStruct()));
+  ASSERT_EQ(str, "Key A");
+  ASSERT_TRUE(cef_string_map_key(mapPtr, 2, str.GetWritableStruct()));
+  ASSERT_EQ(str, "key b");
+
+  ASSERT_TRUE(cef_string_map_find(mapPtr, key1.GetStruct(),
+                                  str.GetWritableStruct()));
+  ASSERT_EQ(str, "String 1");
+
+  cef_string_map_free(mapPtr);
+}
+
+// Test case-insensitive string multimaps.
+TEST(StringTest, MultimapCaseInsensitive) {
+  cef_string_multimap_t mapPtr = cef_string_multimap_alloc_case_insensitive();
+
+  CefString key1("Set-Cookie"), key2("Content-Type"), key3("set-cookie");
+  CefString val1("a=1"), val2("text/html"), val3("b=2");
+  cef_string_multimap_append(mapPtr, key1.GetStruct(), val1.GetStruct());
+  cef_string_multimap_append(mapPtr, key2.GetStruct(), val2.GetStruct());
+  cef_string_multimap_append(mapPtr, key3.GetStruct(), val3.GetStruct());
+  ASSERT_EQ(cef_string_multimap_size(mapPtr), 3);
+
+  CefString key("SET-COOKIE");
+  ASSERT_EQ(cef_string_multimap_find_count(mapPtr, key.GetStruct()), 2);
+
+  CefString str;
+  ASSERT_TRUE(cef_string_multimap_enumerate(mapPtr, key.GetStruct(), 0,
+                                            str.GetWritableStruct()));
+  ASSERT_EQ(str, "a=1");
+  ASSERT_TRUE(cef_string_multimap_enumerate(mapPtr, key.GetStruct(), 1,
+                                            str.GetWritableStruct()));
+  ASSERT_EQ(str, "b=2");
+
+  // Keys retain their original case.
+  ASSERT_TRUE(cef_string_multimap_key(mapPtr, 2, str.GetWritableStruct()));
+  ASSERT_EQ(str, "set-cookie");
+  ASSERT_TRUE(cef_string_multimap_value(mapPtr, 1, str.GetWritableStruct()));
+  ASSERT_EQ(str, "text/html");
+
+  cef_string_multimap_free(mapPtr);
+}
+
+// Test that copies share data allocated by CEF and copy other data.
+TEST(StringTest, Share) {
+  CefString str1("shared value");
+  CefString str2(str1);
+  EXPECT_EQ(str1.c_str(), str2.c_str());
+
+  CefString str3;
+  str3 = str2;
+  EXPECT_EQ(str1.c_str(), str3.c_str());
+
+  // Shared data remains valid after the other strings are cleared.
+  str1.clear();
+  str2.ClearAndFree();
+  EXPECT_EQ(str3, "shared value");
+
+  CefString str4("other value");
+  str3.swap(str4);
+  EXPECT_EQ(str3, "other value");
+  EXPECT_EQ(str4, "shared value");
+
+  // Referenced data is copied.
+  CefString str5(str4.c_str(), str4.length(), false);
+  CefString str6(str5);
+  EXPECT_NE(str5.c_str(), str6.c_str());
+  EXPECT_EQ(str6, "shared value");
+}
+
+// Test conversion of ASCII and non-ASCII strings of varying lengths. Lengths
+// cover the vectorized blocks and the remaining characters.
+TEST(StringTest, Convert) {
+  for (size_t length = 0; length < 40; ++length) {
+    const std::string& ascii = GetASCIIString(length);
+
+    CefStringUTF16 utf16;
+    ASSERT_TRUE(cef_string_utf8_to_utf16(ascii.c_str(), ascii.length(),
+                                         utf16.GetWritableStruct()));
+    ASSERT_EQ(length, utf16.length());
+    ASSERT_EQ(ascii, utf16.ToString());
+
+    CefStringUTF8 utf8;
+    ASSERT_TRUE(cef_string_utf16_to_utf8(utf16.c_str(), utf16.length(),
+                                         utf8.GetWritableStruct()));
+    ASSERT_EQ(ascii, utf8.ToString());
+
+    CefStringWide wide;
+    ASSERT_TRUE(cef_string_utf16_to_wide(utf16.c_str(), utf16.length(),
+                                         wide.GetWritableStruct()));
+    ASSERT_EQ(ascii, wide.ToString());
+    ASSERT_TRUE(cef_string_wide_to_utf16(wide.c_str(), wide.length(),
+                                         utf16.GetWritableStruct()));
+    ASSERT_EQ(ascii, utf16.ToString());
+
+    ASSERT_TRUE(cef_string_ascii_to_utf16(ascii.c_str(), ascii.length(),
+                                          utf16.GetWritableStruct()));
+    ASSERT_EQ(ascii, utf16.ToString());
+
+    // Replace a single character with a 2-byte UTF8 sequence ("\xc3\xa9" is
+    // U+00E9) at each position.
+    for (size_t pos = 0; pos < length; ++pos) {
+      std::string mixed = ascii.substr(0, pos) + "\xc3\xa9" +
+                          ascii.substr(pos + 1);
+      ASSERT_TRUE(cef_string_utf8_to_utf16(mixed.c_str(), mixed.length(),
+                                           utf16.GetWritableStruct()));
+      ASSERT_EQ(length, utf16.length());
+      ASSERT_EQ(0xE9, utf16.c_str()[pos]);
+
+      ASSERT_TRUE(cef_string_utf16_to_utf8(utf16.c_str(), utf16.length(),
+                                           utf8.GetWritableStruct()));
+      ASSERT_EQ(mixed, utf8.ToString());
+
+      ASSERT_TRUE(cef_string_utf16_to_wide(utf16.c_str(), utf16.length(),
+                                           wide.GetWritableStruct()));
+      ASSERT_EQ(length, wide.length());
+      ASSERT_EQ(0xE9, static_cast<int>(wide.c_str()[pos]));
+      ASSERT_TRUE(cef_string_wide_to_utf8(wide.c_str(), wide.length(),
+                                          utf8.GetWritableStruct()));
+      ASSERT_EQ(mixed, utf8.ToString());
+    }
+  }
+
+  // Invalid UTF8 is still reported as an error.
+  CefStringUTF16 utf16;
+  const std::string& invalid = GetASCIIString(20) + "\xff";
+  ASSERT_FALSE(cef_string_utf8_to_utf16(invalid.c_str(), invalid.length(),
+                                        utf16.GetWritableStruct()));
+}
+
+// Measure the conversion speed of long strings that are ASCII or have a single
+// non-ASCII character at the end. Results are written to the XML output for
+// comparison between builds.
+TEST(StringTest, ConvertPerf) {
+  const int kIterations = 10000;
+  const std::string& ascii = GetASCIIString(1024);
+  const std::string& mixed = ascii + "\xc3\xa9";
+
+  CefStringUTF16 utf16;
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int i = 0; i < kIterations; ++i) {
+    cef_string_utf8_to_utf16(ascii.c_str(), ascii.length(),
+                             utf16.GetWritableStruct());
+  }
+  const base::TimeDelta ascii_utf8_to_utf16 = base::TimeTicks::Now() - start;
+  ASSERT_EQ(ascii.length(), utf16.length());
+
+  CefStringUTF8 utf8;
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < kIterations; ++i) {
+    cef_string_utf16_to_utf8(utf16.c_str(), utf16.length(),
+                             utf8.GetWritableStruct());
+  }
+  const base::TimeDelta ascii_utf16_to_utf8 = base::TimeTicks::Now() - start;
+  ASSERT_EQ(ascii, utf8.ToString());
+
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < kIterations; ++i) {
+    cef_string_utf8_to_utf16(mixed.c_str(), mixed.length(),
+                             utf16.GetWritableStruct());
+  }
+  const base::TimeDelta mixed_utf8_to_utf16 = base::TimeTicks::Now() - start;
+  ASSERT_EQ(ascii.length() + 1, utf16.length());
+
+  start = base::TimeTicks::Now();
+  for (int i = 0; i < kIterations; ++i) {
+    cef_string_utf16_to_utf8(utf16.c_str(), utf16.length(),
+                             utf8.GetWritableStruct());
+  }
+  const base::TimeDelta mixed_utf16_to_utf8 = base::TimeTicks::Now() - start;
+  ASSERT_EQ(mixed, utf8.ToString());
+
+  RecordProperty("ascii_utf8_to_utf16_us",
+      static_cast<int>(ascii_utf8_to_utf16.InMicroseconds()));
+  RecordProperty("ascii_utf16_to_utf8_us",
+      static_cast<int>(ascii_utf16_to_utf8.InMicroseconds()));
+  RecordProperty("mixed_utf8_to_utf16_us",
+      static_cast<int>(mixed_utf8_to_utf16.InMicroseconds()));
+  RecordProperty("mixed_utf16_to_utf8_us",
+      static_cast<int>(mixed_utf16_to_utf8.InMicroseconds()));
+}
@@ -0,0 +1,393 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <utility>
+#include <vector>
+#include "include/cef_task.h"
+#include "base/basictypes.h"
+#include "base/memory/scoped_vector.h"
+#include "base/synchronization/lock.h"
+#include "base/synchronization/waitable_event.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+struct TaskFunctionState {
+  TaskFunctionState()
+      : event(false, false),
+        thread_id(TID_UI),
+        executed(false),
+        released(false) {
+  }
+
+  base::WaitableEvent event;
+  CefThreadId thread_id;
+  bool executed;
+  bool released;
+};
+
+void CEF_CALLBACK TaskFunction(void* context) {
+  TaskFunctionState* state = static_cast<TaskFunctionState*>(context);
+  EXPECT_TRUE(CefCurrentlyOn(state->thread_id));
+  state->executed = true;
+  state->event.Signal();
+}
+
+void CEF_CALLBACK ReleaseFunction(void* context) {
+  TaskFunctionState* state = static_cast<TaskFunctionState*>(context);
+  state->released = true;
+}
+
+// Task that records the order of execution.
+class OrderTask : public CefTask {
+ public:
+  OrderTask(int index, std::vector<int>* order, base::WaitableEvent* event)
+      : index_(index),
+        order_(order),
+        event_(event) {
+  }
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    EXPECT_EQ(TID_IO, threadId);
+    EXPECT_TRUE(CefCurrentlyOn(TID_IO));
+    order_->push_back(index_);
+    if (event_)
+      event_->Signal();
+  }
+
+ private:
+  int index_;
+  std::vector<int>* order_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(OrderTask);
+};
+
+// Task that signals |event| after running on the worker pool.
+class WorkerTask : public CefTask {
+ public:
+  explicit WorkerTask(base::WaitableEvent* event)
+      : event_(event) {
+  }
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    EXPECT_EQ(TID_WORKER, threadId);
+    EXPECT_TRUE(CefCurrentlyOn(TID_WORKER));
+    EXPECT_FALSE(CefCurrentlyOn(TID_IO));
+    event_->Signal();
+  }
+
+ private:
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(WorkerTask);
+};
+
+// Worker task that occupies a worker thread until |release| is signaled.
+class BlockingWorkerTask : public CefTask {
+ public:
+  BlockingWorkerTask(base::WaitableEvent* started,
+                     base::WaitableEvent* release)
+      : started_(started),
+        release_(release) {
+  }
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    started_->Signal();
+    release_->Wait();
+  }
+
+ private:
+  base::WaitableEvent* started_;
+  base::WaitableEvent* release_;
+
+  IMPLEMENT_REFCOUNTING(BlockingWorkerTask);
+};
+
+// Worker task that records the priority it was posted with.
+class PriorityWorkerTask : public CefTask {
+ public:
+  PriorityWorkerTask(CefWorkerPriority priority,
+                     base::Lock* lock,
+                     std::vector<CefWorkerPriority>* order,
+                     base::WaitableEvent* event)
+      : priority_(priority),
+        lock_(lock),
+        order_(order),
+        event_(event) {
+  }
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_WORKER));
+    {
+      base::AutoLock lock_scope(*lock_);
+      order_->push_back(priority_);
+    }
+    if (event_)
+      event_->Signal();
+  }
+
+ private:
+  CefWorkerPriority priority_;
+  base::Lock* lock_;
+  std::vector<CefWorkerPriority>* order_;
+  base::WaitableEvent* event_;
+
+  IMPLEMENT_REFCOUNTING(PriorityWorkerTask);
+};
+
+// State shared by the tasks of the concurrent batch test.
+struct BatchState {
+  BatchState()
+      : start_event(true, false),
+        done_event(false, false),
+        expected_count(0) {
+  }
+
+  // Signaled when the producers should start posting.
+  base::WaitableEvent start_event;
+  // Signaled when all tasks have executed.
+  base::WaitableEvent done_event;
+
+  size_t expected_count;
+
+  // Batch and index of each task in the order they executed. Only accessed on
+  // TID_DB.
+  std::vector<std::pair<int, int> > order;
+};
+
+// Task that records the batch it belongs to.
+class BatchTask : public CefTask {
+ public:
+  BatchTask(int batch, int index, BatchState* state)
+      : batch_(batch),
+        index_(index),
+        state_(state) {
+  }
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_DB));
+    state_->order.push_back(std::make_pair(batch_, index_));
+    if (state_->order.size() == state_->expected_count)
+      state_->done_event.Signal();
+  }
+
+ private:
+  int batch_;
+  int index_;
+  BatchState* state_;
+
+  IMPLEMENT_REFCOUNTING(BatchTask);
+};
+
+const int kBatchProducerCount = 4;
+const int kBatchesPerProducer = 20;
+const int kTasksPerBatch = 50;
+
+// Post the batches for |producer| to TID_DB once the test starts.
+void PostBatches(int producer, BatchState* state) {
+  state->start_event.Wait();
+
+  for (int i = 0; i < kBatchesPerProducer; ++i) {
+    const int batch = producer * kBatchesPerProducer + i;
+    CefTaskList tasks;
+    for (int j = 0; j < kTasksPerBatch; ++j)
+      tasks.push_back(new BatchTask(batch, j, state));
+    EXPECT_TRUE(CefPostTaskBatch(TID_DB, tasks));
+  }
+}
+
+// Task that posts batches from another thread.
+class BatchProducerTask : public CefTask {
+ public:
+  BatchProducerTask(int producer, BatchState* state)
+      : producer_(producer),
+        state_(state) {
+  }
+
+  virtual void Execute(CefThreadId threadId) OVERRIDE {
+    PostBatches(producer_, state_);
+  }
+
+ private:
+  int producer_;
+  BatchState* state_;
+
+  IMPLEMENT_REFCOUNTING(BatchProducerTask);
+};
+
+}  // namespace
+
+// Test that a function and context can be posted without a task object.
+TEST(TaskTest, PostTaskFunction) {
+  TaskFunctionState state;
+  state.thread_id = TID_FILE;
+  EXPECT_TRUE(cef_post_task_function(state.thread_id, TaskFunction, NULL,
+                                     &state));
+  state.event.Wait();
+  EXPECT_TRUE(state.executed);
+}
+
+// Test that the release function is not called for a task that executes.
+TEST(TaskTest, PostTaskFunctionWithRelease) {
+  TaskFunctionState state;
+  state.thread_id = TID_FILE;
+  EXPECT_TRUE(cef_post_task_function(state.thread_id, TaskFunction,
+                                     ReleaseFunction, &state));
+  state.event.Wait();
+  EXPECT_TRUE(state.executed);
+  EXPECT_FALSE(state.released);
+}
+
+// Test that a function and context can be posted with a delay.
+TEST(TaskTest, PostDelayedTaskFunction) {
+  TaskFunctionState state;
+  state.thread_id = TID_IO;
+  EXPECT_TRUE(cef_post_delayed_task_function(state.thread_id, TaskFunction,
+                                             ReleaseFunction, &state, 10));
+  state.event.Wait();
+  EXPECT_TRUE(state.executed);
+  EXPECT_FALSE(state.released);
+}
+
+// Test that tasks posted individually and in batches execute in order.
+TEST(TaskTest, PostTaskBatch) {
+  const int kTaskCount = 100;
+  std::vector<int> order;
+  base::WaitableEvent event(false, false);
+
+  CefTaskList tasks;
+  for (int i = 0; i < kTaskCount; ++i) {
+    if (i % 10 == 0) {
+      EXPECT_TRUE(CefPostTaskBatch(TID_IO, tasks));
+      tasks.clear();
+      EXPECT_TRUE(CefPostTask(TID_IO, new OrderTask(i, &order, NULL)));
+    } else {
+      tasks.push_back(new OrderTask(i, &order,
+                                    i == kTaskCount - 1 ? &event : NULL));
+    }
+  }
+  EXPECT_TRUE(CefPostTaskBatch(TID_IO, tasks));
+  event.Wait();
+
+  ASSERT_EQ(static_cast<size_t>(kTaskCount), order.size());
+  for (int i = 0; i < kTaskCount; ++i)
+    EXPECT_EQ(i, order[i]);
+}
+
+// Test that batches posted from different threads at the same time execute
+// without being interleaved.
+TEST(TaskTest, PostTaskBatchConcurrent) {
+  BatchState state;
+  state.expected_count =
+      kBatchProducerCount * kBatchesPerProducer * kTasksPerBatch;
+
+  // The last producer runs on the current thread.
+  const CefThreadId kProducerThreads[] = {TID_IO, TID_FILE, TID_CACHE};
+  COMPILE_ASSERT(arraysize(kProducerThreads) == kBatchProducerCount - 1,
+                 producer_thread_count_mismatch);
+  for (int i = 0; i < kBatchProducerCount - 1; ++i) {
+    EXPECT_TRUE(CefPostTask(kProducerThreads[i],
+                            new BatchProducerTask(i, &state)));
+  }
+
+  state.start_event.Signal();
+  PostBatches(kBatchProducerCount - 1, &state);
+
+  state.done_event.Wait();
+
+  ASSERT_EQ(state.expected_count, state.order.size());
+  std::vector<int> next_batch(kBatchProducerCount, 0);
+  for (size_t i = 0; i < state.order.size(); i += kTasksPerBatch) {
+    // Each batch executes contiguously and in order.
+    const int batch = state.order[i].first;
+    for (int j = 0; j < kTasksPerBatch; ++j) {
+      ASSERT_EQ(batch, state.order[i + j].first);
+      ASSERT_EQ(j, state.order[i + j].second);
+    }
+
+    // Batches from the same producer execute in the order they were posted.
+    const int producer = batch / kBatchesPerProducer;
+    EXPECT_EQ(next_batch[producer], batch % kBatchesPerProducer);
+    next_batch[producer] = batch % kBatchesPerProducer + 1;
+  }
+}
+
+// Test that tasks can be posted to the worker pool with each priority.
+TEST(TaskTest, PostWorkerTask) {
+  EXPECT_GT(CefGetWorkerThreadCount(), 0);
+  EXPECT_FALSE(CefCurrentlyOn(TID_WORKER));
+
+  base::WaitableEvent event(false, false);
+  EXPECT_TRUE(CefPostTask(TID_WORKER, new WorkerTask(&event)));
+  event.Wait();
+
+  EXPECT_TRUE(CefPostWorkerTask(WORKER_PRIORITY_HIGH, new WorkerTask(&event)));
+  event.Wait();
+  EXPECT_TRUE(CefPostWorkerTask(WORKER_PRIORITY_LOW, new WorkerTask(&event)));
+  event.Wait();
+  EXPECT_TRUE(CefPostDelayedTask(TID_WORKER, new WorkerTask(&event), 10));
+  event.Wait();
+
+  TaskFunctionState state;
+  state.thread_id = TID_WORKER;
+  EXPECT_TRUE(cef_post_task_function(state.thread_id, TaskFunction, NULL,
+                                     &state));
+  state.event.Wait();
+  EXPECT_TRUE(state.executed);
+
+  // All tasks have been taken by a worker thread.
+  EXPECT_EQ(0, CefGetWorkerQueueDepth(WORKER_PRIORITY_HIGH));
+  EXPECT_EQ(0, CefGetWorkerQueueDepth(WORKER_PRIORITY_NORMAL));
+  EXPECT_EQ(0, CefGetWorkerQueueDepth(WORKER_PRIORITY_LOW));
+}
+
+// Test that queued worker tasks run in priority order regardless of the order
+// in which they were posted.
+TEST(TaskTest, PostWorkerTaskPriority) {
+  const int kThreadCount = CefGetWorkerThreadCount();
+  ASSERT_GT(kThreadCount, 0);
+
+  // Occupy every worker thread so that the following tasks stay queued.
+  ScopedVector<base::WaitableEvent> started;
+  ScopedVector<base::WaitableEvent> release;
+  for (int i = 0; i < kThreadCount; ++i) {
+    started.push_back(new base::WaitableEvent(false, false));
+    release.push_back(new base::WaitableEvent(false, false));
+    EXPECT_TRUE(CefPostWorkerTask(WORKER_PRIORITY_HIGH,
+        new BlockingWorkerTask(started[i], release[i])));
+  }
+  for (int i = 0; i < kThreadCount; ++i)
+    started[i]->Wait();
+
+  base::Lock lock;
+  std::vector<CefWorkerPriority> order;
+  base::WaitableEvent done(false, false);
+
+  // Post from lowest to highest priority. The lowest priority task is expected
+  // to run last so it signals completion.
+  EXPECT_TRUE(CefPostWorkerTask(WORKER_PRIORITY_LOW,
+      new PriorityWorkerTask(WORKER_PRIORITY_LOW, &lock, &order, &done)));
+  EXPECT_TRUE(CefPostWorkerTask(WORKER_PRIORITY_NORMAL,
+      new PriorityWorkerTask(WORKER_PRIORITY_NORMAL, &lock, &order, NULL)));
+  EXPECT_TRUE(CefPostWorkerTask(WORKER_PRIORITY_HIGH,
+      new PriorityWorkerTask(WORKER_PRIORITY_HIGH, &lock, &order, NULL)));
+
+  EXPECT_EQ(1, CefGetWorkerQueueDepth(WORKER_PRIORITY_HIGH));
+  EXPECT_EQ(1, CefGetWorkerQueueDepth(WORKER_PRIORITY_NORMAL));
+  EXPECT_EQ(1, CefGetWorkerQueueDepth(WORKER_PRIORITY_LOW));
+
+  // Free a single worker thread. It runs the queued tasks one at a time.
+  release[0]->Signal();
+  done.Wait();
+
+  for (int i = 1; i < kThreadCount; ++i)
+    release[i]->Signal();
+
+  base::AutoLock lock_scope(lock);
+  ASSERT_EQ(3U, order.size());
+  EXPECT_EQ(WORKER_PRIORITY_HIGH, order[0]);
+  EXPECT_EQ(WORKER_PRIORITY_NORMAL, order[1]);
+  EXPECT_EQ(WORKER_PRIORITY_LOW, order[2]);
+}
@@ -95,8 +95,12 @@ void TestHandler::DestroyTest() {
 }
 
 void TestHandler::CreateBrowser(const CefString& url) {
+  CreateBrowser(url, CefBrowserSettings());
+}
+
+void TestHandler::CreateBrowser(const CefString& url,
+                                const CefBrowserSettings& settings) {
   CefWindowInfo windowInfo;
-  CefBrowserSettings settings;
 #if defined(OS_WIN)
   windowInfo.SetAsPopup(NULL, "CefUnitTest");
   windowInfo.style |= WS_VISIBLE;
@@ -92,6 +92,7 @@ class TestHandler : public CefClient,
   virtual void DestroyTest();
 
   void CreateBrowser(const CefString& url);
+  void CreateBrowser(const CefString& url, const CefBrowserSettings& settings);
 
   void AddResource(const std::string& url,
                    const std::string& content,
@@ -16,6 +16,13 @@
 #include "base/test/test_timeouts.h"
 #endif
 
+namespace {
+
+// Drive the CEF message loop with CefDoMessageLoopWork().
+const char kExternalMessagePump[] = "external-message-pump";
+
+}  // namespace
+
 CommandLine* CefTestSuite::commandline_ = NULL;
 
 CefTestSuite::CefTestSuite(int argc, char** argv)
@@ -41,7 +48,7 @@ void CefTestSuite::InitCommandLine(int argc, const char* const* argv) {
 
 // static
 void CefTestSuite::GetSettings(CefSettings& settings) {
-#if defined(OS_WIN)
+#if defined(OS_WIN) || defined(OS_LINUX)
   settings.multi_threaded_message_loop =
       commandline_->HasSwitch(cefclient::kMultiThreadedMessageLoop);
 #endif
@@ -58,6 +65,15 @@ void CefTestSuite::GetSettings(CefSettings& settings) {
   if (!other_javascript_flags.empty())
     javascript_flags += " " + other_javascript_flags;
   CefString(&settings.javascript_flags) = javascript_flags;
+
+  // Keep a spare render process so that the pool is exercised by all tests.
+  settings.spare_render_process_count = 1;
+}
+
+// static
+bool CefTestSuite::UseExternalMessagePump() {
+  DCHECK(commandline_);
+  return commandline_->HasSwitch(kExternalMessagePump);
 }
 
 // static
@@ -25,6 +25,11 @@ class CefTestSuite : public TestSuite {
   static void GetSettings(CefSettings& settings);
   static bool GetCachePath(std::string& path);
 
+  // Returns true if the CEF message loop should be driven by calling
+  // CefDoMessageLoopWork() when CefBrowserProcessHandler::
+  // OnScheduleMessagePumpWork() requests it.
+  static bool UseExternalMessagePump();
+
  protected:
 #if defined(OS_MACOSX)
   virtual void Initialize();
@@ -44,6 +44,8 @@ enum RequestTestMode {
   REQTEST_GET_NODATA,
   REQTEST_GET_ALLOWCOOKIES,
   REQTEST_GET_REDIRECT,
+  REQTEST_GET_RANGE,
+  REQTEST_GET_RANGE_NOSKIP,
   REQTEST_POST,
   REQTEST_POST_WITHPROGRESS,
   REQTEST_HEAD,
@@ -58,7 +60,8 @@ struct RequestRunSettings {
       expected_error_code(ERR_NONE),
       expect_send_cookie(false),
       expect_save_cookie(false),
-      expect_follow_redirect(true) {
+      expect_follow_redirect(true),
+      handler_skip_response(true) {
   }
 
   // Request that will be sent.
@@ -70,6 +73,11 @@ struct RequestRunSettings {
   // Optional response data that will be returned by the scheme handler.
   std::string response_data;
 
+  // If specified the response and response data that are expected to be
+  // received instead of |response| and |response_data|.
+  CefRefPtr<CefResponse> expected_response;
+  std::string expected_response_data;
+
   // If true upload progress notification will be expected.
   bool expect_upload_progress;
 
@@ -97,6 +105,9 @@ struct RequestRunSettings {
 
   // If true the redirect is expected to be followed.
   bool expect_follow_redirect;
+
+  // If true the scheme handler supports skipping response data.
+  bool handler_skip_response;
 };
 
 void SetUploadData(CefRefPtr<CefRequest> request,
@@ -233,6 +244,18 @@ class RequestSchemeHandler : public CefResourceHandler {
     response_length = settings_.response_data.length();
   }
 
+  virtual bool SkipResponse(int64 bytes_to_skip,
+                            int64& bytes_skipped) OVERRIDE {
+    EXPECT_TRUE(CefCurrentlyOn(TID_IO));
+
+    if (!settings_.handler_skip_response)
+      return false;
+
+    offset_ += static_cast<size_t>(bytes_to_skip);
+    bytes_skipped = bytes_to_skip;
+    return true;
+  }
+
   virtual bool ReadResponse(void* response_data_out,
                             int bytes_to_read,
                             int& bytes_read,
@@ -508,6 +531,9 @@ class RequestTestRunner {
     REGISTER_TEST(REQTEST_GET_ALLOWCOOKIES, SetupGetAllowCookiesTest,
                   GenericRunTest);
     REGISTER_TEST(REQTEST_GET_REDIRECT, SetupGetRedirectTest, GenericRunTest);
+    REGISTER_TEST(REQTEST_GET_RANGE, SetupGetRangeTest, GenericRunTest);
+    REGISTER_TEST(REQTEST_GET_RANGE_NOSKIP, SetupGetRangeNoSkipTest,
+                  GenericRunTest);
     REGISTER_TEST(REQTEST_POST, SetupPostTest, GenericRunTest);
     REGISTER_TEST(REQTEST_POST_WITHPROGRESS, SetupPostWithProgressTest,
                   GenericRunTest);
@@ -593,6 +619,40 @@ class RequestTestRunner {
     settings_.redirect_response->SetHeaderMap(headerMap);
   }
 
+  void SetupGetRangeTest() {
+    // Start with the normal get test.
+    SetupGetTest();
+
+    // Request a byte range.
+    CefRequest::HeaderMap requestHeaderMap;
+    requestHeaderMap.insert(std::make_pair("Range", "bytes=4-7"));
+    settings_.request->SetHeaderMap(requestHeaderMap);
+
+    settings_.expected_response = CefResponse::Create();
+    settings_.expected_response->SetMimeType("text/html");
+    settings_.expected_response->SetStatus(206);
+    settings_.expected_response->SetStatusText("Partial Content");
+
+    CefResponse::HeaderMap headerMap;
+    headerMap.insert(std::make_pair("Content-Range", "bytes 4-7/16"));
+    settings_.expected_response->SetHeaderMap(headerMap);
+
+    settings_.expected_response_data = "TEST";
+  }
+
+  void SetupGetRangeNoSkipTest() {
+    // Start with the normal get test.
+    SetupGetTest();
+
+    // Request a byte range that cannot be satisfied from a handler that does
+    // not support skipping. The complete response is expected.
+    CefRequest::HeaderMap requestHeaderMap;
+    requestHeaderMap.insert(std::make_pair("Range", "bytes=100-200"));
+    settings_.request->SetHeaderMap(requestHeaderMap);
+
+    settings_.handler_skip_response = false;
+  }
+
   void SetupPostTest() {
     settings_.request = CefRequest::Create();
     settings_.request->SetURL(MakeSchemeURL("PostTest.html"));
@@ -657,9 +717,16 @@ class RequestTestRunner {
           // A redirect response was sent but the redirect is not expected to be
           // followed.
           expected_response = runner_->settings_.redirect_response;
+        } else if (runner_->settings_.expected_response.get()) {
+          expected_response = runner_->settings_.expected_response;
         } else {
           expected_response = runner_->settings_.response;
         }
+
+        const std::string& expected_response_data =
+            runner_->settings_.expected_response.get() ?
+                runner_->settings_.expected_response_data :
+                runner_->settings_.response_data;
         
         TestRequestEqual(expected_request, client->request_, false);
 
@@ -682,7 +749,7 @@ class RequestTestRunner {
 
         if (settings_.expect_download_progress) {
           EXPECT_LE(1, client->download_progress_ct_);
-          EXPECT_EQ(runner_->settings_.response_data.size(),
+          EXPECT_EQ(expected_response_data.size(),
                     client->download_total_);
         } else {
           EXPECT_EQ(0, client->download_progress_ct_);
@@ -691,7 +758,7 @@ class RequestTestRunner {
 
         if (settings_.expect_download_data) {
           EXPECT_LE(1, client->download_data_ct_);
-          EXPECT_STREQ(runner_->settings_.response_data.c_str(),
+          EXPECT_STREQ(expected_response_data.c_str(),
                        client->download_data_.c_str());
         } else {
           EXPECT_EQ(0, client->download_data_ct_);
@@ -1017,6 +1084,8 @@ REQ_TEST(BrowserGET, REQTEST_GET, true);
 REQ_TEST(BrowserGETNoData, REQTEST_GET_NODATA, true);
 REQ_TEST(BrowserGETAllowCookies, REQTEST_GET_ALLOWCOOKIES, true);
 REQ_TEST(BrowserGETRedirect, REQTEST_GET_REDIRECT, true);
+REQ_TEST(BrowserGETRange, REQTEST_GET_RANGE, true);
+REQ_TEST(BrowserGETRangeNoSkip, REQTEST_GET_RANGE_NOSKIP, true);
 REQ_TEST(BrowserPOST, REQTEST_POST, true);
 REQ_TEST(BrowserPOSTWithProgress, REQTEST_POST_WITHPROGRESS, true);
 REQ_TEST(BrowserHEAD, REQTEST_HEAD, true);
@@ -1025,6 +1094,8 @@ REQ_TEST(RendererGET, REQTEST_GET, false);
 REQ_TEST(RendererGETNoData, REQTEST_GET_NODATA, false);
 REQ_TEST(RendererGETAllowCookies, REQTEST_GET_ALLOWCOOKIES, false);
 REQ_TEST(RendererGETRedirect, REQTEST_GET_REDIRECT, false);
+REQ_TEST(RendererGETRange, REQTEST_GET_RANGE, false);
+REQ_TEST(RendererGETRangeNoSkip, REQTEST_GET_RANGE_NOSKIP, false);
 REQ_TEST(RendererPOST, REQTEST_POST, false);
 REQ_TEST(RendererPOSTWithProgress, REQTEST_POST_WITHPROGRESS, false);
 REQ_TEST(RendererHEAD, REQTEST_HEAD, false);
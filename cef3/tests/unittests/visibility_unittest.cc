@@ -0,0 +1,82 @@
+// Copyright (c) 2012 The Chromium Embedded Framework Authors. All rights
+// reserved. Use of this source code is governed by a BSD-style license that
+// can be found in the LICENSE file.
+
+#include <string>
+#include <vector>
+
+#include "include/cef_process_message.h"
+#include "tests/unittests/test_handler.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace {
+
+const char kVisibilityUrl[] = "http://tests/VisibilityTest.WasHidden";
+const char kVisibilityMsg[] = "VisibilityTest.StateChange";
+
+class WasHiddenTestHandler : public TestHandler {
+ public:
+  WasHiddenTestHandler() {}
+
+  virtual void RunTest() OVERRIDE {
+    // Report page visibility changes to the browser process.
+    std::string content =
+        "<html><head>\n"
+        "<script>\n"
+        "document.addEventListener('webkitvisibilitychange', function() {\n"
+        "  app.sendMessage('" + std::string(kVisibilityMsg) + "',\n"
+        "                  [document.webkitVisibilityState]);\n"
+        "}, false);\n"
+        "</script>\n"
+        "</head><body>TEST</body></html>";
+    AddResource(kVisibilityUrl, content, "text/html");
+    CreateBrowser(kVisibilityUrl);
+  }
+
+  virtual void OnLoadEnd(CefRefPtr<CefBrowser> browser,
+                         CefRefPtr<CefFrame> frame,
+                         int httpStatusCode) OVERRIDE {
+    if (!frame->IsMain())
+      return;
+
+    EXPECT_FALSE(browser->GetHost()->IsHidden());
+
+    // Called on the UI thread so the state changes immediately.
+    browser->GetHost()->WasHidden(true);
+    EXPECT_TRUE(browser->GetHost()->IsHidden());
+  }
+
+  virtual bool OnProcessMessageReceived(
+      CefRefPtr<CefBrowser> browser,
+      CefProcessId source_process,
+      CefRefPtr<CefProcessMessage> message) OVERRIDE {
+    EXPECT_EQ(PID_RENDERER, source_process);
+    if (message->GetName() != kVisibilityMsg)
+      return false;
+
+    std::string state = message->GetArgumentList()->GetString(0);
+    states_.push_back(state);
+
+    if (state == "hidden") {
+      browser->GetHost()->WasHidden(false);
+      EXPECT_FALSE(browser->GetHost()->IsHidden());
+    } else {
+      DestroyTest();
+    }
+    return true;
+  }
+
+  std::vector<std::string> states_;
+};
+
+}  // namespace
+
+// Test that hiding and showing a browser changes the page visibility state.
+TEST(VisibilityTest, WasHidden) {
+  CefRefPtr<WasHiddenTestHandler> handler = new WasHiddenTestHandler();
+  handler->ExecuteTest();
+
+  ASSERT_EQ(2U, handler->states_.size());
+  EXPECT_EQ("hidden", handler->states_[0]);
+  EXPECT_EQ("visible", handler->states_[1]);
+}
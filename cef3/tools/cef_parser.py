@@ -287,7 +287,7 @@ def format_translation_includes(body):
         result += '#include "libcef_dll/ctocpp/'+ \
                   get_capi_name(item[3:], False)+'_ctocpp.h"\n'
     
-    if body.find('transfer_') > 0:
+    if body.find('transfer_') > 0 or body.find('CefStringBlock') > 0:
         result += '#include "libcef_dll/transfer_util.h"\n'
         
     return result
@@ -339,7 +339,7 @@ def dict_to_str(dict):
 
 
 # regex for matching comment-formatted attributes
-_cre_attrib = '/\*--cef\(([A-Za-z0-9_ ,=:\n]{0,})\)--\*/'
+_cre_attrib = '/\*--cef\(([A-Za-z0-9_ ,=:\n-]{0,})\)--\*/'
 # regex for matching class and function names
 _cre_cfname = '([A-Za-z0-9_]{1,})'
 # regex for matching function return values
@@ -378,6 +378,7 @@ _simpletypes = {
     'CefWindowHandle' : ['cef_window_handle_t', 'NULL'],
     'CefRect' : ['cef_rect_t', 'CefRect()'],
     'CefThreadId' : ['cef_thread_id_t', 'TID_UI'],
+    'CefWorkerPriority' : ['cef_worker_priority_t', 'WORKER_PRIORITY_NORMAL'],
     'CefTime' : ['cef_time_t', 'CefTime()'],
 }
 
@@ -853,6 +854,19 @@ class obj_class:
         """ Returns true if the class is implemented by the client. """
         return self.attribs['source'] == 'client'
 
+    def is_single_thread(self):
+        """ Returns true if the class is only referenced on a single thread. """
+        return 'single_thread' in self.attribs
+
+    def get_wrapper_template_args(self, wrapper):
+        """ Return the template arguments for the CefCppToC or CefCToCpp base
+            class of the |wrapper| class. """
+        result = self.get_name()+wrapper+', '+self.get_name()+', '+ \
+                 self.get_capi_name()
+        if self.is_single_thread():
+            result += ', CefSingleThreadRefCount'
+        return result
+
 
 class obj_typedef:
     """ Class representing a typedef statement. """
@@ -1005,9 +1019,13 @@ class obj_function:
     def get_capi_parts(self, defined_structs = [], prefix = None):
         """ Return the parts of the C API function definition. """
         retval = ''
-        dict = self.retval.get_type().get_capi(defined_structs)
-        if dict['format'] == 'single':
-            retval = dict['value']
+        if self.retval.get_retval_type() == 'string_buffer':
+            # the string is returned via a caller-provided structure
+            retval = 'void'
+        else:
+            dict = self.retval.get_type().get_capi(defined_structs)
+            if dict['format'] == 'single':
+                retval = dict['value']
             
         name = self.get_capi_name(prefix)
         args = []
@@ -1023,6 +1041,10 @@ class obj_function:
         if len(self.arguments) > 0:
             for cls in self.arguments:
                 type = cls.get_type()
+                if cls.is_borrowed():
+                    # borrowed collections are passed as a block of strings
+                    args.extend(cls.get_capi_borrowed_parts())
+                    continue
                 dict = type.get_capi(defined_structs)
                 if dict['format'] == 'single':
                     args.append(dict['value'])
@@ -1036,6 +1058,9 @@ class obj_function:
                         # for non-const arrays pass the size argument by address
                         args.append('size_t* '+type_name+'Count')
                     args.append(dict['value'])
+
+        if self.retval.get_retval_type() == 'string_buffer':
+            args.append('cef_string_t* _retval')
         
         return { 'retval' : retval, 'name' : name, 'args' : args }
 
@@ -1223,10 +1248,47 @@ class obj_argument:
         """ Returns the defualt return value for this argument. """
         return self.parent.get_attrib('default_retval')
         
+    def is_borrowed(self):
+        """ Returns true if this argument is identified by a 'borrowed_param'
+        attribute.
+        """
+        borrowed_params = self.parent.get_attrib_list('borrowed_param')
+        return self.type.has_name() and not borrowed_params is None and \
+            self.type.get_name() in borrowed_params
+
+    def get_capi_borrowed_parts(self):
+        """ Returns the C API arguments for a borrowed collection. """
+        name = self.type.get_name()
+        if not self.type.is_const():
+            # non-const collections are delivered to a caller-provided visitor
+            return ['cef_string_block_visitor_t '+name+'Visitor',
+                    'void* '+name+'Context']
+        if self.type.is_result_vector():
+            return ['size_t '+name+'Count', 'const cef_string_t* '+name]
+        return ['size_t '+name+'Count', 'const cef_string_t* '+name+'Keys',
+                'const cef_string_t* '+name+'Values']
+
     def get_arg_type(self):
         """ Returns the argument type as defined in translator.README.txt. """
         if not self.type.has_name():
             raise Exception('Cannot be called for retval types')
+
+        if self.is_borrowed():
+            # borrowed collection types
+            if not self.type.is_byref():
+                return 'invalid'
+            if self.type.is_result_vector() and \
+               self.type.is_result_vector_string():
+                result = 'string_vec_borrowed'
+            elif self.type.is_result_map_single():
+                result = 'string_map_single_borrowed'
+            elif self.type.is_result_map_multi():
+                result = 'string_map_multi_borrowed'
+            else:
+                return 'invalid'
+            if self.type.is_const():
+                result += '_const'
+            return result
         
         # simple or enumeration type
         if (self.type.is_result_simple() and \
@@ -1306,6 +1368,12 @@ class obj_argument:
                 if same_side:
                     return 'refptr_vec_same_byref'
                 return 'refptr_vec_diff_byref'
+
+            if self.type.is_result_vector_struct():
+                # structure vector types are only supported as input values
+                if self.type.is_const():
+                    return 'struct_vec_byref_const'
+                return 'invalid'
           
         
         # string single map type
@@ -1349,6 +1417,8 @@ class obj_argument:
             return 'bool'
 
         if self.type.is_result_string():
+            if self.parent.has_attrib('buffer_retval'):
+                return 'string_buffer'
             return 'string'
 
         if self.type.is_result_refptr():
@@ -1384,6 +1454,10 @@ class obj_argument:
             if for_capi:
                 return 'NULL'
             return 'CefString()'
+        elif type == 'string_buffer':
+            if for_capi:
+                return ''
+            return 'CefString()'
         elif type == 'refptr_same' or type == 'refptr_diff':
             return 'NULL'
         
@@ -1693,6 +1767,12 @@ class obj_analysis:
     def is_result_vector_refptr(self):
         """ Returns true if this is a string vector. """
         return self.result_value[0]['result_type'] == 'refptr'
+
+    def is_result_vector_struct(self):
+        """ Returns true if this is a structure vector. """
+        # only CEF structure wrapper types are supported, not enumerations
+        return self.result_value[0]['result_type'] == 'structure' and \
+               self.result_value[0]['vector_type'][0:3] == 'Cef'
     
     def get_result_vector_type_root(self):
         """ Return the vector structure or basic type name. """
@@ -1727,6 +1807,14 @@ class obj_analysis:
                 str += ' const'
             str += '*'
             result['value'] = str
+        elif type == 'structure' and self.is_result_vector_struct():
+            str = ''
+            if self.is_const():
+                str += 'const '
+            if not value in defined_structs:
+                str += 'struct _'
+            str += value+'*'
+            result['value'] = str
         else:
             raise Exception('Unsupported vector type: '+type)
         
@@ -12,7 +12,10 @@ def make_capi_global_funcs(funcs, defined_names, translate_map, indent):
         comment = func.get_comment()
         if first or len(comment) > 0:
             result += '\n'+format_comment(comment, indent, translate_map);
-        if func.get_retval().get_type().is_result_string():
+        if func.get_retval().get_retval_type() == 'string_buffer':
+            result += indent+'// The resulting string will be written to |_retval|, which must be cleared\n'+ \
+                      indent+'// by calling cef_string_clear().\n'
+        elif func.get_retval().get_type().is_result_string():
             result += indent+'// The resulting string must be freed by calling cef_string_userfree_free().\n'
         result += wrap_code(indent+'CEF_EXPORT '+
                             func.get_capi_proto(defined_names)+';')
@@ -27,7 +30,10 @@ def make_capi_member_funcs(funcs, defined_names, translate_map, indent):
         comment = func.get_comment()
         if first or len(comment) > 0:
             result += '\n'+format_comment(comment, indent, translate_map)
-        if func.get_retval().get_type().is_result_string():
+        if func.get_retval().get_retval_type() == 'string_buffer':
+            result += indent+'// The resulting string will be written to |_retval|, which must be cleared\n'+ \
+                      indent+'// by calling cef_string_clear().\n'
+        elif func.get_retval().get_type().is_result_string():
             result += indent+'// The resulting string must be freed by calling cef_string_userfree_free().\n'
         parts = func.get_capi_parts()
         result += wrap_code(indent+parts['retval']+' (CEF_CALLBACK *'+
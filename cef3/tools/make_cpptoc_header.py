@@ -55,7 +55,7 @@ def make_cpptoc_header(header, clsname):
         result += '// This class may be instantiated and accessed wrapper-side only.\n'
     
     result +=  'class '+clsname+'CppToC\n'+ \
-               '    : public CefCppToC<'+clsname+'CppToC, '+clsname+', '+capiname+'> {\n'+ \
+               '    : public CefCppToC<'+cls.get_wrapper_template_args('CppToC')+'> {\n'+ \
                ' public:\n'+ \
                '  explicit '+clsname+'CppToC('+clsname+'* cls);\n'+ \
                '  virtual ~'+clsname+'CppToC() {}\n'+ \
@@ -108,11 +108,29 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
                       '\n  if (!'+arg_name+'Count || (*'+arg_name+'Count > 0 && !'+arg_name+'))'\
                       '\n    return'+retval_default+';'
         elif arg_type == 'simple_vec_byref_const' or arg_type == 'bool_vec_byref_const' or \
-            arg_type == 'refptr_vec_same_byref_const' or arg_type == 'refptr_vec_diff_byref_const':
+            arg_type == 'refptr_vec_same_byref_const' or arg_type == 'refptr_vec_diff_byref_const' or \
+            arg_type == 'struct_vec_byref_const':
+            result += comment+\
+                      '\n  DCHECK('+arg_name+'Count == 0 || '+arg_name+');'\
+                      '\n  if ('+arg_name+'Count > 0 && !'+arg_name+')'\
+                      '\n    return'+retval_default+';'
+        elif arg_type == 'string_vec_borrowed_const':
             result += comment+\
                       '\n  DCHECK('+arg_name+'Count == 0 || '+arg_name+');'\
                       '\n  if ('+arg_name+'Count > 0 && !'+arg_name+')'\
                       '\n    return'+retval_default+';'
+        elif arg_type == 'string_map_single_borrowed_const' or \
+            arg_type == 'string_map_multi_borrowed_const':
+            result += comment+\
+                      '\n  DCHECK('+arg_name+'Count == 0 || ('+arg_name+'Keys && '+arg_name+'Values));'\
+                      '\n  if ('+arg_name+'Count > 0 && (!'+arg_name+'Keys || !'+arg_name+'Values))'\
+                      '\n    return'+retval_default+';'
+        elif arg_type == 'string_vec_borrowed' or arg_type == 'string_map_single_borrowed' or \
+            arg_type == 'string_map_multi_borrowed':
+            result += comment+\
+                      '\n  DCHECK('+arg_name+'Visitor);'\
+                      '\n  if (!'+arg_name+'Visitor)'\
+                      '\n    return'+retval_default+';'
 
         # check index params
         index_params = arg.parent.get_attrib_list('index_param')
@@ -122,6 +140,12 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
                       '\n  if ('+arg_name+' < 0)'\
                       '\n    return'+retval_default+';'
 
+    if retval_type == 'string_buffer':
+        result += '\n  // Verify param: _retval; type: string_buffer'\
+                  '\n  DCHECK(_retval);'\
+                  '\n  if (!_retval)'\
+                  '\n    return;'
+
     if len(optional) > 0:
         result += '\n  // Unverified params: '+string.join(optional,', ')
     
@@ -208,6 +232,31 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
                       '\n  std::multimap<CefString, CefString> '+arg_name+'Multimap;'\
                       '\n  transfer_string_multimap_contents('+arg_name+', '+arg_name+'Multimap);'
             params.append(arg_name+'Multimap')
+        elif arg_type == 'string_vec_borrowed' or arg_type == 'string_vec_borrowed_const' or \
+            arg_type == 'string_map_single_borrowed' or arg_type == 'string_map_single_borrowed_const' or \
+            arg_type == 'string_map_multi_borrowed' or arg_type == 'string_map_multi_borrowed_const':
+            if arg_type.startswith('string_vec'):
+                local = arg_name+'List'
+                result += comment+\
+                          '\n  std::vector<CefString> '+local+';'
+                keys = arg_name
+                values = 'NULL'
+            elif arg_type.startswith('string_map_single'):
+                local = arg_name+'Map'
+                result += comment+\
+                          '\n  std::map<CefString, CefString> '+local+';'
+                keys = arg_name+'Keys'
+                values = arg_name+'Values'
+            else:
+                local = arg_name+'Multimap'
+                result += comment+\
+                          '\n  std::multimap<CefString, CefString> '+local+';'
+                keys = arg_name+'Keys'
+                values = arg_name+'Values'
+            if arg_type.endswith('_const'):
+                result += '\n  transfer_string_block_contents('+arg_name+'Count, '+keys+', '+values+','\
+                          '\n      '+local+');'
+            params.append(local)
         elif arg_type == 'simple_vec_byref' or arg_type == 'bool_vec_byref' or \
             arg_type == 'refptr_vec_same_byref' or arg_type == 'refptr_vec_diff_byref':
             vec_type = arg.get_type().get_vector_type()
@@ -250,6 +299,18 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
                       '\n    }'\
                       '\n  }'
             params.append(arg_name+'List')
+        elif arg_type == 'struct_vec_byref_const':
+            struct_type = arg.get_type().get_vector_type()
+            # Reference the existing values instead of copying.
+            result += comment+\
+                      '\n  std::vector<'+struct_type+' > '+arg_name+'List;'\
+                      '\n  if ('+arg_name+'Count > 0) {'\
+                      '\n    '+arg_name+'List.resize('+arg_name+'Count);'\
+                      '\n    for (size_t i = 0; i < '+arg_name+'Count; ++i) {'\
+                      '\n      '+arg_name+'List[i].Set('+arg_name+'[i], false);'\
+                      '\n    }'\
+                      '\n  }'
+            params.append(arg_name+'List')
         
     if len(result) != result_len:
         result += '\n'
@@ -264,7 +325,10 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
             result += retval.get_type().get_result_simple_type()
         else:
             result += retval.get_type().get_type()
-        result += ' _retval = '
+        if retval_type == 'string_buffer':
+            result += ' _retvalStr = '
+        else:
+            result += ' _retval = '
     
     if isinstance(func.parent, obj_class):
         # virtual and static class methods
@@ -328,6 +392,16 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
             result += comment+\
                       '\n  cef_string_multimap_clear('+arg_name+');'\
                       '\n  transfer_string_multimap_contents('+arg_name+'Multimap, '+arg_name+');'
+        elif arg_type == 'string_vec_borrowed' or arg_type == 'string_map_single_borrowed' or \
+            arg_type == 'string_map_multi_borrowed':
+            if arg_type == 'string_vec_borrowed':
+                local = arg_name+'List'
+            elif arg_type == 'string_map_single_borrowed':
+                local = arg_name+'Map'
+            else:
+                local = arg_name+'Multimap'
+            result += comment+\
+                      '\n  CefStringBlock('+local+').Visit('+arg_name+'Visitor, '+arg_name+'Context);'
         elif arg_type == 'simple_vec_byref' or arg_type == 'bool_vec_byref' or \
             arg_type == 'refptr_vec_same_byref' or arg_type == 'refptr_vec_diff_byref':
             if arg_type == 'simple_vec_byref' or arg_type == 'bool_vec_byref':
@@ -386,6 +460,8 @@ def make_cpptoc_function_impl_new(name, func, defined_names):
             result += '\n  return _retval;'
         elif retval_type == 'string':
             result += '\n  return _retval.DetachToUserFree();'
+        elif retval_type == 'string_buffer':
+            result += '\n  transfer_string_contents(_retvalStr, _retval);'
         elif retval_type == 'refptr_same':
             refptr_class = retval.get_type().get_refptr_type()
             result += '\n  return '+refptr_class+'CppToC::Wrap(_retval);'
@@ -459,9 +535,10 @@ def make_cpptoc_class_impl(header, clsname, impl):
 
     result += includes+'\n'+resultingimpl+'\n'
     
+    template_args = cls.get_wrapper_template_args('CppToC')
     const =  '// CONSTRUCTOR - Do not edit by hand.\n\n'+ \
              clsname+'CppToC::'+clsname+'CppToC('+clsname+'* cls)\n'+ \
-             '    : CefCppToC<'+clsname+'CppToC, '+clsname+', '+capiname+'>(cls) '+ \
+             '    : CefCppToC<'+template_args+'>(cls) '+ \
              '{\n';
                 
     funcs = cls.get_virtual_funcs()
@@ -471,7 +548,7 @@ def make_cpptoc_class_impl(header, clsname, impl):
                 
     const += '}\n\n'+ \
              '#ifndef NDEBUG\n'+ \
-             'template<> long CefCppToC<'+clsname+'CppToC, '+clsname+', '+capiname+'>::DebugObjCt = 0;\n'+ \
+             'template<> long CefCppToC<'+template_args+'>::DebugObjCt = 0;\n'+ \
              '#endif\n'
     result += wrap_code(const)
 
@@ -66,11 +66,12 @@ def make_ctocpp_header(header, clsname):
     else:
         result += '// This class may be instantiated and accessed wrapper-side only.\n'
     
+    template_args = cls.get_wrapper_template_args('CToCpp')
     result +=   'class '+clsname+'CToCpp\n'+ \
-                '    : public CefCToCpp<'+clsname+'CToCpp, '+clsname+', '+capiname+'> {\n'+ \
+                '    : public CefCToCpp<'+template_args+'> {\n'+ \
                 ' public:\n'+ \
                 '  explicit '+clsname+'CToCpp('+capiname+'* str)\n'+ \
-                '      : CefCToCpp<'+clsname+'CToCpp, '+clsname+', '+capiname+'>(str) {}\n'+ \
+                '      : CefCToCpp<'+template_args+'>(str) {}\n'+ \
                 '  virtual ~'+clsname+'CToCpp() {}\n\n'+ \
                 '  // '+clsname+' methods\n';
     
@@ -204,6 +204,29 @@ def make_ctocpp_function_impl_new(clsname, name, func):
                       '\n  if ('+arg_name+'Multimap)'\
                       '\n    transfer_string_multimap_contents('+arg_name+', '+arg_name+'Multimap);'
             params.append(arg_name+'Multimap')
+        elif arg_type == 'string_vec_borrowed_const' or \
+             arg_type == 'string_map_single_borrowed_const' or \
+             arg_type == 'string_map_multi_borrowed_const':
+            # The strings are referenced instead of copied and remain owned by
+            # the C++ collection for the duration of the call.
+            result += comment+\
+                      '\n  CefStringBlock '+arg_name+'Block('+arg_name+');'
+            params.append(arg_name+'Block.count()')
+            params.append(arg_name+'Block.keys()')
+            if arg_type != 'string_vec_borrowed_const':
+                params.append(arg_name+'Block.values()')
+        elif arg_type == 'string_vec_borrowed' or arg_type == 'string_map_single_borrowed' or \
+             arg_type == 'string_map_multi_borrowed':
+            if arg_type == 'string_vec_borrowed':
+                visitor = 'transfer_string_list_block'
+            elif arg_type == 'string_map_single_borrowed':
+                visitor = 'transfer_string_map_block'
+            else:
+                visitor = 'transfer_string_multimap_block'
+            result += comment+\
+                      '\n  '+arg_name+'.clear();'
+            params.append(visitor)
+            params.append('&'+arg_name)
         elif arg_type == 'simple_vec_byref' or arg_type == 'bool_vec_byref' or \
              arg_type == 'refptr_vec_same_byref' or arg_type == 'refptr_vec_diff_byref':
             count_func = arg.get_attrib_count_func()
@@ -260,6 +283,24 @@ def make_ctocpp_function_impl_new(clsname, name, func):
                       '\n  }'
             params.append(arg_name+'Count')
             params.append(arg_name+'List')
+        elif arg_type == 'struct_vec_byref_const':
+            vec_type = arg.get_type().get_result_vector_type_root()
+            # The structure values are referenced instead of copied and remain
+            # owned by the C++ vector for the duration of the call.
+            result += comment+\
+                      '\n  const size_t '+arg_name+'Count = '+arg_name+'.size();'\
+                      '\n  '+vec_type+'* '+arg_name+'List = NULL;'\
+                      '\n  if ('+arg_name+'Count > 0) {'\
+                      '\n    '+arg_name+'List = new '+vec_type+'['+arg_name+'Count];'\
+                      '\n    DCHECK('+arg_name+'List);'\
+                      '\n    if ('+arg_name+'List) {'\
+                      '\n      for (size_t i = 0; i < '+arg_name+'Count; ++i) {'\
+                      '\n        '+arg_name+'List[i] = '+arg_name+'[i];'\
+                      '\n      }'\
+                      '\n    }'\
+                      '\n  }'
+            params.append(arg_name+'Count')
+            params.append(arg_name+'List')
 
     if len(result) != result_len:
         result += '\n'
@@ -268,7 +309,11 @@ def make_ctocpp_function_impl_new(clsname, name, func):
     # execution
     result += '\n  // Execute\n  '
 
-    if retval_type != 'none':
+    if retval_type == 'string_buffer':
+        # the string is written directly into the returned object
+        result += 'CefString _retval;\n  '
+        params.append('_retval.GetWritableStruct()')
+    elif retval_type != 'none':
         # has a return value
         if retval_type == 'simple' or retval_type == 'bool':
             result += retval.get_type().get_result_simple_type_root()
@@ -378,7 +423,8 @@ def make_ctocpp_function_impl_new(clsname, name, func):
                       '\n    delete [] '+arg_name+'List;'\
                       '\n  }'
         elif arg_type == 'simple_vec_byref_const' or arg_type == 'bool_vec_byref_const' or \
-             arg_type == 'refptr_vec_same_byref_const' or arg_type == 'refptr_vec_diff_byref_const':
+             arg_type == 'refptr_vec_same_byref_const' or arg_type == 'refptr_vec_diff_byref_const' or \
+             arg_type == 'struct_vec_byref_const':
             result += comment+\
                       '\n  if ('+arg_name+'List)'\
                       '\n    delete [] '+arg_name+'List;'
@@ -421,6 +467,8 @@ def make_ctocpp_function_impl_new(clsname, name, func):
             result += '\n  return _retval;'
         elif retval_type == 'bool':
             result += '\n  return _retval?true:false;'
+        elif retval_type == 'string_buffer':
+            result += '\n  return _retval;'
         elif retval_type == 'string':
             result += '\n  CefString _retvalStr;'\
                       '\n  _retvalStr.AttachToUserFree(_retval);'\
@@ -487,8 +535,9 @@ def make_ctocpp_class_impl(header, clsname, impl):
 
     result += includes+'\n'+resultingimpl+'\n'
     
+    template_args = cls.get_wrapper_template_args('CToCpp')
     result += wrap_code('#ifndef NDEBUG\n'+ \
-              'template<> long CefCToCpp<'+clsname+'CToCpp, '+clsname+', '+capiname+'>::DebugObjCt = 0;\n'+ \
+              'template<> long CefCToCpp<'+template_args+'>::DebugObjCt = 0;\n'+ \
               '#endif\n')
 
     return result